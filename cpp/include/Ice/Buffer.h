@@ -78,6 +78,15 @@ public:
 
         void clear();
 
+        //
+        // Set the maximum number of bytes kept in the pool of released buffers of the
+        // thread which releases the buffer of this container, 0 disables the pooling.
+        //
+        void setPoolSize(size_type sz)
+        {
+            _poolSize = sz;
+        }
+
         void resize(size_type n) // Inlined for performance reasons.
         {
             if(n == 0)
@@ -143,6 +152,7 @@ public:
         size_type _capacity;
         int _shrinkCounter;
         bool _owned;
+        size_type _poolSize;
     };
 
     Container b;
@@ -0,0 +1,87 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_CODEC_H
+#define ICE_COMPRESSION_CODEC_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <Ice/Config.h>
+#include <Ice/CommunicatorF.h>
+
+namespace Ice
+{
+
+/**
+ * A compression codec used to compress the body of protocol messages. Each codec is
+ * identified by an id in the range 0 to 5. The built-in bzip2, zstd and lz4 codecs use
+ * the ids 0, 1 and 2.
+ * \headerfile Ice/Ice.h
+ */
+class ICE_API CompressionCodec
+#ifndef ICE_CPP11_MAPPING
+    : public virtual IceUtil::Shared
+#endif
+{
+public:
+
+    virtual ~CompressionCodec();
+
+    /**
+     * Obtains the id of this codec, it's carried in the header of the compressed messages.
+     * @return The codec id.
+     */
+    virtual Byte id() const = 0;
+
+    /**
+     * Obtains the name of this codec, used to select the codec with the Ice.Compression.Codec
+     * property or the -z endpoint option.
+     * @return The codec name.
+     */
+    virtual std::string name() const = 0;
+
+    /**
+     * Computes the maximum size of the compressed data.
+     * @param size The size of the uncompressed data.
+     * @return The maximum size of the compressed data.
+     */
+    virtual size_t compressBound(size_t size) const = 0;
+
+    /**
+     * Compresses a buffer.
+     * @param src The data to compress.
+     * @param srcLen The size of the data to compress.
+     * @param dst The destination buffer, it's at least compressBound(srcLen) bytes long.
+     * @param dstLen The size of the destination buffer.
+     * @param level The compression level, from 1 to 9.
+     * @return The size of the compressed data.
+     * @throws CompressionException If the data can't be compressed.
+     */
+    virtual size_t compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int level) const = 0;
+
+    /**
+     * Uncompresses a buffer.
+     * @param src The compressed data.
+     * @param srcLen The size of the compressed data.
+     * @param dst The destination buffer.
+     * @param dstLen The size of the destination buffer, it's the exact size of the uncompressed data.
+     * @throws CompressionException If the data can't be uncompressed.
+     */
+    virtual void uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const = 0;
+};
+ICE_DEFINE_PTR(CompressionCodecPtr, CompressionCodec);
+
+/**
+ * Registers a compression codec with a communicator. This function is intended to be called
+ * by a plug-in from its initialize method, before the communicator establishes connections.
+ * A codec registered with the id of another codec replaces it.
+ * @param communicator The communicator.
+ * @param codec The compression codec.
+ * @throws InitializationException If the codec id is out of range.
+ */
+ICE_API void registerCompressionCodec(const CommunicatorPtr& communicator, const CompressionCodecPtr& codec);
+
+}
+
+#endif
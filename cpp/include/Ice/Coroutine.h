@@ -0,0 +1,436 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COROUTINE_H
+#define ICE_COROUTINE_H
+
+#include <Ice/Config.h>
+
+//
+// Operations with the cpp:coroutine metadata are mapped to C++20 coroutines when
+// the C++11 mapping is compiled with coroutine support.
+//
+#if defined(ICE_CPP11_MAPPING) && (ICE_CPLUSPLUS >= 202002L) && defined(__cpp_impl_coroutine)
+#   define ICE_HAS_COROUTINES
+#endif
+
+#ifdef ICE_HAS_COROUTINES
+
+#include <Ice/OutgoingAsync.h>
+#include <Ice/IncomingAsync.h>
+
+#include <atomic>
+#include <coroutine>
+#include <optional>
+
+namespace IceInternal
+{
+
+//
+// Completion of an invocation awaited by a coroutine. The invocation is started
+// when the awaitable is created, a coroutine can co_await it later. The coroutine
+// is resumed directly from the thread which completes the invocation, outside the
+// outgoing's lock: for a twoway invocation, this is the client thread pool thread
+// which read the response.
+//
+class CoroutineInvoke : public virtual OutgoingAsyncCompletionCallback
+{
+public:
+
+    bool isCompleted() const
+    {
+        return _state.load(std::memory_order_acquire) == completedState();
+    }
+
+    //
+    // Returns false if the invocation completed before the coroutine suspended,
+    // in which case the coroutine must not be suspended.
+    //
+    bool suspend(std::coroutine_handle<> handle)
+    {
+        void* expected = nullptr;
+        return _state.compare_exchange_strong(expected, handle.address(), std::memory_order_acq_rel);
+    }
+
+protected:
+
+    CoroutineInvoke() : _state(nullptr)
+    {
+    }
+
+    void rethrowException() const
+    {
+        if(_exception)
+        {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+    virtual bool handleSent(bool done, bool alreadySent) override
+    {
+        return done && !alreadySent; // A oneway invocation is completed once sent.
+    }
+
+    virtual bool handleException(const Ice::Exception& ex) override
+    {
+        try
+        {
+            ex.ice_throw();
+        }
+        catch(const Ice::Exception&)
+        {
+            _exception = std::current_exception();
+        }
+        return true;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const override
+    {
+        complete();
+    }
+
+    virtual void handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const override
+    {
+        complete();
+    }
+
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const override
+    {
+        complete();
+    }
+
+    std::exception_ptr _exception;
+
+private:
+
+    void complete() const
+    {
+        void* handle = _state.exchange(completedState(), std::memory_order_acq_rel);
+        if(handle)
+        {
+            std::coroutine_handle<>::from_address(handle).resume();
+        }
+    }
+
+    void* completedState() const
+    {
+        return const_cast<CoroutineInvoke*>(this);
+    }
+
+    //
+    // Null until completed or awaited, the address of the awaiting coroutine
+    // once it's suspended and this object once the invocation is completed.
+    //
+    mutable std::atomic<void*> _state;
+};
+
+template<typename R>
+class CoroutineOutgoing : public OutgoingAsyncT<R>, public CoroutineInvoke
+{
+public:
+
+    CoroutineOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<R>(proxy, false)
+    {
+    }
+
+    R result()
+    {
+        rethrowException();
+        assert(_result);
+        return std::move(*_result);
+    }
+
+protected:
+
+    virtual bool handleResponse(bool ok) override
+    {
+        if(!ok)
+        {
+            this->throwUserException();
+        }
+        assert(this->_read);
+        this->_is.startEncapsulation();
+        _result.emplace(this->_read(&this->_is));
+        this->_is.endEncapsulation();
+        return true;
+    }
+
+private:
+
+    std::optional<R> _result;
+};
+
+template<>
+class CoroutineOutgoing<void> : public OutgoingAsyncT<void>, public CoroutineInvoke
+{
+public:
+
+    CoroutineOutgoing(const std::shared_ptr<Ice::ObjectPrx>& proxy) :
+        OutgoingAsyncT<void>(proxy, false)
+    {
+    }
+
+    void result()
+    {
+        rethrowException();
+    }
+
+protected:
+
+    virtual bool handleResponse(bool ok) override
+    {
+        if(!ok)
+        {
+            throwUserException();
+        }
+        else if(!_is.b.empty())
+        {
+            _is.skipEmptyEncapsulation();
+        }
+        return true;
+    }
+};
+
+template<typename R>
+class TaskPromiseBase
+{
+public:
+
+    using ResponseCallback = std::function<void(R)>;
+
+    void return_value(R value)
+    {
+        _value.emplace(std::move(value));
+    }
+
+protected:
+
+    void response()
+    {
+        _response(std::move(*_value));
+    }
+
+    ResponseCallback _response;
+    std::optional<R> _value;
+};
+
+template<>
+class TaskPromiseBase<void>
+{
+public:
+
+    using ResponseCallback = std::function<void()>;
+
+    void return_void()
+    {
+    }
+
+protected:
+
+    void response()
+    {
+        _response();
+    }
+
+    ResponseCallback _response;
+};
+
+//
+// The promise of a servant coroutine, the dispatch sends the response or the
+// exception once the coroutine returns.
+//
+template<typename R>
+class TaskPromise : public TaskPromiseBase<R>
+{
+public:
+
+    std::suspend_always initial_suspend() noexcept
+    {
+        return {};
+    }
+
+    std::suspend_never final_suspend() noexcept
+    {
+        try
+        {
+            if(_exception)
+            {
+                _exceptionCallback(_exception);
+            }
+            else
+            {
+                this->response();
+            }
+        }
+        catch(...)
+        {
+            try
+            {
+                _exceptionCallback(std::current_exception());
+            }
+            catch(...)
+            {
+            }
+        }
+        return {};
+    }
+
+    void unhandled_exception()
+    {
+        _exception = std::current_exception();
+    }
+
+    void setCallbacks(typename TaskPromiseBase<R>::ResponseCallback response,
+                      std::function<void(std::exception_ptr)> exception)
+    {
+        this->_response = std::move(response);
+        _exceptionCallback = std::move(exception);
+    }
+
+private:
+
+    std::function<void(std::exception_ptr)> _exceptionCallback;
+    std::exception_ptr _exception;
+};
+
+}
+
+namespace Ice
+{
+
+/**
+ * The result of a proxy method generated for an operation with the cpp:coroutine metadata.
+ * The invocation is sent when the awaitable is created, co_await suspends the calling
+ * coroutine until the invocation completes and returns its result or throws its exception.
+ * The coroutine is resumed by the thread which completes the invocation, usually a thread
+ * from the client thread pool. It must not be destroyed while suspended.
+ * \headerfile Ice/Ice.h
+ */
+template<typename R>
+class Awaitable
+{
+public:
+
+    /// \cond INTERNAL
+    explicit Awaitable(std::shared_ptr<IceInternal::CoroutineOutgoing<R>> outAsync) :
+        _outAsync(std::move(outAsync))
+    {
+    }
+    /// \endcond
+
+    /**
+     * Cancels the invocation locally, the awaiting coroutine is resumed with an
+     * InvocationCanceledException.
+     */
+    void cancel()
+    {
+        _outAsync->cancel();
+    }
+
+    /// \cond INTERNAL
+    bool await_ready() const noexcept
+    {
+        return _outAsync->isCompleted();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        return _outAsync->suspend(handle);
+    }
+
+    R await_resume()
+    {
+        return _outAsync->result();
+    }
+    /// \endcond
+
+private:
+
+    std::shared_ptr<IceInternal::CoroutineOutgoing<R>> _outAsync;
+};
+
+/**
+ * The return type of a servant coroutine which implements an operation with the
+ * cpp:coroutine metadata. The coroutine is started by the dispatch, the response is
+ * sent once it returns with co_return. An exception thrown by the coroutine is sent
+ * to the caller as with the other asynchronous dispatch mappings.
+ * \headerfile Ice/Ice.h
+ */
+template<typename R = void>
+class Task
+{
+public:
+
+    /// \cond INTERNAL
+    class promise_type : public IceInternal::TaskPromise<R>
+    {
+    public:
+
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+
+    Task(Task&& other) noexcept :
+        _handle(other._handle)
+    {
+        other._handle = nullptr;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task()
+    {
+        if(_handle)
+        {
+            _handle.destroy();
+        }
+    }
+
+    //
+    // Starts the coroutine, it destroys itself once it returns and called
+    // the response or exception callback.
+    //
+    void _start(typename IceInternal::TaskPromiseBase<R>::ResponseCallback response,
+                std::function<void(std::exception_ptr)> exception)
+    {
+        auto handle = _handle;
+        _handle = nullptr;
+        handle.promise().setCallbacks(std::move(response), std::move(exception));
+        handle.resume();
+    }
+    /// \endcond
+
+private:
+
+    explicit Task(std::coroutine_handle<promise_type> handle) :
+        _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+}
+
+namespace IceInternal
+{
+
+template<typename R, typename Prx, typename Fn, typename... Args>
+::Ice::Awaitable<R>
+makeAwaitable(Prx* proxy, Fn fn, Args&&... args)
+{
+    auto outAsync = std::make_shared<CoroutineOutgoing<R>>(proxy->shared_from_this());
+    (proxy->*fn)(outAsync, std::forward<Args>(args)...);
+    return ::Ice::Awaitable<R>(std::move(outAsync));
+}
+
+}
+
+#endif
+
+#endif
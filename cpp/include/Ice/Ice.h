@@ -26,6 +26,7 @@
 #include <Ice/SlicedData.h>
 #include <Ice/OutgoingAsync.h>
 #include <Ice/IncomingAsync.h>
+#include <Ice/Coroutine.h>
 #include <Ice/Process.h>
 #if !defined(ICE_OS_UWP) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
 #   include <Ice/Application.h>
@@ -38,6 +39,7 @@
 #include <Ice/Router.h>
 #include <Ice/DispatchInterceptor.h>
 #include <Ice/Plugin.h>
+#include <Ice/CompressionCodec.h>
 #include <Ice/NativePropertiesAdmin.h>
 #include <Ice/Instrumentation.h>
 #include <Ice/Metrics.h>
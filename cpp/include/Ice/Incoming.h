@@ -16,6 +16,7 @@
 #include <Ice/IncomingAsyncF.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/ResponseHandlerF.h>
+#include <IceUtil/Time.h>
 
 #include <deque>
 
@@ -177,7 +178,18 @@ public:
         _format = format;
     }
 
-    void invoke(const ServantManagerPtr&, Ice::InputStream*);
+    //
+    // The time the request was received is used to compute its deadline, the
+    // current time is used if it's not set.
+    //
+    void invoke(const ServantManagerPtr&, Ice::InputStream*, const IceUtil::Time& = IceUtil::Time());
+
+    //
+    // Rejects the request without dispatching it, a twoway request gets a reply
+    // which the caller can retry. The server busy reply status is only sent if the
+    // peer understands it, otherwise the reply is an unknown local exception.
+    //
+    void reject(Ice::InputStream*, bool);
 
     // Inlined for speed optimization.
     void skipReadParams()
@@ -210,6 +222,9 @@ private:
 
     friend class IncomingAsync;
 
+    void readCurrent();
+    void attachObserver(Ice::InputStream::Container::iterator);
+
     Ice::InputStream* _is;
     Ice::Byte* _inParamPos;
 
@@ -34,6 +34,22 @@ public:
     virtual void ice_exception() = 0;
 };
 
+/**
+ * Callback notified when the next chunk of a streamed result can be sent.
+ * \headerfile Ice/Ice.h
+ */
+class ICE_API ChunkReadyCallback : public Ice::LocalObject
+{
+public:
+
+    virtual ~ChunkReadyCallback();
+
+    /**
+     * Called once the chunks queued for sending drained, the next chunk can be sent.
+     */
+    virtual void ready() = 0;
+};
+
 }
 #endif
 
@@ -103,6 +119,17 @@ public:
 
     void completed();
 
+    //
+    // Marshal and send a chunk of the result of an operation with the cpp:stream
+    // metadata. The chunks are sent before the response which completes the dispatch.
+    // endWriteChunk doesn't wait, it queues the chunk and returns false if too many
+    // chunks are queued for sending. The ready callback is then called once the next
+    // chunk can be sent. The chunks are only sent if the client requested them, they
+    // are otherwise held and sent with the response.
+    //
+    Ice::OutputStream* startWriteChunk();
+    bool endWriteChunk(const ICE_DELEGATE(Ice::ChunkReadyCallback)&);
+
 #ifdef ICE_CPP11_MAPPING
     void completed(std::exception_ptr);
 #endif
@@ -110,6 +137,7 @@ public:
 private:
 
     void checkResponseSent();
+    void writeHeldChunks();
     bool _responseSent;
 
     //
@@ -117,6 +145,11 @@ private:
     // holds a ConnectionI* for optimization.
     //
     const ResponseHandlerPtr _responseHandlerCopy;
+
+    const bool _sendChunks;
+    Ice::OutputStream _chunkOs;
+    std::vector<Ice::Byte> _heldChunks;
+    Ice::Int _heldChunksSize;
 };
 
 #if defined(_MSC_VER) && (_MSC_VER >= 1900)
@@ -9,6 +9,10 @@
 
 #include <Ice/Handle.h>
 
+#ifdef ICE_CPP11_MAPPING
+#   include <functional>
+#endif
+
 namespace IceInternal
 {
 
@@ -22,15 +26,24 @@ typedef IceInternal::Handle<IncomingAsync> IncomingAsyncPtr;
 
 }
 
-#ifndef ICE_CPP11_MAPPING
 namespace Ice
 {
 
+#ifdef ICE_CPP11_MAPPING
+/**
+ * Callback notified when the next chunk of a streamed result can be sent.
+ */
+using ChunkReadyCallback = ::std::function<void()>;
+#else
 class AMD_Object_ice_invoke;
 ICE_API IceUtil::Shared* upCast(::Ice::AMD_Object_ice_invoke*);
 typedef IceInternal::Handle<AMD_Object_ice_invoke> AMD_Object_ice_invokePtr;
 
-}
+class ChunkReadyCallback;
+ICE_API IceUtil::Shared* upCast(::Ice::ChunkReadyCallback*);
+typedef IceInternal::Handle<ChunkReadyCallback> ChunkReadyCallbackPtr;
 #endif
 
+}
+
 #endif
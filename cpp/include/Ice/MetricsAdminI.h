@@ -27,6 +27,7 @@
 #endif
 
 #include <list>
+#include <set>
 
 namespace IceMX
 {
@@ -5,6 +5,8 @@
 #ifndef ICE_METRICSFUNCTIONAL_H
 #define ICE_METRICSFUNCTIONAL_H
 
+#include <Ice/Optional.h>
+
 namespace IceInternal
 {
 
@@ -120,6 +122,26 @@ template<typename T> struct Increment
     }
 };
 
+//
+// Metrics members added after Ice 3.7.0 are tagged members, an unset member is updated as if
+// it was 0.
+//
+template<typename T> struct Decrement<IceUtil::Optional<T> >
+{
+    void operator()(IceUtil::Optional<T>& v)
+    {
+        v = (v ? *v : T()) - 1;
+    }
+};
+
+template<typename T> struct Increment<IceUtil::Optional<T> >
+{
+    void operator()(IceUtil::Optional<T>& v)
+    {
+        v = (v ? *v : T()) + 1;
+    }
+};
+
 template<typename T> struct Add
 {
     Add(T v) : value(v) { }
@@ -130,6 +152,12 @@ template<typename T> struct Add
         v += value;
     }
 
+    template<typename Y>
+    void operator()(IceUtil::Optional<Y>& v)
+    {
+        v = (v ? *v : Y()) + value;
+    }
+
     T value;
 };
 
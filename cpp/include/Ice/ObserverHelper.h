@@ -120,6 +120,10 @@ public:
             _observer->reply(size);
         }
     }
+
+    void expired();
+    void rejected();
+    void concurrency(Ice::Int, Ice::Int);
 };
 
 class ICE_API InvocationObserver : public ObserverHelperT<Ice::Instrumentation::InvocationObserver>
@@ -13,6 +13,7 @@
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/RequestHandlerF.h>
 #include <Ice/ConnectionF.h>
+#include <Ice/IncomingAsyncF.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 #include <Ice/ObserverHelper.h>
@@ -24,6 +25,10 @@
 #endif
 
 #include <exception>
+#include <list>
+#ifdef ICE_CPP11_MAPPING
+#    include <condition_variable>
+#endif
 
 namespace IceInternal
 {
@@ -31,6 +36,14 @@ namespace IceInternal
 class RetryException;
 class CollocatedRequestHandler;
 
+class Hedging;
+#ifdef ICE_CPP11_MAPPING
+using HedgingPtr = ::std::shared_ptr<Hedging>;
+#else
+ICE_API IceUtil::Shared* upCast(Hedging*);
+typedef IceInternal::Handle<Hedging> HedgingPtr;
+#endif
+
 class ICE_API OutgoingAsyncCompletionCallback
 {
 public:
@@ -70,8 +83,8 @@ public:
     void invokeResponseAsync();
 
     void invokeSent();
-    void invokeException();
-    void invokeResponse();
+    virtual void invokeException();
+    virtual void invokeResponse();
 
     virtual void cancelable(const IceInternal::CancellationHandlerPtr&);
     void cancel();
@@ -104,6 +117,13 @@ public:
     virtual void _throwUserException();
 
     virtual void _scheduleCallback(const CallbackPtr&);
+
+    //
+    // Called by the next_ method of an operation with a streamed result. These aren't
+    // part of Ice::AsyncResult to keep its virtual table unchanged.
+    //
+    virtual Ice::InputStream* _startReadChunk();
+    virtual void _endReadChunk();
 #endif
 
     void attachRemoteObserver(const Ice::ConnectionInfoPtr& c, const Ice::EndpointPtr& endpt, Ice::Int requestId)
@@ -225,6 +245,7 @@ protected:
     bool sentImpl(bool);
     bool exceptionImpl(const Ice::Exception&);
     bool responseImpl(bool, bool);
+    bool hedgedResponse();
 
     virtual void runTimerTask();
 
@@ -232,6 +253,20 @@ protected:
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
 
+    //
+    // The invocation timeout of the proxy, or the remaining time before the deadline
+    // inherited from the dispatch of the calling thread if it expires first. If
+    // _propagateDeadline is true, the request carries this timeout as its deadline.
+    //
+    int _invocationTimeout;
+    bool _propagateDeadline;
+
+    //
+    // Set if the invocation is hedged, see ice_hedging. The invocation and its
+    // attempts share the hedging.
+    //
+    HedgingPtr _hedging;
+
 private:
 
     int _cnt;
@@ -246,12 +281,42 @@ class ICE_API OutgoingAsync : public ProxyOutgoingAsyncBase
 public:
 
     OutgoingAsync(const Ice::ObjectPrxPtr&, bool);
+    virtual ~OutgoingAsync();
 
     void prepare(const std::string&, Ice::OperationMode, const Ice::Context&);
 
+    //
+    // Request the result of an operation with the cpp:stream metadata as a stream of
+    // chunks, must be called before prepare. The server otherwise sends the complete
+    // result with a single reply.
+    //
+    void requestChunks()
+    {
+        _requestChunks = true;
+    }
+
     virtual bool sent();
+    virtual bool exception(const Ice::Exception&);
     virtual bool response();
 
+    //
+    // Queue a chunk of a streamed result, see the cpp:stream metadata. This is called
+    // with the connection locked. Returns false if the chunks window is full, the
+    // connection must then stop reading until resumeReading() is called on it once
+    // the application consumed the chunks. A collocated invocation has no connection,
+    // the ready callback of the producer is called instead.
+    //
+    bool chunk(Ice::InputStream&, const Ice::ConnectionIPtr&, const ICE_DELEGATE(Ice::ChunkReadyCallback)&);
+
+    virtual void invokeException();
+    virtual void invokeResponse();
+
+#ifndef ICE_CPP11_MAPPING
+    virtual bool _waitForResponse();
+    virtual Ice::InputStream* _startReadChunk();
+    virtual void _endReadChunk();
+#endif
+
     virtual AsyncStatus invokeRemote(const Ice::ConnectionIPtr&, bool, bool);
     virtual AsyncStatus invokeCollocated(CollocatedRequestHandler*);
 
@@ -290,13 +355,44 @@ public:
 
 protected:
 
+    //
+    // Records the completion of the request with the LeastLatency endpoint selection,
+    // see invokeRemote.
+    //
+    void latencyCompleted(bool);
+
     const Ice::EncodingVersion _encoding;
 
 #ifdef ICE_CPP11_MAPPING
     std::function<void(const ::Ice::UserException&)> _userException;
+    std::function<void(Ice::InputStream*)> _chunk;
 #endif
 
     bool _synchronous;
+    bool _requestChunks;
+
+private:
+
+    void popChunk(Ice::InputStream&, Ice::ConnectionIPtr&, ICE_DELEGATE(Ice::ChunkReadyCallback)&);
+    static void resumeChunks(const Ice::ConnectionIPtr&, const ICE_DELEGATE(Ice::ChunkReadyCallback)&);
+#ifdef ICE_CPP11_MAPPING
+    void invokeChunks(bool);
+#endif
+
+    std::list<Ice::InputStream*> _chunks;
+    Ice::ConnectionIPtr _chunkConnection; // The connection to resume once the chunks are consumed.
+    ICE_DELEGATE(Ice::ChunkReadyCallback) _chunkReady; // The collocated producer to resume once the chunks are consumed.
+    bool _chunked; // Set once a chunk is received, the invocation can't be retried anymore.
+    Ice::ConnectionIPtr _latencyConnection; // The connection of the request tracked by the endpoint latency table.
+    IceUtil::Time _latencyStart;
+#ifdef ICE_CPP11_MAPPING
+    bool _chunksPending; // Set while a thread pool work item to invoke the chunk callback is queued.
+    bool _invokingChunks;
+    std::condition_variable _chunksInvoked;
+#else
+    bool _chunksDiscarded; // Set once end_ is called, the remaining chunks are discarded.
+    Ice::InputStream _chunkIs;
+#endif
 };
 
 }
@@ -427,6 +523,23 @@ public:
         OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
     }
 
+    //
+    // Set the callback invoked with the chunks of a streamed result, must be called
+    // before invoke.
+    //
+    void
+    setChunkCallback(std::function<void(T)> chunk)
+    {
+        _requestChunks = true;
+        _chunk = [this, chunk](Ice::InputStream* stream)
+        {
+            stream->startEncapsulation();
+            T v = _read(stream);
+            stream->endEncapsulation();
+            chunk(std::move(v));
+        };
+    }
+
 protected:
 
     std::function<T(Ice::InputStream*)> _read;
@@ -49,6 +49,7 @@ const ::Ice::Byte requestBatchMsg = 1;
 const ::Ice::Byte replyMsg = 2;
 const ::Ice::Byte validateConnectionMsg = 3;
 const ::Ice::Byte closeConnectionMsg = 4;
+const ::Ice::Byte fragmentMsg = 5;
 
 //
 // The request header, batch request header and reply header.
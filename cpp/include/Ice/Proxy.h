@@ -792,7 +792,7 @@ public:
     ::std::shared_ptr<::Ice::ObjectPrx> ice_connectionCached(bool b) const;
 
     /**
-     * Obtains the endpoint selection policy for this proxy (randomly or ordered).
+     * Obtains the endpoint selection policy for this proxy (random, ordered or least latency).
      * @return The endpoint selection policy.
      */
     ::Ice::EndpointSelectionType ice_getEndpointSelection() const;
@@ -901,6 +901,31 @@ public:
      */
     ::std::shared_ptr<::Ice::ObjectPrx> ice_invocationTimeout(::Ice::Int timeout) const;
 
+    /**
+     * Obtains the hedging delay of this proxy.
+     * @return The hedging delay (in milliseconds).
+     */
+    ::Ice::Int ice_getHedgingDelay() const;
+
+    /**
+     * Obtains the maximum number of attempts of a hedged invocation with this proxy.
+     * @return The maximum number of attempts, 1 if hedging is disabled.
+     */
+    ::Ice::Int ice_getHedgingMaxAttempts() const;
+
+    /**
+     * Obtains a proxy that is identical to this proxy, except for the hedging policy.
+     * An idempotent twoway invocation which didn't receive its reply after the delay
+     * is sent again over another connection, up to the given number of attempts
+     * spaced by the delay. The first reply completes the invocation and the other
+     * attempts are canceled.
+     * @param delay The delay before sending another attempt (in milliseconds).
+     * @param maxAttempts The maximum number of attempts, including the first one.
+     * A value of 1 disables hedging.
+     * @return A proxy with the new hedging policy.
+     */
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_hedging(::Ice::Int delay, ::Ice::Int maxAttempts) const;
+
     /**
      * Obtains a proxy that is identical to this proxy, but uses twoway invocations.
      * @return A proxy that uses twoway invocations.
@@ -1155,6 +1180,16 @@ protected:
         return [outAsync]() { outAsync->cancel(); };
     }
 
+    template<typename R, typename C, typename Re, typename E, typename S, typename Obj, typename Fn, typename... Args>
+    ::std::function<void()> _makeLamdaStreamOutgoing(C c, Re r, E e, S s, Obj obj, Fn fn, Args&&... args)
+    {
+        auto outAsync = ::std::make_shared<::IceInternal::LambdaOutgoing<R>>(shared_from_this(),
+                                                                             std::move(r), std::move(e), std::move(s));
+        outAsync->setChunkCallback(std::move(c));
+        (obj->*fn)(outAsync, std::forward<Args>(args)...);
+        return [outAsync]() { outAsync->cancel(); };
+    }
+
     virtual ::std::shared_ptr<ObjectPrx> _newInstance() const;
     ObjectPrx() = default;
     friend ::std::shared_ptr<ObjectPrx> IceInternal::createProxy<ObjectPrx>();
@@ -1327,6 +1362,17 @@ public:
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_invocationTimeout(timeout));
     }
 
+    /**
+     * Obtains a proxy that is identical to this proxy, except for the hedging policy.
+     * @param delay The delay before sending another attempt (in milliseconds).
+     * @param maxAttempts The maximum number of attempts, including the first one.
+     * @return A proxy with the new hedging policy.
+     */
+    ::std::shared_ptr<Prx> ice_hedging(int delay, int maxAttempts) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_hedging(delay, maxAttempts));
+    }
+
     /**
      * Obtains a proxy that is identical to this proxy, but uses twoway invocations.
      * @return A proxy that uses twoway invocations.
@@ -2465,7 +2511,7 @@ public:
     ::Ice::ObjectPrx ice_connectionCached(bool b) const;
 
     /**
-     * Obtains the endpoint selection policy for this proxy (randomly or ordered).
+     * Obtains the endpoint selection policy for this proxy (random, ordered or least latency).
      * @return The endpoint selection policy.
      */
     ::Ice::EndpointSelectionType ice_getEndpointSelection() const;
@@ -2574,6 +2620,31 @@ public:
      */
     ::Ice::ObjectPrx ice_invocationTimeout(::Ice::Int timeout) const;
 
+    /**
+     * Obtains the hedging delay of this proxy.
+     * @return The hedging delay (in milliseconds).
+     */
+    ::Ice::Int ice_getHedgingDelay() const;
+
+    /**
+     * Obtains the maximum number of attempts of a hedged invocation with this proxy.
+     * @return The maximum number of attempts, 1 if hedging is disabled.
+     */
+    ::Ice::Int ice_getHedgingMaxAttempts() const;
+
+    /**
+     * Obtains a proxy that is identical to this proxy, except for the hedging policy.
+     * An idempotent twoway invocation which didn't receive its reply after the delay
+     * is sent again over another connection, up to the given number of attempts
+     * spaced by the delay. The first reply completes the invocation and the other
+     * attempts are canceled.
+     * @param delay The delay before sending another attempt (in milliseconds).
+     * @param maxAttempts The maximum number of attempts, including the first one.
+     * A value of 1 disables hedging.
+     * @return A proxy with the new hedging policy.
+     */
+    ::Ice::ObjectPrx ice_hedging(::Ice::Int delay, ::Ice::Int maxAttempts) const;
+
     /**
      * Obtains a proxy that is identical to this proxy, but uses twoway invocations.
      * @return A proxy that uses twoway invocations.
@@ -3022,6 +3093,17 @@ public:
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_invocationTimeout(timeout).get());
     }
 
+    /**
+     * Obtains a proxy that is identical to this proxy, except for the hedging policy.
+     * @param delay The delay before sending another attempt (in milliseconds).
+     * @param maxAttempts The maximum number of attempts, including the first one.
+     * @return A proxy with the new hedging policy.
+     */
+    IceInternal::ProxyHandle<Prx> ice_hedging(int delay, int maxAttempts) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_hedging(delay, maxAttempts).get());
+    }
+
     /**
      * Obtains a proxy that is identical to this proxy, but uses twoway invocations.
      * @return A proxy that uses twoway invocations.
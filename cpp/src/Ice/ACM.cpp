@@ -290,7 +290,7 @@ FactoryACMMonitor::handleException()
 }
 
 IceInternal::ConnectionACMMonitor::ConnectionACMMonitor(const FactoryACMMonitorPtr& parent,
-                                                        const IceUtil::TimerPtr& timer,
+                                                        const TimerWheelPtr& timer,
                                                         const ACMConfig& config) :
     _parent(parent), _timer(timer), _config(config)
 {
@@ -0,0 +1,99 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_ATOMIC_PTR_H
+#define ICE_ATOMIC_PTR_H
+
+#include <IceUtil/Atomic.h>
+
+#if !defined(ICE_CPP11_COMPILER_HAS_ATOMIC) && !defined(ICE_HAS_GCC_BUILTINS) && !defined(_WIN32)
+#   include <IceUtil/Mutex.h>
+#endif
+
+namespace IceInternal
+{
+
+//
+// A pointer which can be read by a thread while another thread updates it. The
+// load has acquire semantics and the store has release semantics: a thread which
+// loads a pointer stored by another thread also sees the writes done by that
+// thread before the store, such as the initialization of the pointed-to object.
+//
+template<typename T>
+class AtomicPtr : public IceUtil::noncopyable
+{
+public:
+
+    AtomicPtr(T* p = 0) : _p(p)
+    {
+    }
+
+#if defined(ICE_CPP11_COMPILER_HAS_ATOMIC)
+
+    T* load() const
+    {
+        return _p.load(std::memory_order_acquire);
+    }
+
+    void store(T* p)
+    {
+        _p.store(p, std::memory_order_release);
+    }
+
+private:
+
+    std::atomic<T*> _p;
+
+#elif defined(ICE_HAS_GCC_BUILTINS) || defined(_WIN32)
+
+    T* load() const
+    {
+        T* p = _p;
+#   if defined(_WIN32)
+        MemoryBarrier();
+#   else
+        __sync_synchronize();
+#   endif
+        return p;
+    }
+
+    void store(T* p)
+    {
+#   if defined(_WIN32)
+        MemoryBarrier();
+#   else
+        __sync_synchronize();
+#   endif
+        _p = p;
+    }
+
+private:
+
+    T* volatile _p;
+
+#else
+
+    T* load() const
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _p;
+    }
+
+    void store(T* p)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        _p = p;
+    }
+
+private:
+
+    T* _p;
+    IceUtil::Mutex _mutex;
+
+#endif
+};
+
+}
+
+#endif
@@ -4,11 +4,264 @@
 
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
+#include <IceUtil/Atomic.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
 
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+namespace
+{
+
+//
+// Buffers with a capacity between the smallest and largest size class are allocated
+// with the capacity rounded up to a power of two. When released, they are kept in a
+// per-thread pool for reuse by the next allocation of the same size class, up to
+// the pool size of the buffer container. Other buffers are allocated and released
+// with malloc and free.
+//
+const size_t minSizeClassShift = 8; // 256 bytes
+const size_t maxSizeClassShift = 16; // 64KB
+const size_t sizeClasses = maxSizeClassShift - minSizeClassShift + 1;
+
+const size_t defaultPoolSize = 1024 * 1024; // 1MB per thread by default.
+
+struct FreeBuffer
+{
+    FreeBuffer* next;
+};
+
+class BufferPool
+{
+public:
+
+    BufferPool() : _size(0)
+    {
+        for(size_t i = 0; i < sizeClasses; ++i)
+        {
+            _buffers[i] = 0;
+        }
+    }
+
+    ~BufferPool()
+    {
+        for(size_t i = 0; i < sizeClasses; ++i)
+        {
+            while(_buffers[i])
+            {
+                FreeBuffer* p = _buffers[i];
+                _buffers[i] = p->next;
+                ::free(p);
+            }
+        }
+    }
+
+    Byte* get(size_t sizeClass)
+    {
+        FreeBuffer* p = _buffers[sizeClass];
+        if(p)
+        {
+            _buffers[sizeClass] = p->next;
+            _size -= static_cast<size_t>(1) << (sizeClass + minSizeClassShift);
+        }
+        return reinterpret_cast<Byte*>(p);
+    }
+
+    bool put(Byte* buf, size_t sizeClass, size_t poolSize)
+    {
+        size_t sz = static_cast<size_t>(1) << (sizeClass + minSizeClassShift);
+        if(_size + sz > poolSize)
+        {
+            return false;
+        }
+        FreeBuffer* p = reinterpret_cast<FreeBuffer*>(buf);
+        p->next = _buffers[sizeClass];
+        _buffers[sizeClass] = p;
+        _size += sz;
+        return true;
+    }
+
+private:
+
+    FreeBuffer* _buffers[sizeClasses];
+    size_t _size;
+};
+
+#ifdef _WIN32
+DWORD poolKey;
+#else
+pthread_key_t poolKey;
+#endif
+bool poolKeyCreated = false;
+
+#ifndef _WIN32
+//
+// The key is referenced by the Init object and by the pool of each thread. The
+// pools of the threads still running when the Init object is destroyed are freed
+// by the key destructor when the threads exit, the key is deleted with the last
+// pool.
+//
+IceUtilInternal::Atomic poolKeyRefs(0);
+
+void
+releasePoolKey()
+{
+    if(--poolKeyRefs == 0)
+    {
+        pthread_key_delete(poolKey);
+    }
+}
+#endif
+
+extern "C"
+#ifdef _WIN32
+void WINAPI
+#else
+void
+#endif
+iceBufferPoolThreadDestructor(void* v)
+{
+    delete static_cast<BufferPool*>(v);
+#ifndef _WIN32
+    releasePoolKey();
+#endif
+}
+
+class Init
+{
+public:
+
+    Init()
+    {
+#ifdef _WIN32
+        poolKey = FlsAlloc(&iceBufferPoolThreadDestructor);
+        poolKeyCreated = poolKey != FLS_OUT_OF_INDEXES;
+#else
+        poolKeyCreated = pthread_key_create(&poolKey, &iceBufferPoolThreadDestructor) == 0;
+        if(poolKeyCreated)
+        {
+            poolKeyRefs.exchange(1);
+        }
+#endif
+    }
+
+    ~Init()
+    {
+        if(poolKeyCreated)
+        {
+            poolKeyCreated = false;
+#ifdef _WIN32
+            FlsFree(poolKey); // Calls the destructor for the pools of all the threads.
+#else
+            BufferPool* pool = static_cast<BufferPool*>(pthread_getspecific(poolKey));
+            if(pool)
+            {
+                pthread_setspecific(poolKey, 0);
+                iceBufferPoolThreadDestructor(pool);
+            }
+            releasePoolKey();
+#endif
+        }
+    }
+};
+
+Init init;
+
+BufferPool*
+getBufferPool()
+{
+    if(!poolKeyCreated)
+    {
+        return 0;
+    }
+
+#ifdef _WIN32
+    BufferPool* pool = static_cast<BufferPool*>(FlsGetValue(poolKey));
+#else
+    BufferPool* pool = static_cast<BufferPool*>(pthread_getspecific(poolKey));
+#endif
+    if(!pool)
+    {
+        pool = new BufferPool();
+#ifdef _WIN32
+        if(!FlsSetValue(poolKey, pool))
+        {
+            delete pool;
+            return 0;
+        }
+#else
+        ++poolKeyRefs;
+        if(pthread_setspecific(poolKey, pool) != 0)
+        {
+            iceBufferPoolThreadDestructor(pool);
+            return 0;
+        }
+#endif
+    }
+    return pool;
+}
+
+//
+// Return the size class of the given capacity or sizeClasses if the capacity
+// isn't pooled.
+//
+inline size_t
+getSizeClass(size_t capacity)
+{
+    size_t sizeClass = 0;
+    while(sizeClass < sizeClasses && (static_cast<size_t>(1) << (sizeClass + minSizeClassShift)) < capacity)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+inline bool
+isPooled(size_t capacity)
+{
+    size_t sizeClass = getSizeClass(capacity);
+    return sizeClass < sizeClasses && (static_cast<size_t>(1) << (sizeClass + minSizeClassShift)) == capacity;
+}
+
+Byte*
+allocateBuffer(size_t capacity, size_t poolSize)
+{
+    size_t sizeClass = getSizeClass(capacity);
+    if(sizeClass < sizeClasses && poolSize > 0)
+    {
+        BufferPool* pool = getBufferPool();
+        if(pool)
+        {
+            Byte* p = pool->get(sizeClass);
+            if(p)
+            {
+                return p;
+            }
+        }
+    }
+    return reinterpret_cast<Byte*>(::malloc(capacity));
+}
+
+void
+releaseBuffer(Byte* buf, size_t capacity, size_t poolSize)
+{
+    if(poolSize > 0 && isPooled(capacity))
+    {
+        BufferPool* pool = getBufferPool();
+        if(pool && pool->put(buf, getSizeClass(capacity), poolSize))
+        {
+            return;
+        }
+    }
+    ::free(buf);
+}
+
+}
+
 void
 IceInternal::Buffer::swapBuffer(Buffer& other)
 {
@@ -21,7 +274,8 @@ IceInternal::Buffer::Container::Container() :
     _size(0),
     _capacity(0),
     _shrinkCounter(0),
-    _owned(true)
+    _owned(true),
+    _poolSize(defaultPoolSize)
 {
 }
 
@@ -30,12 +284,14 @@ IceInternal::Buffer::Container::Container(const_iterator beg, const_iterator end
     _size(static_cast<size_t>(end - beg)),
     _capacity(static_cast<size_t>(end - beg)),
     _shrinkCounter(0),
-    _owned(false)
+    _owned(false),
+    _poolSize(defaultPoolSize)
 {
 }
 
 IceInternal::Buffer::Container::Container(const vector<value_type>& v) :
-    _shrinkCounter(0)
+    _shrinkCounter(0),
+    _poolSize(defaultPoolSize)
 {
     if(v.empty())
     {
@@ -53,7 +309,8 @@ IceInternal::Buffer::Container::Container(const vector<value_type>& v) :
     }
 }
 
-IceInternal::Buffer::Container::Container(Container& other, bool adopt)
+IceInternal::Buffer::Container::Container(Container& other, bool adopt) :
+    _poolSize(other._poolSize)
 {
     if(adopt)
     {
@@ -83,7 +340,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        releaseBuffer(_buf, _capacity, _poolSize);
     }
 }
 
@@ -102,7 +359,7 @@ IceInternal::Buffer::Container::clear()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        releaseBuffer(_buf, _capacity, _poolSize);
     }
 
     _buf = 0;
@@ -130,17 +387,36 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
 
+    if(getSizeClass(_capacity) < sizeClasses)
+    {
+        //
+        // Round up the capacity to its size class to allocate the buffer from the pool.
+        //
+        _capacity = static_cast<size_type>(1) << (getSizeClass(_capacity) + minSizeClassShift);
+        if(_capacity == c && _owned)
+        {
+            return; // Shrinking within the same size class.
+        }
+    }
+
     pointer p;
-    if(_owned)
+    if(_owned && !isPooled(c) && !isPooled(_capacity))
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = allocateBuffer(_capacity, _poolSize);
         if(p)
         {
-            ::memcpy(p, _buf, _size);
+            if(_buf)
+            {
+                ::memcpy(p, _buf, std::min(_size, _capacity));
+                if(_owned)
+                {
+                    releaseBuffer(_buf, c, _poolSize);
+                }
+            }
             _owned = true;
         }
     }
@@ -9,6 +9,7 @@
 #include <Ice/Instance.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/OutgoingAsync.h>
+#include <Ice/IncomingAsync.h>
 
 #include <Ice/TraceUtil.h>
 
@@ -19,6 +20,31 @@ using namespace IceInternal;
 namespace
 {
 
+#ifndef ICE_CPP11_MAPPING
+class DispatchChunkReady : public ChunkReadyCallback
+{
+public:
+
+    DispatchChunkReady(const InstancePtr& instance, const ThreadPoolPtr& threadPool,
+                       const ChunkReadyCallbackPtr& ready) :
+        _instance(instance), _threadPool(threadPool), _ready(ready)
+    {
+    }
+
+    virtual void
+    ready()
+    {
+        dispatchChunkReady(_instance, _threadPool, _ready);
+    }
+
+private:
+
+    const InstancePtr _instance;
+    const ThreadPoolPtr _threadPool;
+    const ChunkReadyCallbackPtr _ready;
+};
+#endif
+
 class InvokeAllAsync : public DispatchWorkItem
 {
 public:
@@ -250,6 +276,54 @@ CollocatedRequestHandler::sendResponse(Int requestId, OutputStream* os, Byte, bo
     _adapter->decDirectCount();
 }
 
+bool
+CollocatedRequestHandler::sendResponseChunk(Int requestId, OutputStream* os, Byte,
+                                            const ICE_DELEGATE(ChunkReadyCallback)& ready)
+{
+    Lock sync(*this);
+    assert(_response);
+
+    if(_traceLevels->protocol >= 1)
+    {
+        fillInValue(os, 10, static_cast<Int>(os->b.size()));
+    }
+
+    InputStream is(os->instance(), os->getEncoding(), *os, true); // Adopting the OutputStream's buffer.
+    is.pos(sizeof(replyHdr) + 4);
+
+    if(_traceLevels->protocol >= 1)
+    {
+        traceRecv(is, _logger, _traceLevels);
+    }
+
+    //
+    // The chunks are queued until they're consumed, the producer is asked to wait once the
+    // chunks window is full. It's resumed from the object adapter thread pool.
+    //
+    map<int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
+    if(q != _asyncRequests.end())
+    {
+        OutgoingAsync* outAsync = dynamic_cast<OutgoingAsync*>(q->second.get());
+        if(outAsync)
+        {
+            is.pos(sizeof(replyHdr) + 5); // Skip the reply status.
+            ICE_DELEGATE(ChunkReadyCallback) dispatchReady;
+            if(ready)
+            {
+#ifdef ICE_CPP11_MAPPING
+                InstancePtr instance = _reference->getInstance();
+                ThreadPoolPtr threadPool = _adapter->getThreadPool();
+                dispatchReady = [instance, threadPool, ready]() { dispatchChunkReady(instance, threadPool, ready); };
+#else
+                dispatchReady = new DispatchChunkReady(_reference->getInstance(), _adapter->getThreadPool(), ready);
+#endif
+            }
+            return outAsync->chunk(is, ConnectionIPtr(), dispatchReady);
+        }
+    }
+    return true;
+}
+
 void
 CollocatedRequestHandler::sendNoResponse()
 {
@@ -48,6 +48,8 @@ public:
     virtual void sendNoResponse();
     virtual bool systemException(Ice::Int, const Ice::SystemException&, bool);
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
+    virtual bool sendResponseChunk(Ice::Int, Ice::OutputStream*, Ice::Byte,
+                                   const ICE_DELEGATE(Ice::ChunkReadyCallback)&);
 
     const ReferencePtr& getReference() const { return _reference; } // Inlined for performances.
 
@@ -0,0 +1,441 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/CompressionCodecI.h>
+#include <Ice/Instance.h>
+#include <Ice/Initialize.h>
+#include <Ice/DynamicLibrary.h>
+#include <Ice/LocalException.h>
+#include <Ice/UniquePtr.h>
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Maximum number of operations for which the compression ratio is sampled, the
+// messages for other operations share the connection statistics.
+//
+const size_t maxCompressionStats = 64;
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class Bzip2CompressionCodec : public CompressionCodec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return 0;
+    }
+
+    virtual string
+    name() const
+    {
+        return "bzip2";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(static_cast<double>(sz) * 1.01 + 600);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int level) const
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(dstLen);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(dst), &compressedLen,
+                                               reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                               static_cast<unsigned int>(srcLen), level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+        return compressedLen;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(dstLen);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(dst), &uncompressedLen,
+                                                 reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                                 static_cast<unsigned int>(srcLen), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffDecompress failed" +
+                                       getBZ2Error(bzError));
+        }
+    }
+};
+#endif
+
+#if !defined(ICE_OS_UWP)
+
+//
+// The zstd and lz4 libraries are loaded at runtime if they are installed, Ice doesn't
+// depend on them at build time. We only use the stable part of their C API.
+//
+
+#  if defined(_WIN32)
+const char* const zstdLibrary = "zstd.dll";
+const char* const lz4Library = "liblz4.dll";
+#  elif defined(__APPLE__)
+const char* const zstdLibrary = "libzstd.1.dylib";
+const char* const lz4Library = "liblz4.1.dylib";
+#  else
+const char* const zstdLibrary = "libzstd.so.1";
+const char* const lz4Library = "liblz4.so.1";
+#  endif
+
+extern "C"
+{
+
+typedef size_t (*ZSTD_compressFn)(void*, size_t, const void*, size_t, int);
+typedef size_t (*ZSTD_decompressFn)(void*, size_t, const void*, size_t);
+typedef size_t (*ZSTD_compressBoundFn)(size_t);
+typedef unsigned (*ZSTD_isErrorFn)(size_t);
+typedef const char* (*ZSTD_getErrorNameFn)(size_t);
+
+typedef int (*LZ4_compress_defaultFn)(const char*, char*, int, int);
+typedef int (*LZ4_decompress_safeFn)(const char*, char*, int, int);
+typedef int (*LZ4_compressBoundFn)(int);
+
+}
+
+template<typename T> bool
+getSymbol(const DynamicLibraryPtr& library, const string& name, T& fn)
+{
+    fn = reinterpret_cast<T>(library->getSymbol(name));
+    return fn != 0;
+}
+
+class ZstdCompressionCodec : public CompressionCodec
+{
+public:
+
+    static CompressionCodecPtr
+    create()
+    {
+        DynamicLibraryPtr library = new DynamicLibrary();
+        if(!library->load(zstdLibrary))
+        {
+            return ICE_NULLPTR;
+        }
+
+        UniquePtr<ZstdCompressionCodec> codec(new ZstdCompressionCodec(library));
+        if(!getSymbol(library, "ZSTD_compress", codec->_compress) ||
+           !getSymbol(library, "ZSTD_decompress", codec->_decompress) ||
+           !getSymbol(library, "ZSTD_compressBound", codec->_compressBound) ||
+           !getSymbol(library, "ZSTD_isError", codec->_isError) ||
+           !getSymbol(library, "ZSTD_getErrorName", codec->_getErrorName))
+        {
+            return ICE_NULLPTR;
+        }
+        return CompressionCodecPtr(codec.release());
+    }
+
+    virtual Byte
+    id() const
+    {
+        return 1;
+    }
+
+    virtual string
+    name() const
+    {
+        return "zstd";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return _compressBound(sz);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int level) const
+    {
+        size_t sz = _compress(dst, dstLen, src, srcLen, level);
+        if(_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_compress failed: ") + _getErrorName(sz));
+        }
+        return sz;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        size_t sz = _decompress(dst, dstLen, src, srcLen);
+        if(_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_decompress failed: ") + _getErrorName(sz));
+        }
+        else if(sz != dstLen)
+        {
+            throw CompressionException(__FILE__, __LINE__, "ZSTD_decompress failed: unexpected uncompressed size");
+        }
+    }
+
+private:
+
+    ZstdCompressionCodec(const DynamicLibraryPtr& library) : _library(library)
+    {
+    }
+
+    const DynamicLibraryPtr _library;
+    ZSTD_compressFn _compress;
+    ZSTD_decompressFn _decompress;
+    ZSTD_compressBoundFn _compressBound;
+    ZSTD_isErrorFn _isError;
+    ZSTD_getErrorNameFn _getErrorName;
+};
+
+//
+// LZ4 favors speed over compression ratio, the compression level is ignored.
+//
+class Lz4CompressionCodec : public CompressionCodec
+{
+public:
+
+    static CompressionCodecPtr
+    create()
+    {
+        DynamicLibraryPtr library = new DynamicLibrary();
+        if(!library->load(lz4Library))
+        {
+            return ICE_NULLPTR;
+        }
+
+        UniquePtr<Lz4CompressionCodec> codec(new Lz4CompressionCodec(library));
+        if(!getSymbol(library, "LZ4_compress_default", codec->_compress) ||
+           !getSymbol(library, "LZ4_decompress_safe", codec->_decompress) ||
+           !getSymbol(library, "LZ4_compressBound", codec->_compressBound))
+        {
+            return ICE_NULLPTR;
+        }
+        return CompressionCodecPtr(codec.release());
+    }
+
+    virtual Byte
+    id() const
+    {
+        return 2;
+    }
+
+    virtual string
+    name() const
+    {
+        return "lz4";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(_compressBound(static_cast<int>(sz)));
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen, int) const
+    {
+        int sz = _compress(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                           static_cast<int>(srcLen), static_cast<int>(dstLen));
+        if(sz <= 0)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_compress_default failed");
+        }
+        return static_cast<size_t>(sz);
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dst, size_t dstLen) const
+    {
+        int sz = _decompress(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                             static_cast<int>(srcLen), static_cast<int>(dstLen));
+        if(sz < 0 || static_cast<size_t>(sz) != dstLen)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_decompress_safe failed");
+        }
+    }
+
+private:
+
+    Lz4CompressionCodec(const DynamicLibraryPtr& library) : _library(library)
+    {
+    }
+
+    const DynamicLibraryPtr _library;
+    LZ4_compress_defaultFn _compress;
+    LZ4_decompress_safeFn _decompress;
+    LZ4_compressBoundFn _compressBound;
+};
+
+#endif
+
+}
+
+Ice::CompressionCodec::~CompressionCodec()
+{
+    // Out of line to avoid weak vtable
+}
+
+void
+Ice::registerCompressionCodec(const CommunicatorPtr& communicator, const CompressionCodecPtr& codec)
+{
+    getInstance(communicator)->addCompressionCodec(codec);
+}
+
+CompressionCodecPtr
+IceInternal::createBzip2CompressionCodec()
+{
+#ifdef ICE_HAS_BZIP2
+    return ICE_MAKE_SHARED(Bzip2CompressionCodec);
+#else
+    return ICE_NULLPTR;
+#endif
+}
+
+CompressionCodecPtr
+IceInternal::createZstdCompressionCodec()
+{
+#if !defined(ICE_OS_UWP)
+    return ZstdCompressionCodec::create();
+#else
+    return ICE_NULLPTR;
+#endif
+}
+
+CompressionCodecPtr
+IceInternal::createLz4CompressionCodec()
+{
+#if !defined(ICE_OS_UWP)
+    return Lz4CompressionCodec::create();
+#else
+    return ICE_NULLPTR;
+#endif
+}
+
+IceInternal::CompressionPolicy::CompressionPolicy(int maxRatio, int probeInterval) :
+    _maxRatio(static_cast<double>(maxRatio) / 100),
+    _probeInterval(probeInterval)
+{
+}
+
+bool
+IceInternal::CompressionPolicy::compress(const string& operation)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    Stats& stats = getStats(operation);
+    if(stats.skip > 0)
+    {
+        --stats.skip;
+        return false;
+    }
+    return true;
+}
+
+bool
+IceInternal::CompressionPolicy::sample(const string& operation, size_t uncompressed, size_t compressed)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    Stats& stats = getStats(operation);
+    double ratio = static_cast<double>(compressed) / static_cast<double>(uncompressed);
+    stats.ratio = stats.samples == 0 ? ratio : stats.ratio * 0.75 + ratio * 0.25;
+    ++stats.samples;
+    if(stats.ratio > _maxRatio)
+    {
+        //
+        // Stop compressing until the next probe, the sampling restarts with the probe so
+        // that a single compressible message is enough to resume compression.
+        //
+        stats.skip = _probeInterval;
+        stats.samples = 0;
+    }
+    return compressed < uncompressed;
+}
+
+IceInternal::CompressionPolicy::Stats&
+IceInternal::CompressionPolicy::getStats(const string& operation)
+{
+    map<string, Stats>::iterator p = _stats.find(operation);
+    if(p == _stats.end())
+    {
+        if(_stats.size() >= maxCompressionStats)
+        {
+            return _stats[string()];
+        }
+        p = _stats.insert(make_pair(operation, Stats())).first;
+    }
+    return p->second;
+}
@@ -0,0 +1,90 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_CODEC_I_H
+#define ICE_COMPRESSION_CODEC_I_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/CompressionCodec.h>
+
+#include <map>
+
+#if !defined(ICE_OS_UWP)
+#    ifndef ICE_HAS_BZIP2
+#        define ICE_HAS_BZIP2
+#    endif
+#endif
+
+namespace IceInternal
+{
+
+//
+// The codec id is carried in the compression status byte of the message header: a status of
+// 2 * id + 1 indicates an uncompressed message for which a response compressed with the
+// codec is requested, and 2 * id + 2 a message compressed with the codec. The bzip2 codec
+// has id 0 and therefore maps to the compression status values used by earlier versions.
+//
+// The codecs supported by a peer are advertised with a bit mask in the compression status
+// of the validate connection message, the last two bits of the mask are reserved for message
+// fragmentation and the server busy reply status.
+//
+const Ice::Byte maxCompressionCodecs = 6;
+
+//
+// Create the built-in codecs, a null handle is returned if the codec isn't
+// available on this platform.
+//
+Ice::CompressionCodecPtr createBzip2CompressionCodec();
+Ice::CompressionCodecPtr createZstdCompressionCodec();
+Ice::CompressionCodecPtr createLz4CompressionCodec();
+
+//
+// The adaptive compression policy samples the compression ratio of the messages sent over
+// a connection, per operation for requests, and stops compressing the messages which don't
+// shrink enough. Compression is probed again after a number of uncompressed messages.
+//
+// The policy is thread-safe, messages are compressed without holding the connection lock.
+//
+class CompressionPolicy
+{
+public:
+
+    CompressionPolicy(int, int);
+
+    //
+    // Return false if the message for the given operation shouldn't be compressed. An
+    // empty operation is used for messages other than requests.
+    //
+    bool compress(const std::string&);
+
+    //
+    // Record the uncompressed and compressed sizes of a message. Returns false if the
+    // compressed message isn't worth sending.
+    //
+    bool sample(const std::string&, size_t, size_t);
+
+private:
+
+    struct Stats
+    {
+        Stats() : ratio(0), samples(0), skip(0)
+        {
+        }
+
+        double ratio; // Moving average of the compressed size / uncompressed size ratio.
+        int samples;
+        int skip; // Number of messages to send uncompressed before probing again.
+    };
+
+    Stats& getStats(const std::string&);
+
+    const double _maxRatio;
+    const int _probeInterval;
+    IceUtil::Mutex _mutex;
+    std::map<std::string, Stats> _stats;
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/ConcurrencyLimiter.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(ConcurrencyLimiter* p) { return p; }
+
+ConcurrencyLimiterPtr
+IceInternal::ConcurrencyLimiter::create(const InstancePtr& instance, const string& adapterName)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    const string prefix = adapterName + ".ConcurrencyLimit";
+
+    int limit = properties->getPropertyAsInt(prefix);
+    if(limit <= 0)
+    {
+        return 0;
+    }
+
+    int min = properties->getPropertyAsIntWithDefault(prefix + ".Min", 1);
+    if(min < 1)
+    {
+        Warning out(instance->initializationData().logger);
+        out << prefix << ".Min < 1; Min adjusted to 1";
+        min = 1;
+    }
+    if(min > limit)
+    {
+        Warning out(instance->initializationData().logger);
+        out << prefix << ".Min > " << prefix << "; Min adjusted to " << limit;
+        min = limit;
+    }
+
+    int max = properties->getPropertyAsIntWithDefault(prefix + ".Max", limit * 10);
+    if(max < limit)
+    {
+        Warning out(instance->initializationData().logger);
+        out << prefix << ".Max < " << prefix << "; Max adjusted to " << limit;
+        max = limit;
+    }
+
+    int latency = properties->getPropertyAsIntWithDefault(prefix + ".Latency", 100);
+    if(latency < 1)
+    {
+        Warning out(instance->initializationData().logger);
+        out << prefix << ".Latency < 1; Latency adjusted to 1";
+        latency = 1;
+    }
+
+    return new ConcurrencyLimiter(limit, min, max, IceUtil::Time::milliSeconds(latency));
+}
+
+IceInternal::ConcurrencyLimiter::ConcurrencyLimiter(int limit, int min, int max, const IceUtil::Time& latency) :
+    _min(min),
+    _max(max),
+    _latency(latency),
+    _limit(limit),
+    _inflight(0),
+    _decreaseWindow(0)
+{
+}
+
+bool
+IceInternal::ConcurrencyLimiter::acquire(int count)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_inflight > 0 && _inflight + count > static_cast<int>(_limit))
+    {
+        return false;
+    }
+    _inflight += count;
+    return true;
+}
+
+void
+IceInternal::ConcurrencyLimiter::release(int count, const IceUtil::Time& latency)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    assert(_inflight >= count);
+    bool inUse = 2 * _inflight >= static_cast<int>(_limit);
+    _inflight -= count;
+
+    if(_decreaseWindow > 0)
+    {
+        //
+        // The request might have been admitted before the last decrease.
+        //
+        _decreaseWindow = std::max(_decreaseWindow - count, 0);
+        return;
+    }
+
+    if(latency > _latency)
+    {
+        _limit = std::max(_limit * 0.9, _min);
+        _decreaseWindow = _inflight;
+    }
+    else if(inUse)
+    {
+        _limit = std::min(_limit + count / _limit, _max);
+    }
+}
+
+int
+IceInternal::ConcurrencyLimiter::limit() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return static_cast<int>(_limit);
+}
+
+int
+IceInternal::ConcurrencyLimiter::inflight() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return _inflight;
+}
@@ -0,0 +1,63 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CONCURRENCY_LIMITER_H
+#define ICE_CONCURRENCY_LIMITER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/ConcurrencyLimiterF.h>
+#include <Ice/InstanceF.h>
+
+namespace IceInternal
+{
+
+//
+// The adaptive concurrency limit of an object adapter, configured with the
+// <adapter>.ConcurrencyLimit properties. It bounds the number of requests received
+// over connections which are queued or dispatched by the adapter, the connections
+// reject the requests over the limit with a reply which the client retries.
+//
+// The limit is adjusted with additive increase and multiplicative decrease based on
+// the dispatch latency of the requests, from their reception until their dispatch
+// returns: the limit grows by one per window of completed requests as long as it's
+// in use and the latency stays under the target latency, and shrinks by 10% once a
+// request exceeds the target latency. The requests admitted with the previous limit
+// don't shrink it again.
+//
+class ConcurrencyLimiter : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    //
+    // Returns null if the concurrency limit of the adapter isn't enabled.
+    //
+    static ConcurrencyLimiterPtr create(const InstancePtr&, const std::string&);
+
+    //
+    // Returns false if the given number of requests must be rejected. The requests
+    // are always admitted if no other requests are in progress.
+    //
+    bool acquire(int);
+    void release(int, const IceUtil::Time&);
+
+    int limit() const;
+    int inflight() const;
+
+private:
+
+    ConcurrencyLimiter(int, int, int, const IceUtil::Time&);
+
+    const double _min;
+    const double _max;
+    const IceUtil::Time _latency;
+    double _limit;
+    int _inflight;
+    int _decreaseWindow;
+};
+
+}
+
+#endif
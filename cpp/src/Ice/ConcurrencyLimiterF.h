@@ -0,0 +1,19 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CONCURRENCY_LIMITER_F_H
+#define ICE_CONCURRENCY_LIMITER_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class ConcurrencyLimiter;
+IceUtil::Shared* upCast(ConcurrencyLimiter*);
+typedef Handle<ConcurrencyLimiter> ConcurrencyLimiterPtr;
+
+}
+
+#endif
@@ -114,6 +114,41 @@ find(const multimap<K,::IceInternal::Handle<V> >& m,
 }
 #endif
 
+//
+// Return the active or holding connection with the fewest outstanding requests, picked
+// randomly among the connections with the same load. Return null if there are fewer
+// than poolSize active or holding connections for the key, to get the caller to
+// establish a new connection.
+//
+template<typename Map> typename Map::mapped_type
+findLeastLoaded(const Map& m, const typename Map::key_type& k, size_t poolSize)
+{
+    typename Map::mapped_type connection;
+    size_t count = 0;
+    size_t load = 0;
+    int ties = 0;
+    pair<typename Map::const_iterator, typename Map::const_iterator> pr = m.equal_range(k);
+    for(typename Map::const_iterator q = pr.first; q != pr.second; ++q)
+    {
+        if(q->second->isActiveOrHolding())
+        {
+            size_t n = q->second->getOutstandingRequestCount();
+            if(!connection || n < load)
+            {
+                connection = q->second;
+                load = n;
+                ties = 1;
+            }
+            else if(n == load && IceUtilInternal::random(++ties) == 0)
+            {
+                connection = q->second;
+            }
+            ++count;
+        }
+    }
+    return count < poolSize ? typename Map::mapped_type() : connection;
+}
+
 class StartAcceptor : public IceUtil::TimerTask
 #ifdef ICE_CPP11_MAPPING
                     , public std::enable_shared_from_this<StartAcceptor>
@@ -419,7 +454,9 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
     _destroyed(false),
-    _pendingConnectCount(0)
+    _pendingConnectCount(0),
+    _connectAttemptDelay(IceUtil::Time::milliSeconds(
+        max(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ConnectAttemptDelay", 0), 0)))
 {
 }
 
@@ -463,15 +500,24 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
     assert(!endpoints.empty());
     for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
     {
+        ConnectionIPtr connection;
+        if(defaultsAndOverrides->defaultConnectionPoolSize > 1)
+        {
+            connection = findLeastLoaded(_connectionsByEndpoint, *p,
+                                         static_cast<size_t>(defaultsAndOverrides->defaultConnectionPoolSize));
+        }
+        else
+        {
 #ifdef ICE_CPP11_MAPPING
-        auto connection = find(_connectionsByEndpoint, *p,
-                               [](const ConnectionIPtr& conn)
-                               {
-                                   return conn->isActiveOrHolding();
-                               });
+            connection = find(_connectionsByEndpoint, *p,
+                              [](const ConnectionIPtr& conn)
+                              {
+                                  return conn->isActiveOrHolding();
+                              });
 #else
-        ConnectionIPtr connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+            connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
 #endif
+        }
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
@@ -501,15 +547,24 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
             continue;
         }
 
+        ConnectionIPtr connection;
+        if(defaultsAndOverrides->defaultConnectionPoolSize > 1)
+        {
+            connection = findLeastLoaded(_connections, p->connector,
+                                         static_cast<size_t>(defaultsAndOverrides->defaultConnectionPoolSize));
+        }
+        else
+        {
 #ifdef ICE_CPP11_MAPPING
-        auto connection = find(_connections, p->connector,
-                               [](const ConnectionIPtr& conn)
-                               {
-                                   return conn->isActiveOrHolding();
-                               });
+            connection = find(_connections, p->connector,
+                              [](const ConnectionIPtr& conn)
+                              {
+                                  return conn->isActiveOrHolding();
+                              });
 #else
-        ConnectionIPtr connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+            connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
 #endif
+        }
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
@@ -934,7 +989,9 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _connecting(0),
+    _done(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -945,21 +1002,51 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
-    if(_observer)
+    vector<Attempt> attempts;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        vector<Attempt>::iterator p = _attempts.begin();
+        while(p != _attempts.end() && p->connection != connection)
+        {
+            ++p;
+        }
+        if(p == _attempts.end())
+        {
+            return; // The attempt was closed, another connection was established first.
+        }
+        attempts.push_back(*p);
+        _attempts.erase(p);
+        attempts.insert(attempts.end(), _attempts.begin(), _attempts.end());
+        _attempts.clear();
+        _done = true;
+    }
+
+    if(_factory->_connectAttemptDelay > IceUtil::Time())
+    {
+        try
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+    }
+
+    if(attempts.front().observer)
     {
-        _observer->detach();
+        attempts.front().observer->detach();
     }
+    closeAttempts(vector<Attempt>(attempts.begin() + 1, attempts.end()));
 
     connection->activate();
-    _factory->finishGetConnection(_connectors, *_iter, connection, ICE_SHARED_FROM_THIS);
+    _factory->finishGetConnection(_connectors, attempts.front().connector, connection, ICE_SHARED_FROM_THIS);
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                const LocalException& ex)
 {
-    assert(_iter != _connectors.end());
-    if(connectionStartFailedImpl(ex))
+    if(connectionStartFailedImpl(connection, 0, ex))
     {
         nextConnector();
     }
@@ -1090,47 +1177,105 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
     while(true)
     {
+        vector<ConnectorInfo>::const_iterator p;
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            if(_done || _iter == _connectors.end())
+            {
+                return;
+            }
+            p = _iter++;
+            ++_connecting; // The attempt is pending until it's added to _attempts or fails.
+        }
+
+        ObserverPtr observer;
+        Ice::ConnectionIPtr connection;
         try
         {
             const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
             if(obsv)
             {
-                _observer = obsv->getConnectionEstablishmentObserver(_iter->endpoint, _iter->connector->toString());
-                if(_observer)
+                observer = obsv->getConnectionEstablishmentObserver(p->endpoint, p->connector->toString());
+                if(observer)
                 {
-                    _observer->attach();
+                    observer->attach();
                 }
             }
 
-            assert(_iter != _connectors.end());
-
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString();
+                out << "trying to establish " << p->endpoint->protocol() << " connection to "
+                    << p->connector->toString();
             }
-            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter);
-            connection->start(ICE_SHARED_FROM_THIS);
+            connection = _factory->createConnection(p->connector->connect(), *p);
         }
         catch(const Ice::LocalException& ex)
         {
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "failed to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString() << "\n" << ex;
+                out << "failed to establish " << p->endpoint->protocol() << " connection to "
+                    << p->connector->toString() << "\n" << ex;
             }
 
-            if(connectionStartFailedImpl(ex))
+            if(connectionStartFailedImpl(0, observer, ex))
             {
                 continue; // More connectors to try, continue.
             }
+            break;
         }
+
+        bool done;
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            --_connecting;
+            done = _done;
+            if(!_done)
+            {
+                _attempts.push_back(Attempt(connection, *p, observer));
+
+                //
+                // Try the next connector if this connection isn't established after
+                // the connect attempt delay.
+                //
+                if(_iter != _connectors.end() && _factory->_connectAttemptDelay > IceUtil::Time())
+                {
+                    try
+                    {
+                        _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+                        _instance->timer()->schedule(ICE_SHARED_FROM_THIS, _factory->_connectAttemptDelay);
+                    }
+                    catch(const IceUtil::Exception&)
+                    {
+                        // The communicator is destroyed, the connection establishment fails.
+                    }
+                }
+            }
+        }
+
+        if(done)
+        {
+            //
+            // Another connection was established in the meantime.
+            //
+            vector<Attempt> attempts;
+            attempts.push_back(Attempt(connection, *p, observer));
+            closeAttempts(attempts);
+            return;
+        }
+
+        connection->start(ICE_SHARED_FROM_THIS);
         break;
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    nextConnector();
+}
+
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::setConnection(const Ice::ConnectionIPtr& connection,
                                                                        bool compress)
@@ -1187,28 +1332,94 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::operator<(const Connect
 }
 
 bool
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const Ice::LocalException& ex)
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const Ice::ConnectionIPtr& connection,
+                                                                                   const ObserverPtr& attemptObserver,
+                                                                                   const Ice::LocalException& ex)
 {
-    if(_observer)
+    ObserverPtr observer = attemptObserver;
+    bool more;
+    bool pending;
+    bool failed = false;
+    vector<Attempt> attempts;
     {
-        _observer->failed(ex.ice_id());
-        _observer->detach();
+        IceUtil::Mutex::Lock sync(*this);
+        if(connection)
+        {
+            vector<Attempt>::iterator p = _attempts.begin();
+            while(p != _attempts.end() && p->connection != connection)
+            {
+                ++p;
+            }
+            if(p == _attempts.end())
+            {
+                return false; // The attempt was closed, another connection was established first.
+            }
+            observer = p->observer;
+            _attempts.erase(p);
+        }
+        else
+        {
+            --_connecting; // The attempt failed before its connection was created.
+        }
+
+        if(_done)
+        {
+            if(observer)
+            {
+                observer->detach();
+            }
+            return false;
+        }
+
+        more = _iter != _connectors.end();
+        pending = !_attempts.empty() || _connecting > 0;
+
+        //
+        // The connection establishment fails once all the connectors failed, the
+        // other attempts are closed if the communicator is destroyed.
+        //
+        if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex) || (!more && !pending))
+        {
+            failed = true;
+            _done = true;
+            _attempts.swap(attempts);
+        }
     }
 
-    _factory->handleConnectionException(ex, _hasMore || _iter != _connectors.end() - 1);
-    if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
+    if(observer)
     {
-        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        observer->failed(ex.ice_id());
+        observer->detach();
     }
-    else if(++_iter != _connectors.end()) // Try the next connector.
+
+    _factory->handleConnectionException(ex, _hasMore || more || pending);
+    if(failed)
     {
-        return true;
+        closeAttempts(attempts);
+        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        return false;
     }
-    else
+    return more; // Try the next connector right away.
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::closeAttempts(const vector<Attempt>& attempts)
+{
+    for(vector<Attempt>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
     {
-        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "closing " << p->connector.endpoint->protocol() << " connection attempt to "
+                << p->connector.connector->toString();
+        }
+
+        if(p->observer)
+        {
+            p->observer->detach();
+        }
+        p->connection->close(ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
     }
-    return false;
 }
 
 void
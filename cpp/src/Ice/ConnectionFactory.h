@@ -7,6 +7,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -81,8 +82,16 @@ private:
         EndpointIPtr endpoint;
     };
 
+    //
+    // The connectors are tried in order. If the connect attempt delay is set, the next
+    // connector is also tried if the connection to the previous connector isn't
+    // established after the delay. The first established connection is used and the
+    // other attempts are closed.
+    //
     class ConnectCallback : public Ice::ConnectionI::StartCallback,
-                            public IceInternal::EndpointI_connectors
+                            public IceInternal::EndpointI_connectors,
+                            public IceUtil::TimerTask,
+                            private IceUtil::Mutex
 #ifdef ICE_CPP11_MAPPING
                           , public std::enable_shared_from_this<ConnectCallback>
 #endif
@@ -105,6 +114,8 @@ private:
         void getConnection();
         void nextConnector();
 
+        virtual void runTimerTask();
+
         void setConnection(const Ice::ConnectionIPtr&, bool);
         void setException(const Ice::LocalException&);
 
@@ -116,7 +127,22 @@ private:
 
     private:
 
-        bool connectionStartFailedImpl(const Ice::LocalException&);
+        struct Attempt
+        {
+            Attempt(const Ice::ConnectionIPtr& c, const ConnectorInfo& ci,
+                    const Ice::Instrumentation::ObserverPtr& o) :
+                connection(c), connector(ci), observer(o)
+            {
+            }
+
+            Ice::ConnectionIPtr connection;
+            ConnectorInfo connector;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+
+        bool connectionStartFailedImpl(const Ice::ConnectionIPtr&, const Ice::Instrumentation::ObserverPtr&,
+                                       const Ice::LocalException&);
+        void closeAttempts(const std::vector<Attempt>&);
 
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
@@ -124,10 +150,12 @@ private:
         const bool _hasMore;
         const CreateConnectionCallbackPtr _callback;
         const Ice::EndpointSelectionType _selType;
-        Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
-        std::vector<ConnectorInfo>::const_iterator _iter;
+        std::vector<ConnectorInfo>::const_iterator _iter; // The next connector to try.
+        std::vector<Attempt> _attempts; // The connections being established.
+        int _connecting; // The number of connectors taken from _iter and not yet in _attempts.
+        bool _done; // Set once the connection is established or all the attempts failed.
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
@@ -164,6 +192,7 @@ private:
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
 #endif
     int _pendingConnectCount;
+    const IceUtil::Time _connectAttemptDelay;
 };
 
 class IncomingConnectionFactory : public EventHandler,
@@ -13,19 +13,19 @@
 #include <Ice/Transceiver.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/ACM.h>
-#include <Ice/ObjectAdapterI.h> // For getThreadPool() and getServantManager().
+#include <Ice/ObjectAdapterI.h> // For getThreadPool(), getServantManager(), getDispatchLanes() and getConcurrencyLimiter().
+#include <Ice/DispatchLanes.h>
+#include <Ice/ConcurrencyLimiter.h>
 #include <Ice/EndpointI.h>
 #include <Ice/OutgoingAsync.h>
 #include <Ice/Incoming.h>
 #include <Ice/LocalException.h>
+#include <Ice/ReplyStatus.h>
 #include <Ice/RequestHandler.h> // For RetryException
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
-
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
+#include <Ice/InstrumentationI.h>
 
 using namespace std;
 using namespace Ice;
@@ -41,6 +41,57 @@ namespace
 
 const ::std::string flushBatchRequests_name = "flushBatchRequests";
 
+//
+// The bit of the compression status of the validate connection message which indicates that
+// the sender reassembles fragmented messages.
+//
+const Byte fragmentationSupported = 0x80;
+
+//
+// The bit of the compression status of the validate connection message which indicates that
+// the sender understands the server busy reply status.
+//
+const Byte serverBusySupported = 0x40;
+
+//
+// A fragment message is made of the message header, the fragment ID, the fragment flags and
+// the fragment data. The first fragment data starts with the header of the fragmented message.
+//
+const Int fragmentHeaderSize = headerSize + static_cast<Int>(sizeof(Int)) + 1;
+const Byte lastFragment = 1;
+
+//
+// The maximum number of messages sent or reassembled in fragments at once over a connection. The
+// messages sent in fragments at once also don't exceed Ice.MessageSizeMax in total, the receiver
+// closes the connection if these limits are exceeded. Other messages are sent whole.
+//
+const size_t maxFragmentedMessages = 8;
+
+//
+// Return the operation name of a request message, or an empty string for other messages.
+//
+string
+getRequestOperation(Instance* instance, OutputStream& os)
+{
+    if(os.b[8] != requestMsg)
+    {
+        return string();
+    }
+
+    InputStream is(instance, currentProtocolEncoding, os); // Doesn't adopt the buffer.
+    is.i = is.b.begin() + headerSize + sizeof(Int);
+    string s;
+    is.read(s, false); // Identity name
+    is.read(s, false); // Identity category
+    Int sz = is.readSize(); // Facet
+    while(sz-- > 0)
+    {
+        is.read(s, false);
+    }
+    is.read(s, false);
+    return s;
+}
+
 class TimeoutCallback : public IceUtil::TimerTask
 {
 public:
@@ -68,7 +119,8 @@ public:
                  const vector<ConnectionI::OutgoingMessage>& sentCBs, Byte compress, Int requestId,
                  Int invokeNum, const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
                  const OutgoingAsyncBasePtr& outAsync, const ICE_DELEGATE(HeartbeatCallback)& heartbeatCallback,
-                 InputStream& stream) :
+                 InputStream& stream, const IceUtil::Time& received,
+                 const ConcurrencyLimiterPtr& concurrencyLimiter) :
         DispatchWorkItem(connection),
         _connection(connection),
         _startCB(startCB),
@@ -80,7 +132,9 @@ public:
         _adapter(adapter),
         _outAsync(outAsync),
         _heartbeatCallback(heartbeatCallback),
-        _stream(stream.instance(), currentProtocolEncoding)
+        _stream(stream.instance(), currentProtocolEncoding),
+        _received(received),
+        _concurrencyLimiter(concurrencyLimiter)
     {
         _stream.swap(stream);
     }
@@ -89,7 +143,7 @@ public:
     run()
     {
         _connection->dispatch(_startCB, _sentCBs, _compress, _requestId, _invokeNum, _servantManager, _adapter,
-                              _outAsync, _heartbeatCallback, _stream);
+                              _outAsync, _heartbeatCallback, _stream, _received, _concurrencyLimiter);
     }
 
 private:
@@ -105,6 +159,8 @@ private:
     const OutgoingAsyncBasePtr _outAsync;
     const ICE_DELEGATE(HeartbeatCallback) _heartbeatCallback;
     InputStream _stream;
+    const IceUtil::Time _received;
+    const ConcurrencyLimiterPtr _concurrencyLimiter;
 };
 
 class FinishCall : public DispatchWorkItem
@@ -278,6 +334,58 @@ Ice::ConnectionI::Observer::finishWrite(const Buffer& buf)
     _writeStreamPos = 0;
 }
 
+void
+Ice::ConnectionI::Observer::compressed()
+{
+    if(_observer)
+    {
+        ConnectionObserverI* observer = dynamic_cast<ConnectionObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->compressed();
+        }
+    }
+}
+
+void
+Ice::ConnectionI::Observer::compressionSkipped()
+{
+    if(_observer)
+    {
+        ConnectionObserverI* observer = dynamic_cast<ConnectionObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->compressionSkipped();
+        }
+    }
+}
+
+void
+Ice::ConnectionI::Observer::sendQueueChanged(Int length, Long size)
+{
+    if(_observer)
+    {
+        ConnectionObserverI* observer = dynamic_cast<ConnectionObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->sendQueueChanged(length, size);
+        }
+    }
+}
+
+void
+Ice::ConnectionI::Observer::sendQueueFull()
+{
+    if(_observer)
+    {
+        ConnectionObserverI* observer = dynamic_cast<ConnectionObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->sendQueueFull();
+        }
+    }
+}
+
 void
 Ice::ConnectionI::Observer::attach(const Ice::Instrumentation::ConnectionObserverPtr& observer)
 {
@@ -307,7 +415,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     }
     else if(!str)
     {
-        if(outAsync)
+        if(outAsync && !prepared)
         {
             return; // Adopting request stream is not necessary.
         }
@@ -333,9 +441,11 @@ Ice::ConnectionI::OutgoingMessage::canceled(bool adoptStream)
     {
         adopt(0); // Adopt the request stream
     }
-    else
+    else if(adopted)
     {
-        assert(!adopted);
+        delete stream; // The compressed stream of a prepared request.
+        stream = 0;
+        adopted = false;
     }
 }
 
@@ -529,6 +639,18 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+size_t
+Ice::ConnectionI::getOutstandingRequestCount() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+
+    //
+    // A twoway request waiting to be sent is also in the request table and is counted
+    // twice, this is fine to estimate the load of the connection.
+    //
+    return _asyncRequests.size() + _sendStreams.size() + _fragmentedStreams.size() + _waitingRequests.size();
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -598,6 +720,8 @@ Ice::ConnectionI::waitUntilFinished()
     // Clear the OA. See bug 1673 for the details of why this is necessary.
     //
     _adapter = 0;
+    _dispatchLanes = 0;
+    _concurrencyLimiter = 0;
 }
 
 void
@@ -615,7 +739,16 @@ Ice::ConnectionI::updateObserver()
                                                                                               _endpoint,
                                                                                               toConnectionState(_state),
                                                                                               _observer.get());
+    ConnectionObserverPtr previous = _observer.get();
     _observer.attach(o);
+    if(o && o != previous && _sendQueueLength > 0)
+    {
+        //
+        // The send queue metrics are updated with the changes of the queue depth, the new
+        // observer starts with the requests already queued.
+        //
+        _observer.sendQueueChanged(static_cast<Int>(_sendQueueLength), static_cast<Long>(_sendQueueSize));
+    }
 }
 
 void
@@ -650,13 +783,15 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
         }
     }
 
-    if(static_cast<Int>(_readStream.b.size()) > headerSize || !_writeStream.b.empty())
+    if(static_cast<Int>(_readStream.b.size()) > headerSize || !_writeStream.b.empty() || _readSuspended)
     {
         //
         // If writing or reading, nothing to do, the connection
         // timeout will kick-in if writes or reads don't progress.
         // This check is necessary because the actitivy timer is
-        // only set when a message is fully read/written.
+        // only set when a message is fully read/written. Reading
+        // is also suspended while the chunks of a streamed result
+        // aren't consumed, the peer isn't idle in this case.
         //
         return;
     }
@@ -687,6 +822,7 @@ AsyncStatus
 Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compress, bool response, int batchRequestNum)
 {
     OutputStream* os = out->getOs();
+    OutputStream compressed(_instance.get(), Ice::currentProtocolEncoding);
 
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     //
@@ -701,17 +837,29 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     assert(_state > StateNotValidated);
     assert(_state < StateClosing);
 
+    //
+    // If the send queue limits are reached, the request waits for the queue to drain or fails
+    // right away. Without limits, a peer which doesn't read its connection fast enough grows
+    // the queue without bound. A waiting request is kept by the connection and queued by
+    // sendWaitingRequests, the calling thread doesn't wait.
+    //
+    bool waiting = false;
+    if(sendQueueFull() || !_waitingRequests.empty())
+    {
+        _observer.sendQueueFull();
+        if(!_sendQueueWait)
+        {
+            throw SendQueueFullException(__FILE__, __LINE__);
+        }
+        waiting = true;
+    }
+
     //
     // Ensure the message isn't bigger than what we can send with the
     // transport.
     //
     _transceiver->checkSendSize(*os);
 
-    //
-    // Notify the request that it's cancelable with this connection.
-    // This will throw if the request is canceled.
-    //
-    out->cancelable(ICE_SHARED_FROM_THIS);
     Int requestId = 0;
     if(response)
     {
@@ -745,12 +893,90 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
 #endif
     }
 
+    OutgoingMessage message(out, os, compress, requestId);
+    message.codec = _compressCodec;
+
+    CompressionCodecPtr codec = getCompressionCodec(message);
+    if(codec)
+    {
+        //
+        // Compress the request without holding the connection lock, other threads can
+        // send messages over the connection in the meantime.
+        //
+        bool wasCompressed = false;
+        sync.release();
+        try
+        {
+            wasCompressed = compressMessage(message, codec, compressed);
+        }
+        catch(const LocalException& ex)
+        {
+            sync.acquire();
+            setState(StateClosed, ex);
+            assert(_exception);
+            _exception->ice_throw();
+        }
+        sync.acquire();
+
+        if(_exception)
+        {
+            throw RetryException(*_exception);
+        }
+
+        //
+        // The send queue might have drained or filled up while the lock was released. A request
+        // must not wait if the queue drained, nothing would queue it.
+        //
+        if(waiting != (sendQueueFull() || !_waitingRequests.empty()))
+        {
+            waiting = !waiting;
+            if(waiting)
+            {
+                _observer.sendQueueFull();
+                if(!_sendQueueWait)
+                {
+                    throw SendQueueFullException(__FILE__, __LINE__);
+                }
+            }
+        }
+
+        if(wasCompressed)
+        {
+            _observer.compressed();
+        }
+        else
+        {
+            _observer.compressionSkipped();
+        }
+    }
+
+    //
+    // Notify the request that it's cancelable with this connection.
+    // This will throw if the request is canceled.
+    //
+    out->cancelable(ICE_SHARED_FROM_THIS);
+
     out->attachRemoteObserver(initConnectionInfo(), _endpoint, requestId);
 
+    //
+    // The request is accounted in the send queue limits until it's sent.
+    //
+    message.requestSize = message.stream->b.size();
+
+    if(waiting)
+    {
+        //
+        // The request is added to the request table once it's queued for sending, a reply
+        // can't be received before.
+        //
+        _waitingRequests.push_back(message);
+        _waitingRequests.back().adopt(0);
+        return AsyncStatusQueued;
+    }
+
     AsyncStatus status = AsyncStatusQueued;
     try
     {
-        OutgoingMessage message(out, os, compress, requestId);
         status = sendMessage(message);
     }
     catch(const LocalException& ex)
@@ -760,13 +986,17 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         _exception->ice_throw();
     }
 
+    if(!(status & AsyncStatusSent))
+    {
+        sendQueueChanged(1, static_cast<Long>(message.requestSize));
+    }
+
     if(response)
     {
         //
-        // Add to the async requests map.
+        // Add to the async requests table.
         //
-        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
-                                                   pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        _asyncRequests.add(requestId, out);
     }
     return status;
 }
@@ -1200,22 +1430,30 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         return; // The request has already been or will be shortly notified of the failure.
     }
 
+    for(deque<OutgoingMessage>::iterator o = _waitingRequests.begin(); o != _waitingRequests.end(); ++o)
+    {
+        if(o->outAsync.get() == outAsync.get())
+        {
+            //
+            // The request isn't sent yet and isn't in the request table, it's just removed.
+            //
+            o->canceled(false);
+            _waitingRequests.erase(o);
+            if(outAsync->exception(ex))
+            {
+                outAsync->invokeExceptionAsync();
+            }
+            return;
+        }
+    }
+
     for(deque<OutgoingMessage>::iterator o = _sendStreams.begin(); o != _sendStreams.end(); ++o)
     {
         if(o->outAsync.get() == outAsync.get())
         {
             if(o->requestId)
             {
-                if(_asyncRequestsHint != _asyncRequests.end() &&
-                   _asyncRequestsHint->second == ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                }
-                else
-                {
-                    _asyncRequests.erase(o->requestId);
-                }
+                _asyncRequests.remove(o->requestId);
             }
 
             if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
@@ -1228,14 +1466,24 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 // If the request is being sent, don't remove it from the send streams,
                 // it will be removed once the sending is finished.
                 //
-                if(o == _sendStreams.begin())
+                // A message coalesced with the message being sent is prepared and might
+                // already be partially sent, it's also removed once the sending is finished.
+                // The last fragment of a fragmented message is always sent, the peer is
+                // reassembling the message.
+                //
+                if(o == _sendStreams.begin() || o->stream->i || o->fragmentId)
                 {
                     o->canceled(true); // true = adopt the stream
                 }
                 else
                 {
+                    if(o->requestSize)
+                    {
+                        sendQueueChanged(-1, -static_cast<Long>(o->requestSize));
+                    }
                     o->canceled(false);
                     _sendStreams.erase(o);
+                    sendWaitingRequests();
                 }
                 if(outAsync->exception(ex))
                 {
@@ -1246,47 +1494,75 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         }
     }
 
-    if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
+    for(deque<OutgoingMessage>::iterator o = _fragmentedStreams.begin(); o != _fragmentedStreams.end(); ++o)
     {
-        if(_asyncRequestsHint != _asyncRequests.end())
+        if(o->outAsync.get() == outAsync.get())
         {
-            if(_asyncRequestsHint->second == outAsync)
+            if(o->requestId)
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
+                _asyncRequests.remove(o->requestId);
+            }
+
+            if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
+            {
+                setState(StateClosed, ex);
+            }
+            else
+            {
+                //
+                // The remaining fragments are still sent, the message is already partially sent.
+                //
+                o->canceled(true); // true = adopt the stream
+                if(outAsync->exception(ex))
                 {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
+                    outAsync->invokeExceptionAsync();
                 }
-                return;
             }
+            return;
+        }
+    }
+
+    if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
+    {
+        //
+        // Find the request with the request ID written in the request header by
+        // sendAsyncRequest. If the reply was already received, the request is no
+        // longer in the table and it's completed by the reply.
+        //
+        Int requestId = 0;
+        OutputStream* os = outAsync->getOs();
+        if(os->b.size() >= static_cast<size_t>(headerSize + sizeof(Int)))
+        {
+            Byte* p = reinterpret_cast<Byte*>(&requestId);
+#ifdef ICE_BIG_ENDIAN
+            reverse_copy(os->b.begin() + headerSize, os->b.begin() + headerSize + sizeof(Int), p);
+#else
+            copy(os->b.begin() + headerSize, os->b.begin() + headerSize + sizeof(Int), p);
+#endif
         }
 
-        for(map<Int, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
+        if(_asyncRequests.contains(requestId, outAsync))
         {
-            if(p->second.get() == outAsync.get())
+            if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
+            {
+                setState(StateClosed, ex);
+            }
+            else
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
+                _asyncRequests.remove(requestId);
+                if(outAsync->exception(ex))
                 {
-                    setState(StateClosed, ex);
+                    outAsync->invokeExceptionAsync();
                 }
-                else
+
+                //
+                // Reading might be suspended until the chunks of the canceled request are consumed.
+                //
+                if(_readSuspended)
                 {
-                    assert(p != _asyncRequestsHint);
-                    _asyncRequests.erase(p);
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
+                    _readSuspended = false;
+                    _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
                 }
-                return;
             }
         }
     }
@@ -1295,6 +1571,32 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 void
 Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*amd*/)
 {
+    OutgoingMessage message(os, compressFlag > 0);
+    if(compressFlag > 0)
+    {
+        message.codec = static_cast<Byte>((compressFlag - 1) / 2); // Reply with the codec used by the request.
+    }
+
+    //
+    // Compress the response before locking the connection, other threads can send
+    // messages over the connection in the meantime.
+    //
+    OutputStream compressed(_instance.get(), Ice::currentProtocolEncoding);
+    CompressionCodecPtr codec = getCompressionCodec(message);
+    IceInternal::UniquePtr<LocalException> compressionException;
+    bool wasCompressed = false;
+    if(codec)
+    {
+        try
+        {
+            wasCompressed = compressMessage(message, codec, compressed);
+        }
+        catch(const LocalException& ex)
+        {
+            ICE_SET_EXCEPTION_FROM_CLONE(compressionException, ex.ice_clone());
+        }
+    }
+
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     assert(_state > StateNotValidated);
 
@@ -1315,7 +1617,21 @@ Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*
             _exception->ice_throw();
         }
 
-        OutgoingMessage message(os, compressFlag > 0);
+        if(compressionException)
+        {
+            compressionException->ice_throw();
+        }
+        else if(codec)
+        {
+            if(wasCompressed)
+            {
+                _observer.compressed();
+            }
+            else
+            {
+                _observer.compressionSkipped();
+            }
+        }
         sendMessage(message);
 
         if(_state == StateClosing && _dispatchCount == 0)
@@ -1397,37 +1713,113 @@ Ice::ConnectionI::invokeException(Ice::Int, const LocalException& ex, int invoke
     }
 }
 
-EndpointIPtr
-Ice::ConnectionI::endpoint() const
+bool
+Ice::ConnectionI::sendResponseChunk(Int, OutputStream* os, Byte compressFlag,
+                                    const ICE_DELEGATE(ChunkReadyCallback)& ready)
 {
-    return _endpoint; // No mutex protection necessary, _endpoint is immutable.
-}
+    OutgoingMessage message(os, compressFlag > 0);
+    if(compressFlag > 0)
+    {
+        message.codec = static_cast<Byte>((compressFlag - 1) / 2); // Reply with the codec used by the request.
+    }
 
-ConnectorPtr
-Ice::ConnectionI::connector() const
-{
-    return _connector; // No mutex protection necessary, _connector is immutable.
-}
+    OutputStream compressed(_instance.get(), Ice::currentProtocolEncoding);
+    CompressionCodecPtr codec = getCompressionCodec(message);
+    bool wasCompressed = codec && compressMessage(message, codec, compressed);
 
-void
-Ice::ConnectionI::setAdapter(const ObjectAdapterPtr& adapter)
-{
-    if(adapter)
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+
+    if(_state >= StateClosed)
     {
-        // Go through the adapter to set the adapter and servant manager on this connection
-        // to ensure the object adapter is still active.
-        dynamic_cast<ObjectAdapterI*>(adapter.get())->setAdapterOnConnection(ICE_SHARED_FROM_THIS);
+        assert(_exception);
+        _exception->ice_throw();
     }
-    else
+
+    if(codec)
     {
-        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
-        if(_state <= StateNotValidated || _state >= StateClosing)
+        if(wasCompressed)
         {
-            return;
+            _observer.compressed();
+        }
+        else
+        {
+            _observer.compressionSkipped();
+        }
+    }
+
+    try
+    {
+        sendMessage(message);
+    }
+    catch(const LocalException& ex)
+    {
+        setState(StateClosed, ex);
+        throw;
+    }
+
+    //
+    // The chunk is always queued, the producer is asked to wait for the send queue to drain before
+    // sending the next chunk, the peer stops reading the connection if its consumer of the chunks
+    // is behind.
+    //
+    if(_sendStreams.size() + _fragmentedStreams.size() >= _streamChunkWindow)
+    {
+        if(ready)
+        {
+            _chunkReadyCallbacks.push_back(ready);
+        }
+        return false;
+    }
+    return true;
+}
+
+void
+Ice::ConnectionI::resumeReading()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(_readSuspended)
+    {
+        _readSuspended = false;
+        if(_state == StateActive)
+        {
+            _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+        }
+    }
+}
+
+EndpointIPtr
+Ice::ConnectionI::endpoint() const
+{
+    return _endpoint; // No mutex protection necessary, _endpoint is immutable.
+}
+
+ConnectorPtr
+Ice::ConnectionI::connector() const
+{
+    return _connector; // No mutex protection necessary, _connector is immutable.
+}
+
+void
+Ice::ConnectionI::setAdapter(const ObjectAdapterPtr& adapter)
+{
+    if(adapter)
+    {
+        // Go through the adapter to set the adapter and servant manager on this connection
+        // to ensure the object adapter is still active.
+        dynamic_cast<ObjectAdapterI*>(adapter.get())->setAdapterOnConnection(ICE_SHARED_FROM_THIS);
+    }
+    else
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_state <= StateNotValidated || _state >= StateClosing)
+        {
+            return;
         }
 
         _adapter = 0;
         _servantManager = 0;
+        _dispatchLanes = 0;
+        _concurrencyLimiter = 0;
     }
 
     //
@@ -1462,7 +1854,9 @@ Ice::ConnectionI::createProxy(const Identity& ident) const
 
 void
 Ice::ConnectionI::setAdapterAndServantManager(const ObjectAdapterPtr& adapter,
-                                              const IceInternal::ServantManagerPtr& servantManager)
+                                              const IceInternal::ServantManagerPtr& servantManager,
+                                              const IceInternal::DispatchLanesPtr& dispatchLanes,
+                                              const IceInternal::ConcurrencyLimiterPtr& concurrencyLimiter)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     if(_state <= StateNotValidated || _state >= StateClosing)
@@ -1472,6 +1866,8 @@ Ice::ConnectionI::setAdapterAndServantManager(const ObjectAdapterPtr& adapter,
     assert(adapter); // Called by ObjectAdapterI::setAdapterOnConnection
     _adapter = adapter;
     _servantManager = servantManager;
+    _dispatchLanes = dispatchLanes;
+    _concurrencyLimiter = concurrencyLimiter;
 }
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -1586,6 +1982,10 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     ObjectAdapterPtr adapter;
     OutgoingAsyncBasePtr outAsync;
     ICE_DELEGATE(HeartbeatCallback) heartbeatCallback;
+    DispatchLanesPtr dispatchLanes;
+    ConcurrencyLimiterPtr concurrencyLimiter;
+    bool peerServerBusy = false;
+    IceUtil::Time received;
     int dispatchCount = 0;
 
     ThreadPoolMessage<ConnectionI> msg(current, *this);
@@ -1608,6 +2008,15 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         {
             unscheduleTimeout(current.operation);
 
+            if(!_zeroCopyStreams.empty())
+            {
+                //
+                // Release the streams of the completed zero-copy sends. The completion notifications
+                // are reported by the selector as socket errors.
+                //
+                releaseZeroCopyStreams(false);
+            }
+
             SocketOperation writeOp = SocketOperationNone;
             SocketOperation readOp = SocketOperationNone;
             if(readyOp & SocketOperationWrite)
@@ -1765,8 +2174,54 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 // We parse messages first, if we receive a close
                 // connection message we won't send more messages.
                 //
+                if((readyOp & SocketOperationRead) && _readStream.b[8] == fragmentMsg && !reassembleFragment())
+                {
+                    //
+                    // Wait for the next fragments of the message.
+                    //
+                    readyOp = static_cast<SocketOperation>(readyOp & ~SocketOperationRead);
+                    if(_state != StateHolding && !_readSuspended)
+                    {
+                        newOp = static_cast<SocketOperation>(newOp | SocketOperationRead);
+                    }
+                }
+
                 if(readyOp & SocketOperationRead)
                 {
+                    Byte compressByte = _readStream.b[9];
+                    if(compressByte >= 2 && compressByte % 2 == 0 && _readStream.b[8] != validateConnectionMsg)
+                    {
+                        CompressionCodecPtr codec = _instance->getCompressionCodec(static_cast<Byte>((compressByte - 2) / 2));
+                        if(!codec)
+                        {
+                            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
+                        }
+
+                        //
+                        // Uncompress the message without holding the connection lock, the IO
+                        // scope ensures no other thread reads from the connection meanwhile.
+                        //
+                        InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
+                        sync.release();
+                        try
+                        {
+                            doUncompress(codec, _readStream, ustream);
+                        }
+                        catch(...)
+                        {
+                            sync.acquire();
+                            throw;
+                        }
+                        sync.acquire();
+
+                        if(_state >= StateClosed)
+                        {
+                            return;
+                        }
+                        _readStream.b.swap(ustream.b);
+                        _readStream.i = _readStream.b.end();
+                    }
+
                     newOp = static_cast<SocketOperation>(newOp | parseMessage(current.stream,
                                                                               invokeNum,
                                                                               requestId,
@@ -1805,6 +2260,13 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             }
 
             _dispatchCount += dispatchCount;
+            if(invokeNum > 0)
+            {
+                dispatchLanes = _dispatchLanes;
+                concurrencyLimiter = _concurrencyLimiter;
+                peerServerBusy = _peerServerBusy;
+                received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
             io.completed();
         }
         catch(const DatagramLimitException&) // Expected.
@@ -1845,22 +2307,62 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
+    //
+    // The requests over the concurrency limit of the adapter are rejected from this
+    // thread instead of being queued for dispatch.
+    //
+    if(concurrencyLimiter && !concurrencyLimiter->acquire(invokeNum))
+    {
+        rejectAll(current.stream, invokeNum, requestId, compress, adapter, peerServerBusy);
+        if(!startCB && sentCBs.empty() && !outAsync && !heartbeatCallback)
+        {
+            return;
+        }
+        invokeNum = 0;
+        concurrencyLimiter = 0;
+    }
+
 // dispatchFromThisThread dispatches to the correct DispatchQueue
 #ifdef ICE_SWIFT
     _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
                                                          invokeNum, servantManager, adapter, outAsync,
-                                                         heartbeatCallback, current.stream));
+                                                         heartbeatCallback, current.stream, received,
+                                                         concurrencyLimiter));
 #else
-    if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+    //
+    // If the adapter has dispatch lanes, the requests are queued with their lane and
+    // dispatched separately from the other work. There's nothing to queue if the
+    // requests were rejected above.
+    //
+    if(dispatchLanes && invokeNum > 0)
+    {
+        size_t lane = dispatchLanes->classify(current.stream);
+        dispatchLanes->queue(lane, new DispatchCall(ICE_SHARED_FROM_THIS, ICE_NULLPTR, vector<OutgoingMessage>(),
+                                                    compress, requestId, invokeNum, servantManager, adapter,
+                                                    ICE_NULLPTR, ICE_NULLPTR, current.stream, received,
+                                                    concurrencyLimiter));
+        if(!startCB && sentCBs.empty() && !outAsync && !heartbeatCallback)
+        {
+            return;
+        }
+        invokeNum = 0;
+    }
+
+    //
+    // Optimization, call dispatch() directly if there's no dispatcher and no dispatch
+    // workers. Otherwise, the dispatch call is either dispatched from this thread with
+    // the dispatcher or handed over to the dispatch workers.
+    //
+    if(!_dispatcher && !current.hasDispatchWorkers())
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
-                 current.stream);
+                 current.stream, received, concurrencyLimiter);
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
-                                                             invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+        current.dispatch(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId, invokeNum,
+                                          servantManager, adapter, outAsync, heartbeatCallback, current.stream,
+                                          received, concurrencyLimiter));
 
     }
 #endif
@@ -1870,7 +2372,8 @@ void
 ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMessage>& sentCBs,
                       Byte compress, Int requestId, Int invokeNum, const ServantManagerPtr& servantManager,
                       const ObjectAdapterPtr& adapter, const OutgoingAsyncBasePtr& outAsync,
-                      const ICE_DELEGATE(HeartbeatCallback)& heartbeatCallback, InputStream& stream)
+                      const ICE_DELEGATE(HeartbeatCallback)& heartbeatCallback, InputStream& stream,
+                      const IceUtil::Time& received, const ConcurrencyLimiterPtr& concurrencyLimiter)
 {
     int dispatchedCount = 0;
 
@@ -1951,7 +2454,7 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
     //
     if(invokeNum)
     {
-        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter);
+        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, received, concurrencyLimiter);
 
         //
         // Don't increase count, the dispatch count is
@@ -2020,13 +2523,13 @@ Ice::ConnectionI::finished(ThreadPoolCurrent& current, bool close)
 #ifdef ICE_SWIFT
     _threadPool->dispatchFromThisThread(new FinishCall(ICE_SHARED_FROM_THIS, close));
 #else
-    if(!_dispatcher) // Optimization, call finish() directly if there's no dispatcher.
+    if(!_dispatcher && !current.hasDispatchWorkers()) // Optimization, call finish() directly if possible.
     {
         finish(close);
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new FinishCall(ICE_SHARED_FROM_THIS, close));
+        current.dispatch(new FinishCall(ICE_SHARED_FROM_THIS, close));
     }
 #endif
 }
@@ -2125,22 +2628,65 @@ Ice::ConnectionI::finish(bool close)
             o->completed(*_exception);
             if(o->requestId) // Make sure finished isn't called twice.
             {
-                _asyncRequests.erase(o->requestId);
+                _asyncRequests.remove(o->requestId);
             }
         }
 
         _sendStreams.clear();
     }
 
-    for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    for(deque<OutgoingMessage>::iterator o = _fragmentedStreams.begin(); o != _fragmentedStreams.end(); ++o)
     {
-        if(q->second->exception(*_exception))
+        o->completed(*_exception);
+        if(o->requestId)
         {
-            q->second->invokeException();
+            _asyncRequests.remove(o->requestId);
         }
     }
+    _fragmentedStreams.clear();
+
+    for(deque<OutgoingMessage>::iterator o = _waitingRequests.begin(); o != _waitingRequests.end(); ++o)
+    {
+        o->completed(*_exception);
+    }
+    _waitingRequests.clear();
+
+    //
+    // The producers of streamed results get the connection exception when sending their next chunk.
+    //
+    for(vector<ICE_DELEGATE(ChunkReadyCallback)>::const_iterator p = _chunkReadyCallbacks.begin();
+        p != _chunkReadyCallbacks.end(); ++p)
+    {
+        dispatchChunkReady(_instance, _threadPool, *p);
+    }
+    _chunkReadyCallbacks.clear();
+
+    if(_sendQueueLength > 0)
+    {
+        sendQueueChanged(-static_cast<Int>(_sendQueueLength), -static_cast<Long>(_sendQueueSize));
+    }
+
+    for(map<Int, FragmentedMessage*>::const_iterator p = _fragments.begin(); p != _fragments.end(); ++p)
+    {
+        delete p->second;
+    }
+    _fragments.clear();
+    _fragmentsSize = 0;
 
-    _asyncRequests.clear();
+    //
+    // The connection is closed, the streams retained for zero-copy sends can be released.
+    //
+    releaseZeroCopyStreams(true);
+
+    vector<OutgoingAsyncBasePtr> requests;
+    _asyncRequests.removeAll(requests);
+    for(vector<OutgoingAsyncBasePtr>::const_iterator q = requests.begin(); q != requests.end(); ++q)
+    {
+        if((*q)->exception(*_exception))
+        {
+            (*q)->invokeException();
+        }
+    }
 
     //
     // Don't wait to be reaped to reclaim memory allocated by read/write streams.
@@ -2272,10 +2818,35 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _compressionLevel(1),
+    _preferredCodec(0),
+    _peerCodecs(1),
+    _compressCodec(0),
     _nextRequestId(1),
-    _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+    _writeCoalesceSize(0),
+#else
+    _writeCoalesceSize(_instance->writeCoalesceSize()),
+#endif
+    _zeroCopy(false),
+    _zeroCopySent(0),
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+    _fragmentSize(0),
+#else
+    _fragmentSize(endpoint->datagram() ? 0 : _instance->messageFragmentSize()),
+#endif
+    _peerFragments(false),
+    _peerServerBusy(false),
+    _nextFragmentId(1),
+    _fragmentsSize(0),
+    _streamChunkWindow(_instance->streamChunkWindow()),
+    _readSuspended(false),
+    _sendQueueSizeMax(_instance->sendQueueSizeMax()),
+    _sendQueueLengthMax(_instance->sendQueueLengthMax()),
+    _sendQueueWait(_instance->sendQueueWait()),
+    _sendQueueSize(0),
+    _sendQueueLength(0),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
@@ -2298,9 +2869,33 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
         compressionLevel = 9;
     }
 
+    //
+    // The codec is set by the endpoint or the Ice.Compression.Codec property. Until the peer
+    // advertises the codec, requests are compressed with bzip2 which is always supported.
+    //
+    string codec = _endpoint->compressionCodec();
+    if(codec.empty())
+    {
+        codec = properties->getPropertyWithDefault("Ice.Compression.Codec", "bzip2");
+    }
+    CompressionCodecPtr preferred = _instance->findCompressionCodec(codec);
+    if(preferred)
+    {
+        _preferredCodec = preferred->id();
+    }
+
+    if(properties->getPropertyAsIntWithDefault("Ice.Compression.Adaptive", 1) > 0)
+    {
+        int maxRatio = properties->getPropertyAsIntWithDefault("Ice.Compression.MaxRatio", 90);
+        int probeInterval = properties->getPropertyAsIntWithDefault("Ice.Compression.ProbeInterval", 100);
+        _compressionPolicy.reset(new CompressionPolicy(max(maxRatio, 1), max(probeInterval, 0)));
+    }
+
     if(adapter)
     {
         _servantManager = adapter->getServantManager();
+        _dispatchLanes = adapter->getDispatchLanes();
+        _concurrencyLimiter = adapter->getConcurrencyLimiter();
     }
 
     if(_monitor && _monitor->getACM().timeout > 0)
@@ -2448,7 +3043,10 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
-                _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                if(!_readSuspended)
+                {
+                    _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                }
                 break;
             }
 
@@ -2462,10 +3060,18 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
-                if(_state == StateActive)
+                if(_state == StateActive && !_readSuspended)
                 {
                     _threadPool->unregister(ICE_SHARED_FROM_THIS, SocketOperationRead);
                 }
+                else
+                {
+                    //
+                    // The connection is validated, large messages can now be sent with
+                    // zero-copy sends if enabled.
+                    //
+                    _zeroCopy = _transceiver->enableZeroCopy();
+                }
                 break;
             }
 
@@ -2479,6 +3085,18 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
+
+                //
+                // Keep reading to receive the peer's close connection message.
+                //
+                if(_readSuspended)
+                {
+                    _readSuspended = false;
+                    if(_state == StateActive)
+                    {
+                        _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                    }
+                }
                 break;
             }
 
@@ -2584,9 +3202,9 @@ Ice::ConnectionI::initiateShutdown()
 {
     assert(_state == StateClosing && _dispatchCount == 0);
 
-    if(_shutdownInitiated)
+    if(_shutdownInitiated || !_fragmentedStreams.empty())
     {
-        return;
+        return; // The shutdown is initiated once all the fragmented messages are sent.
     }
     _shutdownInitiated = true;
 
@@ -2691,7 +3309,15 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                //
+                // The compression status of the validate connection message is the bit mask of the
+                // codecs supported in addition to bzip2, of the fragmentation support and of the server
+                // busy reply status support, it's ignored by earlier versions.
+                //
+                Byte compress = static_cast<Byte>((_instance->compressionCodecs() & ~1) |
+                                                  (_fragmentSize > 0 ? fragmentationSupported : 0) |
+                                                  serverBusySupported);
+                _writeStream.write(compress); // Compression status.
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2773,7 +3399,10 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 throw ConnectionNotValidatedException(__FILE__, __LINE__);
             }
             Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // Compression codecs supported by the server.
+            _peerFragments = (compress & fragmentationSupported) != 0;
+            _peerServerBusy = (compress & serverBusySupported) != 0;
+            setPeerCompressionCodecs(static_cast<Byte>(compress & ~(fragmentationSupported | serverBusySupported)));
             Int size;
             _readStream.read(size);
             if(size != headerSize)
@@ -2791,6 +3420,27 @@ Ice::ConnectionI::validate(SocketOperation operation)
     _readStream.i = _readStream.b.begin();
     _readHeader = true;
 
+    if(_peerFragments || _peerServerBusy)
+    {
+        //
+        // The server understands the validate connection message flags. Let it know that the client
+        // understands the server busy reply status and, if fragmentation is enabled, that it
+        // reassembles fragmented messages so that the server can also fragment its replies.
+        //
+        OutputStream os(_instance.get(), Ice::currentProtocolEncoding);
+        os.write(magic[0]);
+        os.write(magic[1]);
+        os.write(magic[2]);
+        os.write(magic[3]);
+        os.write(currentProtocol);
+        os.write(currentProtocolEncoding);
+        os.write(validateConnectionMsg);
+        os.write(static_cast<Byte>((_fragmentSize > 0 ? fragmentationSupported : 0) | serverBusySupported));
+        os.write(headerSize); // Message size.
+        OutgoingMessage message(&os, false);
+        sendMessage(message);
+    }
+
     if(_instance->traceLevels()->network >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
@@ -2825,6 +3475,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     }
 
     assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
+    SocketOperation blocked = SocketOperationNone;
     try
     {
         while(true)
@@ -2833,9 +3484,19 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             // Notify the message that it was sent.
             //
             OutgoingMessage* message = &_sendStreams.front();
+            int fragmentId = message->fragmentId;
+            if(message->requestSize)
+            {
+                sendQueueChanged(-1, -static_cast<Long>(message->requestSize));
+                sendWaitingRequests();
+            }
             if(message->stream)
             {
                 _writeStream.swap(*message->stream);
+                if(_zeroCopy)
+                {
+                    retainZeroCopyStream(*message);
+                }
                 if(message->sent())
                 {
                     callbacks.push_back(*message);
@@ -2843,6 +3504,28 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
             _sendStreams.pop_front();
 
+            if(!_chunkReadyCallbacks.empty() && _sendStreams.size() + _fragmentedStreams.size() < _streamChunkWindow)
+            {
+                //
+                // Notify the producers of streamed results that they can send the next chunk.
+                //
+                for(vector<ICE_DELEGATE(ChunkReadyCallback)>::const_iterator p = _chunkReadyCallbacks.begin();
+                    p != _chunkReadyCallbacks.end(); ++p)
+                {
+                    dispatchChunkReady(_instance, _threadPool, *p);
+                }
+                _chunkReadyCallbacks.clear();
+            }
+
+            //
+            // If a fragment was sent, queue the next fragment of the message after the messages
+            // queued in the meantime.
+            //
+            if(fragmentId)
+            {
+                queueNextFragment(fragmentId);
+            }
+
             //
             // If there's nothing left to send, we're done.
             //
@@ -2864,56 +3547,15 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
 
             //
-            // Otherwise, prepare the next message stream for writing.
+            // Otherwise, prepare the next message stream for writing. The message might
+            // already be prepared and partially written if it was coalesced with the
+            // previous message.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
-            {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
+            if(!message->stream->i)
             {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
+                prepareMessage(*message);
             }
-#endif
             _writeStream.swap(*message->stream);
 
             //
@@ -2926,10 +3568,18 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if(_writeStream.i != _writeStream.b.end())
             {
-                SocketOperation op = write(_writeStream);
+                if(blocked)
+                {
+                    return blocked; // The previous coalesced write would block.
+                }
+                SocketOperation op = writeQueued();
                 if(op)
                 {
-                    return op;
+                    if(_writeStream.i != _writeStream.b.end())
+                    {
+                        return op;
+                    }
+                    blocked = op;
                 }
             }
             if(_observer)
@@ -2959,221 +3609,486 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
-AsyncStatus
-Ice::ConnectionI::sendMessage(OutgoingMessage& message)
+bool
+Ice::ConnectionI::sendQueueFull() const
 {
-    assert(_state < StateClosed);
-
-    message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
+    return (_sendQueueLengthMax > 0 && _sendQueueLength >= _sendQueueLengthMax) ||
+           (_sendQueueSizeMax > 0 && _sendQueueSize >= _sendQueueSizeMax);
+}
 
-    if(!_sendStreams.empty())
+void
+Ice::ConnectionI::sendWaitingRequests()
+{
+    //
+    // Queue the requests waiting for the send queue to drain, in order. This is called once a
+    // request is sent or removed from the send queue, the queue still holds the message being
+    // sent so sendMessage queues the requests and they are sent by sendNextMessage.
+    //
+    assert(!_sendStreams.empty());
+    while(!_waitingRequests.empty() && !sendQueueFull() && _state < StateClosing)
     {
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0);
-        return AsyncStatusQueued;
+        OutgoingMessage message = _waitingRequests.front();
+        _waitingRequests.pop_front();
+        sendQueueChanged(1, static_cast<Long>(message.requestSize));
+        if(message.requestId)
+        {
+            _asyncRequests.add(message.requestId, message.outAsync);
+        }
+        sendMessage(message);
     }
+}
 
-    //
-    // Attempt to send the message without blocking. If the send blocks, we register
-    // the connection with the selector thread.
-    //
+void
+Ice::ConnectionI::sendQueueChanged(Int length, Long size)
+{
+    _sendQueueLength += length;
+    _sendQueueSize += size;
+    _observer.sendQueueChanged(length, size);
+}
 
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
+{
+    assert(!message.stream->i);
     message.stream->i = message.stream->b.begin();
-    SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    if(message.prepared)
     {
-        //
-        // Message compressed. Request compressed response, if any.
-        //
-        message.stream->b[9] = 2;
+        return; // The message was compressed and traced when it was sent.
+    }
 
+    if(message.compress)
+    {
         //
-        // Do compression.
+        // Message not compressed. Request compressed response, if any.
         //
-        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
-        stream.i = stream.b.begin();
+        message.stream->b[9] = static_cast<Byte>(2 * message.codec + 1);
+    }
 
-        traceSend(*message.stream, _logger, _traceLevels);
+    //
+    // No compression, just fill in the message size.
+    //
+    Int sz = static_cast<Int>(message.stream->b.size());
+    const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+    reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#else
+    copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#endif
+    traceSend(*message.stream, _logger, _traceLevels);
+}
 
+Ice::ConnectionI::OutgoingMessage
+Ice::ConnectionI::createFragment(deque<OutgoingMessage>::iterator p, OutputStream& os)
+{
+    //
+    // Write the next fragment of the fragmented message to the given stream. The message
+    // stream iterator is the position of the data to send with the next fragment.
+    //
+    OutputStream* stream = p->stream;
+    size_t sz = min(static_cast<size_t>(stream->b.end() - stream->i), _fragmentSize);
+    bool last = stream->i + sz == stream->b.end();
+
+    os.write(magic[0]);
+    os.write(magic[1]);
+    os.write(magic[2]);
+    os.write(magic[3]);
+    os.write(currentProtocol);
+    os.write(currentProtocolEncoding);
+    os.write(fragmentMsg);
+    os.write(static_cast<Byte>(0)); // Compression status.
+    os.write(static_cast<Int>(fragmentHeaderSize + sz)); // Message size.
+    os.write(p->fragmentId);
+    os.write(static_cast<Byte>(last ? lastFragment : 0));
+    os.writeBlob(stream->i, sz);
+    stream->i += sz;
+
+    OutgoingMessage fragment(&os, false);
+    fragment.fragmentId = p->fragmentId;
+    fragment.prepared = true;
+    if(last)
+    {
         //
-        // Send the message without blocking.
+        // The request is sent once its last fragment is sent.
         //
-        if(_observer)
-        {
-            _observer.startWrite(stream);
-        }
-        op = write(stream);
-        if(!op)
+        fragment.outAsync = p->outAsync;
+        fragment.requestId = p->requestId;
+        fragment.requestSize = p->requestSize;
+        if(p->adopted)
         {
-            if(_observer)
-            {
-                _observer.finishWrite(stream);
-            }
-
-            AsyncStatus status = AsyncStatusSent;
-            if(message.sent())
-            {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
-            }
-            if(_acmLastActivity != IceUtil::Time())
-            {
-                _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
-            }
-            return status;
+            delete p->stream;
         }
+        _fragmentedStreams.erase(p);
+    }
+    return fragment;
+}
 
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(&stream);
+bool
+Ice::ConnectionI::canFragment(size_t size) const
+{
+    //
+    // Check the limits of the messages reassembled at once by the peer.
+    //
+    if(_fragmentedStreams.size() >= maxFragmentedMessages)
+    {
+        return false;
     }
-    else
+    for(deque<OutgoingMessage>::const_iterator p = _fragmentedStreams.begin(); p != _fragmentedStreams.end(); ++p)
     {
-#endif
-        if(message.compress)
+        size += p->stream->b.size();
+    }
+    return size <= _messageSizeMax;
+}
+
+void
+Ice::ConnectionI::queueNextFragment(int fragmentId)
+{
+    for(deque<OutgoingMessage>::iterator p = _fragmentedStreams.begin(); p != _fragmentedStreams.end(); ++p)
+    {
+        if(p->fragmentId == fragmentId)
         {
+            OutputStream os(_instance.get(), Ice::currentProtocolEncoding);
+            _sendStreams.push_back(createFragment(p, os));
+            _sendStreams.back().adopt(0);
+            _sendStreams.back().stream->i = 0;
+
             //
-            // Message not compressed. Request compressed response, if any.
+            // The connection closure was delayed until the fragmented messages are sent.
             //
-            message.stream->b[9] = 1;
+            if(_fragmentedStreams.empty() && _state == StateClosing && _dispatchCount == 0)
+            {
+                initiateShutdown();
+            }
+            return;
         }
+    }
+}
 
-        //
-        // No compression, just fill in the message size.
-        //
-        Int sz = static_cast<Int>(message.stream->b.size());
-        const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
-#else
-        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
-#endif
-        message.stream->i = message.stream->b.begin();
+bool
+Ice::ConnectionI::reassembleFragment()
+{
+    assert(_readStream.i == _readStream.b.end());
+
+    //
+    // Fragments are only sent by a peer which was told that this side reassembles them.
+    //
+    if(_fragmentSize == 0)
+    {
+        throw UnknownMessageException(__FILE__, __LINE__);
+    }
 
-        traceSend(*message.stream, _logger, _traceLevels);
+    if(_readStream.b.size() < static_cast<size_t>(fragmentHeaderSize))
+    {
+        throw IllegalMessageSizeException(__FILE__, __LINE__);
+    }
 
+    _readStream.i = _readStream.b.begin() + headerSize;
+    Int fragmentId;
+    _readStream.read(fragmentId);
+    Byte flags;
+    _readStream.read(flags);
+
+    map<Int, FragmentedMessage*>::iterator p = _fragments.find(fragmentId);
+    if(p == _fragments.end())
+    {
         //
-        // Send the message without blocking.
+        // The first fragment starts with the header of the fragmented message, the message size
+        // is checked. The buffer grows as the fragments are received.
         //
-        if(_observer)
+        if(_fragments.size() >= maxFragmentedMessages)
         {
-            _observer.startWrite(*message.stream);
+            throw ProtocolException(__FILE__, __LINE__, "too many fragmented messages");
         }
-        op = write(*message.stream);
-        if(!op)
+        if(_readStream.b.end() - _readStream.i < headerSize)
         {
-            if(_observer)
-            {
-                _observer.finishWrite(*message.stream);
-            }
-            AsyncStatus status = AsyncStatusSent;
-            if(message.sent())
-            {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
-            }
-            if(_acmLastActivity != IceUtil::Time())
-            {
-                _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
-            }
-            return status;
+            throw IllegalMessageSizeException(__FILE__, __LINE__);
+        }
+        Buffer::Container::iterator start = _readStream.i;
+        const Byte* m;
+        _readStream.readBlob(m, static_cast<Int>(sizeof(magic)));
+        if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
+        {
+            throw BadMagicException(__FILE__, __LINE__, "", Ice::ByteSeq(&m[0], &m[0] + sizeof(magic)));
+        }
+        ProtocolVersion pv;
+        _readStream.read(pv);
+        checkSupportedProtocol(pv);
+        EncodingVersion ev;
+        _readStream.read(ev);
+        checkSupportedProtocolEncoding(ev);
+        Byte messageType;
+        _readStream.read(messageType);
+        Byte compress;
+        _readStream.read(compress);
+        Int size;
+        _readStream.read(size);
+        if(size < headerSize || messageType == fragmentMsg)
+        {
+            throw IllegalMessageSizeException(__FILE__, __LINE__);
+        }
+        if(size > static_cast<Int>(_messageSizeMax))
+        {
+            Ex::throwMemoryLimitException(__FILE__, __LINE__, static_cast<size_t>(size), _messageSizeMax);
         }
+        _readStream.i = start;
 
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
+        p = _fragments.insert(make_pair(fragmentId, new FragmentedMessage(static_cast<size_t>(size)))).first;
     }
-#endif
 
-    _writeStream.swap(*_sendStreams.back().stream);
-    scheduleTimeout(op);
-    _threadPool->_register(ICE_SHARED_FROM_THIS, op);
-    return AsyncStatusQueued;
-}
-
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
-{
-    if(bzError == BZ_RUN_OK)
+    FragmentedMessage* message = p->second;
+    size_t pos = message->buffer.b.size();
+    size_t sz = static_cast<size_t>(_readStream.b.end() - _readStream.i);
+    if(message->size - pos < sz)
     {
-        return ": BZ_RUN_OK";
+        throw IllegalMessageSizeException(__FILE__, __LINE__);
     }
-    else if(bzError == BZ_FLUSH_OK)
+    if(_fragmentsSize + sz > _messageSizeMax)
     {
-        return ": BZ_FLUSH_OK";
+        Ex::throwMemoryLimitException(__FILE__, __LINE__, _fragmentsSize + sz, _messageSizeMax);
     }
-    else if(bzError == BZ_FINISH_OK)
+    message->buffer.b.resize(pos + sz);
+    copy(_readStream.i, _readStream.b.end(), message->buffer.b.begin() + pos);
+    _fragmentsSize += sz;
+
+    bool last = (flags & lastFragment) != 0;
+    if(last != (message->buffer.b.size() == message->size))
     {
-        return ": BZ_FINISH_OK";
+        throw IllegalMessageSizeException(__FILE__, __LINE__);
     }
-    else if(bzError == BZ_STREAM_END)
+
+    if(!last)
     {
-        return ": BZ_STREAM_END";
+        //
+        // Read the header of the next message, the buffer is kept to read the next fragment.
+        //
+        _readStream.resize(headerSize);
+        _readStream.i = _readStream.b.begin();
+        _readHeader = true;
+        return false;
     }
-    else if(bzError == BZ_CONFIG_ERROR)
+
+    //
+    // The message is reassembled, it's processed as if it was just read.
+    //
+    _readStream.b.swap(message->buffer.b);
+    _readStream.i = _readStream.b.end();
+    _fragmentsSize -= message->size;
+    delete message;
+    _fragments.erase(p);
+    return true;
+}
+
+void
+Ice::ConnectionI::retainZeroCopyStream(OutgoingMessage& message, OutputStream* stream)
+{
+    //
+    // If the message was written with zero-copy sends, its data must not be modified or
+    // released until the sends complete. The message stream is adopted unless it's owned
+    // by the request, in which case we just keep a reference on the request.
+    //
+    Ice::Long sent = _transceiver->zeroCopySent();
+    if(sent == _zeroCopySent)
     {
-        return ": BZ_CONFIG_ERROR";
+        return;
     }
-    else if(bzError == BZ_SEQUENCE_ERROR)
+    _zeroCopySent = sent;
+
+    message.adopt(stream);
+    _zeroCopyStreams.push_back(make_pair(sent, message));
+    message.adopted = false; // The stream is now owned by _zeroCopyStreams.
+}
+
+void
+Ice::ConnectionI::releaseZeroCopyStreams(bool all)
+{
+    Ice::Long completed = all ? _zeroCopySent : _transceiver->zeroCopyCompleted();
+    while(!_zeroCopyStreams.empty() && _zeroCopyStreams.front().first <= completed)
     {
-        return ": BZ_SEQUENCE_ERROR";
+        if(_zeroCopyStreams.front().second.adopted)
+        {
+            delete _zeroCopyStreams.front().second.stream;
+        }
+        _zeroCopyStreams.pop_front();
     }
-    else if(bzError == BZ_PARAM_ERROR)
+}
+
+AsyncStatus
+Ice::ConnectionI::sendMessage(OutgoingMessage& message)
+{
+    assert(_state < StateClosed);
+
+    message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
+
+    if(_peerFragments && _fragmentSize > 0 && !message.fragmentId && message.stream->b.size() > _fragmentSize &&
+       canFragment(message.stream->b.size()))
     {
-        return ": BZ_PARAM_ERROR";
+        //
+        // Send the message in fragments. Once a fragment is sent, the next fragment is queued
+        // after the messages queued in the meantime, this way a large message doesn't delay the
+        // other messages sent over the connection.
+        //
+        prepareMessage(message);
+        message.fragmentId = _nextFragmentId++;
+        if(_nextFragmentId <= 0)
+        {
+            _nextFragmentId = 1;
+        }
+        _fragmentedStreams.push_back(message);
+        _fragmentedStreams.back().adopt(0);
+
+        //
+        // Keep sending fragments while they can be sent without blocking, the fragmented message
+        // is removed from the fragmented streams once its last fragment is created.
+        //
+        AsyncStatus status;
+        do
+        {
+            OutputStream os(_instance.get(), Ice::currentProtocolEncoding);
+            OutgoingMessage fragment = createFragment(_fragmentedStreams.end() - 1, os);
+            status = sendMessage(fragment);
+        }
+        while((status & AsyncStatusSent) && !_fragmentedStreams.empty() &&
+              _fragmentedStreams.back().fragmentId == message.fragmentId);
+        return status;
     }
-    else if(bzError == BZ_MEM_ERROR)
+
+    if(!_sendStreams.empty())
     {
-        return ": BZ_MEM_ERROR";
+        _sendStreams.push_back(message);
+        _sendStreams.back().adopt(0);
+        return AsyncStatusQueued;
     }
-    else if(bzError == BZ_DATA_ERROR)
+
+    //
+    // Attempt to send the message without blocking. If the send blocks, we register
+    // the connection with the selector thread.
+    //
+
+    prepareMessage(message);
+
+    //
+    // Send the message without blocking.
+    //
+    if(_observer)
     {
-        return ": BZ_DATA_ERROR";
+        _observer.startWrite(*message.stream);
     }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    SocketOperation op = write(*message.stream);
+    if(!op)
     {
-        return ": BZ_DATA_ERROR_MAGIC";
+        if(_observer)
+        {
+            _observer.finishWrite(*message.stream);
+        }
+        if(_zeroCopy)
+        {
+            retainZeroCopyStream(message);
+        }
+        AsyncStatus status = AsyncStatusSent;
+        if(message.sent())
+        {
+            status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
+        }
+        if(_acmLastActivity != IceUtil::Time())
+        {
+            _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+        return status;
     }
-    else if(bzError == BZ_IO_ERROR)
+
+    _sendStreams.push_back(message);
+    _sendStreams.back().adopt(0); // Adopt the stream.
+
+    _writeStream.swap(*_sendStreams.back().stream);
+    scheduleTimeout(op);
+    _threadPool->_register(ICE_SHARED_FROM_THIS, op);
+    return AsyncStatusQueued;
+}
+
+CompressionCodecPtr
+Ice::ConnectionI::getCompressionCodec(OutgoingMessage& message) const
+{
+    if(!message.compress || message.stream->b.size() < 100) // Only compress messages larger than 100 bytes.
     {
-        return ": BZ_IO_ERROR";
+        return 0;
     }
-    else if(bzError == BZ_UNEXPECTED_EOF)
+
+    CompressionCodecPtr codec = _instance->getCompressionCodec(message.codec);
+    if(!codec && message.codec != 0)
     {
-        return ": BZ_UNEXPECTED_EOF";
+        message.codec = 0; // Fallback to bzip2.
+        codec = _instance->getCompressionCodec(0);
     }
-    else if(bzError == BZ_OUTBUFF_FULL)
+    return codec;
+}
+
+bool
+Ice::ConnectionI::compressMessage(OutgoingMessage& message, const CompressionCodecPtr& codec, OutputStream& compressed)
+{
+    //
+    // This is called without holding the connection lock, it only uses state which
+    // doesn't change once the connection is created.
+    //
+    // With the adaptive compression policy, requests are sampled per operation and other
+    // messages per connection.
+    //
+    string operation;
+    if(_compressionPolicy)
     {
-        return ": BZ_OUTBUFF_FULL";
+        operation = getRequestOperation(_instance.get(), *message.stream);
+        if(!_compressionPolicy->compress(operation))
+        {
+            return false;
+        }
     }
-    else
+
+    //
+    // Message compressed. Request compressed response, if any.
+    //
+    message.stream->b[9] = static_cast<Byte>(2 * message.codec + 2);
+
+    //
+    // Do compression.
+    //
+    doCompress(codec, *message.stream, compressed);
+
+    if(_compressionPolicy &&
+       !_compressionPolicy->sample(operation, message.stream->b.size(), compressed.b.size()))
     {
-        return "";
+        return false;
     }
+
+    traceSend(*message.stream, _logger, _traceLevels);
+
+    //
+    // The message is sent with the compressed stream, it's adopted if the message is queued.
+    //
+    message.stream = &compressed;
+    message.prepared = true;
+    return true;
 }
 
 void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
+Ice::ConnectionI::setPeerCompressionCodecs(Byte codecs)
+{
+    _peerCodecs = static_cast<Byte>(_peerCodecs | codecs);
+    _compressCodec = (_peerCodecs & (1 << _preferredCodec)) ? _preferredCodec : 0;
+}
+
+void
+Ice::ConnectionI::doCompress(const CompressionCodecPtr& codec, OutputStream& uncompressed, OutputStream& compressed)
 {
     const Byte* p;
 
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    size_t compressedLen = codec->compressBound(uncompressedLen);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
+    compressedLen = codec->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                    &compressed.b[0] + headerSize + sizeof(Int), compressedLen,
+                                    _compressionLevel);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-
     //
     // Write the size of the compressed stream into the header of the
     // uncompressed stream. Since the header will be copied, this size
@@ -3206,7 +4121,7 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(const CompressionCodecPtr& codec, InputStream& compressed, InputStream& uncompressed)
 {
     Int uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3222,21 +4137,11 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(Int));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
+    codec->uncompress(&compressed.b[0] + headerSize + sizeof(Int), compressed.b.size() - headerSize - sizeof(Int),
+                      &uncompressed.b[0] + headerSize, static_cast<size_t>(uncompressedSize - headerSize));
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& requestId, Byte& compress,
@@ -3247,6 +4152,13 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
     assert(_state > StateNotValidated && _state < StateClosed);
 
     _readStream.swap(stream);
+
+    //
+    // The stream swapped in might hold the buffer of a large message read by this
+    // thread earlier. Return it to the buffer pool and read the next header into a
+    // small pooled buffer rather than keeping the large buffer with the connection.
+    //
+    _readStream.b.clear();
     _readStream.resize(headerSize);
     _readStream.i = _readStream.b.begin();
     _readHeader = true;
@@ -3266,15 +4178,17 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress > 0 && messageType != validateConnectionMsg)
         {
-#ifdef ICE_HAS_BZIP2
-            InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
-            stream.b.swap(ustream.b);
-#else
-            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
-#endif
+            //
+            // The peer supports the codec used by the message, we can use it for our requests.
+            //
+            Byte id = static_cast<Byte>((compress - 1) / 2);
+            if(id < maxCompressionCodecs && !(_peerCodecs & (1 << id)))
+            {
+                setPeerCompressionCodecs(static_cast<Byte>(1 << id));
+            }
+
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3356,35 +4270,26 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
-
-                if(_asyncRequestsHint != _asyncRequests.end())
+                if(stream.i < stream.b.end() && *stream.i == replyChunk)
                 {
-                    if(_asyncRequestsHint->first == requestId)
+                    //
+                    // A chunk of a streamed result, the request remains outstanding until
+                    // its reply. Stop reading if the consumer of the chunks is behind, the
+                    // request resumes reading once enough chunks are consumed.
+                    //
+                    ++stream.i;
+                    OutgoingAsyncBasePtr request = _asyncRequests.get(requestId);
+                    OutgoingAsync* og = dynamic_cast<OutgoingAsync*>(request.get());
+                    if(og && !og->chunk(stream, ICE_SHARED_FROM_THIS, ICE_NULLPTR))
                     {
-                        q = _asyncRequestsHint;
+                        _readSuspended = true;
                     }
+                    break;
                 }
 
-                if(q == _asyncRequests.end())
-                {
-                    q = _asyncRequests.find(requestId);
-                }
-
-                if(q != _asyncRequests.end())
+                outAsync = _asyncRequests.remove(requestId);
+                if(outAsync)
                 {
-                    outAsync = q->second;
-
-                    if(q == _asyncRequestsHint)
-                    {
-                        _asyncRequests.erase(q++);
-                        _asyncRequestsHint = q;
-                    }
-                    else
-                    {
-                        _asyncRequests.erase(q);
-                    }
-
                     stream.swap(*outAsync->getIs());
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -3426,7 +4331,13 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
             case validateConnectionMsg:
             {
                 traceRecv(stream, _logger, _traceLevels);
-                if(_heartbeatCallback)
+                if(compress & (fragmentationSupported | serverBusySupported))
+                {
+                    // Not a heartbeat.
+                    _peerFragments = (compress & fragmentationSupported) && !_endpoint->datagram();
+                    _peerServerBusy = (compress & serverBusySupported) != 0;
+                }
+                else if(_heartbeatCallback)
                 {
                     heartbeatCallback = _heartbeatCallback;
                     ++dispatchCount;
@@ -3457,18 +4368,20 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         }
     }
 
-    return _state == StateHolding ? SocketOperationNone : SocketOperationRead;
+    return _state == StateHolding || _readSuspended ? SocketOperationNone : SocketOperationRead;
 }
 
 void
 Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
-                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter)
+                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                            const IceUtil::Time& received, const ConcurrencyLimiterPtr& concurrencyLimiter)
 {
     //
     // Note: In contrast to other private or protected methods, this
     // operation must be called *without* the mutex locked.
     //
 
+    const Int admitted = invokeNum;
     try
     {
         while(invokeNum > 0)
@@ -3484,7 +4397,46 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
             //
             // Dispatch the invocation.
             //
-            in.invoke(servantManager, &stream);
+            in.invoke(servantManager, &stream, received);
+
+            --invokeNum;
+        }
+
+        stream.clear();
+    }
+    catch(const LocalException& ex)
+    {
+        invokeException(requestId, ex, invokeNum, false);  // Fatal invocation exception
+    }
+
+    //
+    // The dispatch latency includes the time spent waiting for a thread. An AMD request
+    // is completed once its dispatch returns.
+    //
+    if(concurrencyLimiter)
+    {
+        concurrencyLimiter->release(admitted, IceUtil::Time::now(IceUtil::Time::Monotonic) - received);
+    }
+}
+
+void
+Ice::ConnectionI::rejectAll(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
+                            const ObjectAdapterPtr& adapter, bool peerServerBusy)
+{
+    //
+    // Note: In contrast to other private or protected methods, this
+    // operation must be called *without* the mutex locked.
+    //
+
+    try
+    {
+        while(invokeNum > 0)
+        {
+            bool response = !_endpoint->datagram() && requestId != 0;
+            assert(!response || invokeNum == 1);
+
+            Incoming in(_instance.get(), this, this, adapter, response, compress, requestId);
+            in.reject(&stream, peerServerBusy);
 
             --invokeNum;
         }
@@ -3656,6 +4608,78 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::writeQueued()
+{
+    //
+    // Write the current message together with the messages queued after it, up to the
+    // write coalesce size. This allows many small messages to be sent with a single
+    // system call. With datagram transceivers, each message is sent as a separate
+    // datagram.
+    //
+    assert(!_sendStreams.empty());
+    _writeBuffers.clear();
+    size_t size = static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+    for(deque<OutgoingMessage>::iterator p = _sendStreams.begin() + 1;
+        p != _sendStreams.end() && size < _writeCoalesceSize; ++p)
+    {
+        if(!p->stream->i)
+        {
+            prepareMessage(*p);
+        }
+        size_t sz = static_cast<size_t>(p->stream->b.end() - p->stream->i);
+        if(size + sz > _writeCoalesceSize)
+        {
+            break;
+        }
+        size += sz;
+        _writeBuffers.push_back(p->stream);
+    }
+
+    if(_writeBuffers.empty())
+    {
+        return write(_writeStream);
+    }
+
+    vector<Buffer::Container::iterator> starts;
+    starts.reserve(_writeBuffers.size());
+    for(vector<Buffer*>::const_iterator p = _writeBuffers.begin(); p != _writeBuffers.end(); ++p)
+    {
+        starts.push_back((*p)->i);
+    }
+
+    Buffer::Container::iterator start = _writeStream.i;
+    SocketOperation op = _transceiver->writev(_writeStream, _writeBuffers);
+
+    //
+    // The bytes written for the current message are reported to the observer once its write
+    // is finished, the bytes written for the coalesced messages are reported now.
+    //
+    size_t sent = static_cast<size_t>(_writeStream.i - start);
+    for(size_t i = 0; i < _writeBuffers.size(); ++i)
+    {
+        size_t n = static_cast<size_t>(_writeBuffers[i]->i - starts[i]);
+        if(n > 0 && _observer)
+        {
+            _observer->sentBytes(static_cast<int>(n));
+        }
+        sent += n;
+    }
+    _writeBuffers.clear();
+
+    if(_instance->traceLevels()->network >= 3 && sent > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << sent;
+        if(!_endpoint->datagram())
+        {
+            out << " of " << size;
+        }
+        out << " bytes via " << _endpoint->protocol() << "\n" << toString();
+    }
+    return op;
+}
+
 void
 ConnectionI::reap()
 {
@@ -9,7 +9,7 @@
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Time.h>
 #include <IceUtil/StopWatch.h>
-#include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <Ice/UniquePtr.h>
 
 #include <Ice/CommunicatorF.h>
@@ -20,6 +20,8 @@
 #include <Ice/TransceiverF.h>
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/ServantManagerF.h>
+#include <Ice/DispatchLanesF.h>
+#include <Ice/ConcurrencyLimiterF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/ConnectorF.h>
 #include <Ice/LoggerF.h>
@@ -33,16 +35,14 @@
 #include <Ice/ConnectionAsync.h>
 #include <Ice/BatchRequestQueueF.h>
 #include <Ice/ACM.h>
+#include <Ice/RequestTable.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 
-#include <deque>
+#include <Ice/CompressionCodecI.h>
 
-#if !defined(ICE_OS_UWP)
-#    ifndef ICE_HAS_BZIP2
-#        define ICE_HAS_BZIP2
-#    endif
-#endif
+#include <deque>
+#include <map>
 
 namespace Ice
 {
@@ -67,6 +67,10 @@ class ConnectionI : public Connection,
         void finishRead(const IceInternal::Buffer&);
         void startWrite(const IceInternal::Buffer&);
         void finishWrite(const IceInternal::Buffer&);
+        void compressed();
+        void compressionSkipped();
+        void sendQueueChanged(Ice::Int, Ice::Long);
+        void sendQueueFull();
 
         void attach(const Ice::Instrumentation::ConnectionObserverPtr&);
 
@@ -88,7 +92,8 @@ public:
     struct OutgoingMessage
     {
         OutgoingMessage(Ice::OutputStream* str, bool comp) :
-            stream(str), compress(comp), requestId(0), adopted(false)
+            stream(str), compress(comp), codec(0), requestId(0), fragmentId(0), adopted(false), prepared(false),
+            requestSize(0)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -97,7 +102,8 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, Ice::OutputStream* str,
                         bool comp, int rid) :
-            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), outAsync(o), compress(comp), codec(0), requestId(rid), fragmentId(0), adopted(false),
+            prepared(false), requestSize(0)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -112,8 +118,12 @@ public:
         Ice::OutputStream* stream;
         IceInternal::OutgoingAsyncBasePtr outAsync;
         bool compress;
+        Byte codec;
         int requestId;
+        int fragmentId; // The ID of the fragmented message if the message is fragmented or a fragment.
         bool adopted;
+        bool prepared; // True if the message was compressed before being queued.
+        size_t requestSize; // The size accounted in the send queue limits, 0 for messages not limited.
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
         bool isSent;
         bool invokeSent;
@@ -155,6 +165,7 @@ public:
 
     bool isActiveOrHolding() const;
     bool isFinished() const;
+    size_t getOutstandingRequestCount() const; // The number of requests waiting to be sent or for their reply.
 
     virtual void throwException() const; // From Connection. Throws the connection exception if destroyed.
 
@@ -212,6 +223,9 @@ public:
     virtual void sendNoResponse();
     virtual bool systemException(Int, const SystemException&, bool);
     virtual void invokeException(Ice::Int, const LocalException&, int, bool);
+    virtual bool sendResponseChunk(Int, Ice::OutputStream*, Byte, const ICE_DELEGATE(ChunkReadyCallback)&);
+
+    void resumeReading();
 
     IceInternal::EndpointIPtr endpoint() const;
     IceInternal::ConnectorPtr connector() const;
@@ -221,7 +235,8 @@ public:
     virtual EndpointPtr getEndpoint() const ICE_NOEXCEPT; // From Connection.
     virtual ObjectPrxPtr createProxy(const Identity& ident) const; // From Connection.
 
-    void setAdapterAndServantManager(const ObjectAdapterPtr&, const IceInternal::ServantManagerPtr&);
+    void setAdapterAndServantManager(const ObjectAdapterPtr&, const IceInternal::ServantManagerPtr&,
+                                     const IceInternal::DispatchLanesPtr&, const IceInternal::ConcurrencyLimiterPtr&);
 
     //
     // Operations from EventHandler
@@ -249,7 +264,8 @@ public:
     void dispatch(const StartCallbackPtr&, const std::vector<OutgoingMessage>&, Byte, Int, Int,
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
-                  const ICE_DELEGATE(HeartbeatCallback)&, Ice::InputStream&);
+                  const ICE_DELEGATE(HeartbeatCallback)&, Ice::InputStream&, const IceUtil::Time&,
+                  const IceInternal::ConcurrencyLimiterPtr&);
     void finish(bool);
 
     void closeCallback(const ICE_DELEGATE(CloseCallback)&);
@@ -291,19 +307,32 @@ private:
     bool initialize(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
+    bool sendQueueFull() const;
+    void sendQueueChanged(Ice::Int, Ice::Long);
+    void sendWaitingRequests();
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
-
-#ifdef ICE_HAS_BZIP2
-    void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-    void doUncompress(Ice::InputStream&, Ice::InputStream&);
-#endif
+    void prepareMessage(OutgoingMessage&);
+    OutgoingMessage createFragment(std::deque<OutgoingMessage>::iterator, Ice::OutputStream&);
+    bool canFragment(size_t) const;
+    void queueNextFragment(int);
+    bool reassembleFragment();
+    void retainZeroCopyStream(OutgoingMessage&, Ice::OutputStream* = 0);
+    void releaseZeroCopyStreams(bool);
+
+    CompressionCodecPtr getCompressionCodec(OutgoingMessage&) const;
+    bool compressMessage(OutgoingMessage&, const CompressionCodecPtr&, Ice::OutputStream&);
+    void doCompress(const CompressionCodecPtr&, Ice::OutputStream&, Ice::OutputStream&);
+    void doUncompress(const CompressionCodecPtr&, Ice::InputStream&, Ice::InputStream&);
+    void setPeerCompressionCodecs(Byte);
 
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, Int&, Int&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
                                               IceInternal::OutgoingAsyncBasePtr&, ICE_DELEGATE(HeartbeatCallback)&, int&);
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
-                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceUtil::Time&,
+                   const IceInternal::ConcurrencyLimiterPtr&);
+    void rejectAll(Ice::InputStream&, Int, Int, Byte, const ObjectAdapterPtr&, bool);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -313,6 +342,7 @@ private:
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+    IceInternal::SocketOperation writeQueued();
 
     void reap();
 
@@ -336,13 +366,15 @@ private:
 
     ObjectAdapterPtr _adapter;
     IceInternal::ServantManagerPtr _servantManager;
+    IceInternal::DispatchLanesPtr _dispatchLanes;
+    IceInternal::ConcurrencyLimiterPtr _concurrencyLimiter;
 
     const bool _dispatcher;
     const LoggerPtr _logger;
     const IceInternal::TraceLevelsPtr _traceLevels;
     const IceInternal::ThreadPoolPtr _threadPool;
 
-    const IceUtil::TimerPtr _timer;
+    const IceInternal::TimerWheelPtr _timer;
     const IceUtil::TimerTaskPtr _writeTimeout;
     bool _writeTimeoutScheduled;
     const IceUtil::TimerTaskPtr _readTimeout;
@@ -356,11 +388,14 @@ private:
     IceUtil::Time _acmLastActivity;
 
     const int _compressionLevel;
+    Byte _preferredCodec; // The codec to compress requests with, if supported by the peer.
+    Byte _peerCodecs; // Bit mask of the codecs supported by the peer.
+    Byte _compressCodec; // The codec used to compress requests.
+    IceInternal::UniquePtr<IceInternal::CompressionPolicy> _compressionPolicy;
 
     Int _nextRequestId;
 
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+    IceInternal::RequestTable _asyncRequests;
 
     IceInternal::UniquePtr<LocalException> _exception;
 
@@ -368,6 +403,39 @@ private:
     IceInternal::BatchRequestQueuePtr _batchRequestQueue;
 
     std::deque<OutgoingMessage> _sendStreams;
+    const size_t _writeCoalesceSize; // Maximum number of bytes to write at once with queued messages.
+    std::vector<IceInternal::Buffer*> _writeBuffers;
+    bool _zeroCopy;
+    Ice::Long _zeroCopySent;
+    std::deque<std::pair<Ice::Long, OutgoingMessage> > _zeroCopyStreams; // Streams waiting for zero-copy sends.
+
+    const size_t _fragmentSize; // Messages larger than this size are fragmented, 0 if fragmentation is disabled.
+    bool _peerFragments; // True if the peer reassembles fragmented messages.
+    bool _peerServerBusy; // True if the peer understands the server busy reply status.
+    int _nextFragmentId;
+    std::deque<OutgoingMessage> _fragmentedStreams; // Messages being sent in fragments.
+    struct FragmentedMessage
+    {
+        FragmentedMessage(size_t sz) : size(sz)
+        {
+        }
+
+        IceInternal::Buffer buffer; // The fragments received so far.
+        const size_t size; // The size of the reassembled message.
+    };
+    std::map<Int, FragmentedMessage*> _fragments; // Messages being reassembled, indexed by fragment ID.
+    size_t _fragmentsSize; // Number of bytes received for the messages being reassembled.
+
+    const size_t _streamChunkWindow; // Maximum number of queued chunks of streamed results.
+    bool _readSuspended; // True if reading is suspended until the queued chunks are consumed.
+    std::vector<ICE_DELEGATE(ChunkReadyCallback)> _chunkReadyCallbacks; // Called once the chunk window drains.
+
+    const size_t _sendQueueSizeMax; // Maximum number of bytes of queued requests, 0 if unlimited.
+    const size_t _sendQueueLengthMax; // Maximum number of queued requests, 0 if unlimited.
+    const bool _sendQueueWait; // True if requests wait for the send queue to drain when it's full.
+    size_t _sendQueueSize; // Number of bytes of the requests queued for sending.
+    size_t _sendQueueLength; // Number of requests queued for sending.
+    std::deque<OutgoingMessage> _waitingRequests; // Requests waiting for the send queue to drain.
 
     Ice::InputStream _readStream;
     bool _readHeader;
@@ -0,0 +1,111 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/DispatchDeadline.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+const string IceInternal::deadlineContextKey = "_deadline";
+
+namespace
+{
+
+#ifdef _WIN32
+DWORD deadlineKey;
+#else
+pthread_key_t deadlineKey;
+#endif
+bool deadlineKeyCreated = false;
+
+class Init
+{
+public:
+
+    Init()
+    {
+#ifdef _WIN32
+        deadlineKey = TlsAlloc();
+        deadlineKeyCreated = deadlineKey != TLS_OUT_OF_INDEXES;
+#else
+        deadlineKeyCreated = pthread_key_create(&deadlineKey, 0) == 0;
+#endif
+    }
+
+    ~Init()
+    {
+        if(deadlineKeyCreated)
+        {
+            deadlineKeyCreated = false;
+#ifdef _WIN32
+            TlsFree(deadlineKey);
+#else
+            pthread_key_delete(deadlineKey);
+#endif
+        }
+    }
+};
+
+Init init;
+
+void*
+getDeadline()
+{
+#ifdef _WIN32
+    return TlsGetValue(deadlineKey);
+#else
+    return pthread_getspecific(deadlineKey);
+#endif
+}
+
+void
+setDeadline(void* deadline)
+{
+#ifdef _WIN32
+    TlsSetValue(deadlineKey, deadline);
+#else
+    pthread_setspecific(deadlineKey, deadline);
+#endif
+}
+
+}
+
+IceInternal::DispatchDeadline::DispatchDeadline(const IceUtil::Time& deadline) :
+    _previous(0)
+{
+    //
+    // The thread-specific value points to the deadline, which must outlive this object.
+    //
+    if(deadlineKeyCreated)
+    {
+        _previous = getDeadline();
+        setDeadline(const_cast<IceUtil::Time*>(&deadline));
+    }
+}
+
+IceInternal::DispatchDeadline::~DispatchDeadline()
+{
+    if(deadlineKeyCreated)
+    {
+        setDeadline(_previous);
+    }
+}
+
+IceUtil::Time
+IceInternal::DispatchDeadline::current()
+{
+    if(deadlineKeyCreated)
+    {
+        IceUtil::Time* deadline = static_cast<IceUtil::Time*>(getDeadline());
+        if(deadline)
+        {
+            return *deadline;
+        }
+    }
+    return IceUtil::Time();
+}
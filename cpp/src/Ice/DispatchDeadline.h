@@ -0,0 +1,47 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_DISPATCH_DEADLINE_H
+#define ICE_DISPATCH_DEADLINE_H
+
+#include <IceUtil/Time.h>
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// The context entry which carries the remaining time in milliseconds before the
+// caller of a twoway invocation gives up. The deadline of the request is computed
+// from the time the request is received, requests received after their deadline
+// are dropped without being dispatched.
+//
+extern const std::string deadlineContextKey;
+
+//
+// Sets the deadline of the request dispatched by the calling thread for the
+// lifetime of this object. Twoway invocations made by the thread inherit the
+// deadline.
+//
+class DispatchDeadline : private IceUtil::noncopyable
+{
+public:
+
+    DispatchDeadline(const IceUtil::Time&);
+    ~DispatchDeadline();
+
+    //
+    // Returns the deadline of the request dispatched by the calling thread, or
+    // a zero time if it doesn't have a deadline.
+    //
+    static IceUtil::Time current();
+
+private:
+
+    void* _previous;
+};
+
+}
+
+#endif
@@ -0,0 +1,314 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/DispatchLanes.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+#include <Ice/InputStream.h>
+#include <Ice/Protocol.h>
+
+#include <set>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(DispatchLanes* p) { return p; }
+
+namespace
+{
+
+const string defaultLane = "Default";
+
+//
+// Dispatches a request of a lane and notifies the lanes once the dispatch
+// returns, to hand over the next waiting request to the thread pool.
+//
+class LaneWorkItem : public DispatchWorkItem
+{
+public:
+
+    LaneWorkItem(const DispatchLanesPtr& lanes, const DispatchWorkItemPtr& workItem) :
+        DispatchWorkItem(workItem->getConnection()),
+        _lanes(lanes),
+        _workItem(workItem)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            _workItem->run();
+        }
+        catch(...)
+        {
+            _lanes->completed();
+            throw;
+        }
+        _lanes->completed();
+    }
+
+private:
+
+    const DispatchLanesPtr _lanes;
+    const DispatchWorkItemPtr _workItem;
+};
+
+}
+
+DispatchLanesPtr
+IceInternal::DispatchLanes::create(const InstancePtr& instance, const string& adapterName,
+                                   const ThreadPoolPtr& threadPool)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    const string prefix = adapterName + ".Lane.";
+
+    set<string> names;
+    PropertyDict dict = properties->getPropertiesForPrefix(prefix);
+    for(PropertyDict::const_iterator p = dict.begin(); p != dict.end(); ++p)
+    {
+        string::size_type pos = p->first.rfind('.');
+        if(pos > prefix.size())
+        {
+            names.insert(p->first.substr(prefix.size(), pos - prefix.size()));
+        }
+    }
+    names.erase(defaultLane);
+    if(names.empty())
+    {
+        return 0;
+    }
+
+    if(threadPool->serialize())
+    {
+        Warning out(instance->initializationData().logger);
+        out << "the dispatch lanes of object adapter `" << adapterName << "' are disabled:\n";
+        out << "the requests are serialized by " << threadPool->prefix();
+        return 0;
+    }
+
+    vector<Lane> lanes;
+    map<string, size_t> operations;
+    map<string, size_t> categories;
+    names.insert(defaultLane);
+    lanes.push_back(Lane(defaultLane, 1));
+    for(set<string>::const_iterator p = names.begin(); p != names.end(); ++p)
+    {
+        size_t index = *p == defaultLane ? 0 : lanes.size();
+        if(index != 0)
+        {
+            lanes.push_back(Lane(*p, 1));
+        }
+
+        int weight = properties->getPropertyAsIntWithDefault(prefix + *p + ".Weight", 1);
+        if(weight < 1)
+        {
+            Warning out(instance->initializationData().logger);
+            out << prefix << *p << ".Weight < 1; Weight adjusted to 1";
+            weight = 1;
+        }
+        lanes[index].weight = weight;
+
+        StringSeq ops = properties->getPropertyAsList(prefix + *p + ".Operations");
+        for(StringSeq::const_iterator q = ops.begin(); q != ops.end(); ++q)
+        {
+            operations.insert(make_pair(*q, index));
+        }
+
+        StringSeq cats = properties->getPropertyAsList(prefix + *p + ".Categories");
+        for(StringSeq::const_iterator q = cats.begin(); q != cats.end(); ++q)
+        {
+            categories.insert(make_pair(*q, index));
+        }
+    }
+
+    return new DispatchLanes(threadPool, lanes, operations, categories,
+                             properties->getProperty(adapterName + ".LaneContext"));
+}
+
+IceInternal::DispatchLanes::DispatchLanes(const ThreadPoolPtr& threadPool, const vector<Lane>& lanes,
+                                          const map<string, size_t>& operations,
+                                          const map<string, size_t>& categories, const string& context) :
+    _threadPool(threadPool),
+    _dispatchMax(static_cast<size_t>(threadPool->dispatchThreads())),
+    _operations(operations),
+    _categories(categories),
+    _context(context),
+    _lanes(lanes),
+    _dispatching(0)
+{
+}
+
+size_t
+IceInternal::DispatchLanes::classify(InputStream& stream) const
+{
+    //
+    // The request header is read with a stream sharing the buffer of the message, the
+    // message is read again by the dispatch. A batch request is classified with its
+    // first request.
+    //
+    InputStream is(stream.instance(), currentProtocolEncoding, stream, false);
+    is.pos(stream.pos());
+    try
+    {
+        Identity id;
+        is.read(id);
+        StringSeq facetPath;
+        is.read(facetPath);
+        string operation;
+        is.read(operation, false);
+
+        if(!_context.empty())
+        {
+            Byte mode;
+            is.read(mode);
+            Int sz = is.readSize();
+            while(sz--)
+            {
+                string key;
+                string value;
+                is.read(key);
+                is.read(value);
+                if(key == _context)
+                {
+                    for(size_t i = 0; i < _lanes.size(); ++i)
+                    {
+                        if(_lanes[i].name == value)
+                        {
+                            return i;
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        map<string, size_t>::const_iterator p = _operations.find(operation);
+        if(p != _operations.end())
+        {
+            return p->second;
+        }
+
+        p = _categories.find(id.category);
+        if(p != _categories.end())
+        {
+            return p->second;
+        }
+    }
+    catch(const Ice::LocalException&)
+    {
+        // Ignore, the dispatch reports the invalid request.
+    }
+    return 0;
+}
+
+void
+IceInternal::DispatchLanes::queue(size_t lane, const DispatchWorkItemPtr& workItem)
+{
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        assert(lane < _lanes.size());
+        if(_dispatching >= _dispatchMax)
+        {
+            _lanes[lane].requests.push_back(workItem);
+            return;
+        }
+        ++_dispatching;
+    }
+    dispatch(workItem);
+}
+
+void
+IceInternal::DispatchLanes::completed()
+{
+    DispatchWorkItemPtr workItem;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        workItem = next();
+        if(!workItem)
+        {
+            --_dispatching;
+            return;
+        }
+    }
+    dispatch(workItem);
+}
+
+void
+IceInternal::DispatchLanes::destroy()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    for(vector<Lane>::iterator p = _lanes.begin(); p != _lanes.end(); ++p)
+    {
+        p->requests.clear();
+    }
+    _threadPool = 0;
+}
+
+void
+IceInternal::DispatchLanes::dispatch(const DispatchWorkItemPtr& workItem)
+{
+    ThreadPoolPtr threadPool;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        threadPool = _threadPool;
+    }
+
+    try
+    {
+        if(threadPool)
+        {
+            threadPool->dispatch(new LaneWorkItem(this, workItem));
+            return;
+        }
+    }
+    catch(const Ice::CommunicatorDestroyedException&)
+    {
+    }
+
+    //
+    // The thread pool is destroyed, the request is dropped with its connection.
+    //
+    IceUtil::Mutex::Lock sync(*this);
+    --_dispatching;
+}
+
+DispatchWorkItemPtr
+IceInternal::DispatchLanes::next()
+{
+    //
+    // Smooth weighted round-robin among the lanes with waiting requests.
+    //
+    Lane* lane = 0;
+    int total = 0;
+    for(vector<Lane>::iterator p = _lanes.begin(); p != _lanes.end(); ++p)
+    {
+        if(!p->requests.empty())
+        {
+            p->current += p->weight;
+            total += p->weight;
+            if(!lane || p->current > lane->current)
+            {
+                lane = &*p;
+            }
+        }
+    }
+    if(!lane)
+    {
+        return 0;
+    }
+
+    lane->current -= total;
+    DispatchWorkItemPtr workItem = lane->requests.front();
+    lane->requests.pop_front();
+    if(lane->requests.empty())
+    {
+        lane->current = 0;
+    }
+    return workItem;
+}
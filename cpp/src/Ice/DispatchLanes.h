@@ -0,0 +1,82 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_DISPATCH_LANES_H
+#define ICE_DISPATCH_LANES_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <Ice/DispatchLanesF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ThreadPool.h>
+
+#include <deque>
+
+namespace IceInternal
+{
+
+//
+// The dispatch lanes of an object adapter, configured with the <adapter>.Lane.<name>
+// properties. A request is assigned to a lane by the value of the <adapter>.LaneContext
+// context entry, by its operation name or by the category of its identity; other
+// requests are assigned to the Default lane.
+//
+// At most one request per dispatch thread of the adapter's thread pool is handed over
+// to the thread pool, the other requests wait in the queue of their lane. Once a
+// dispatch completes, the next request is taken from the non-empty lanes with a smooth
+// weighted round-robin: under overload, each lane gets a share of the dispatch threads
+// proportional to its weight, and a request from a lane with few waiting requests is
+// dispatched without waiting for the requests queued in the other lanes.
+//
+class DispatchLanes : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    //
+    // Returns null if no lanes are configured for the adapter.
+    //
+    static DispatchLanesPtr create(const InstancePtr&, const std::string&, const ThreadPoolPtr&);
+
+    //
+    // Returns the lane of the request at the current position of the given stream.
+    //
+    size_t classify(Ice::InputStream&) const;
+
+    void queue(size_t, const DispatchWorkItemPtr&);
+    void completed();
+
+    void destroy();
+
+private:
+
+    struct Lane
+    {
+        Lane(const std::string& n, int w) : name(n), weight(w), current(0)
+        {
+        }
+
+        std::string name;
+        int weight;
+        int current;
+        std::deque<DispatchWorkItemPtr> requests;
+    };
+
+    DispatchLanes(const ThreadPoolPtr&, const std::vector<Lane>&, const std::map<std::string, size_t>&,
+                  const std::map<std::string, size_t>&, const std::string&);
+
+    void dispatch(const DispatchWorkItemPtr&);
+    DispatchWorkItemPtr next();
+
+    ThreadPoolPtr _threadPool;
+    const size_t _dispatchMax;
+    const std::map<std::string, size_t> _operations;
+    const std::map<std::string, size_t> _categories;
+    const std::string _context;
+    std::vector<Lane> _lanes;
+    size_t _dispatching;
+};
+
+}
+
+#endif
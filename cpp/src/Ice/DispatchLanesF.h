@@ -0,0 +1,19 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_DISPATCH_LANES_F_H
+#define ICE_DISPATCH_LANES_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class DispatchLanes;
+IceUtil::Shared* upCast(DispatchLanes*);
+typedef Handle<DispatchLanes> DispatchLanesPtr;
+
+}
+
+#endif
@@ -90,6 +90,12 @@ IceInternal::EndpointI::initWithOptions(vector<string>& args)
     args = unknown;
 }
 
+string
+IceInternal::EndpointI::compressionCodec() const
+{
+    return string();
+}
+
 bool
 IceInternal::EndpointI::checkOption(const string&, const string&, const string&)
 {
@@ -92,6 +92,12 @@ public:
     //
     virtual EndpointIPtr compress(bool) const = 0;
 
+    //
+    // Return the name of the codec used to compress requests, or an
+    // empty string to use the default codec.
+    //
+    virtual std::string compressionCodec() const;
+
     //
     // Return true if the endpoint is datagram-based.
     //
@@ -0,0 +1,111 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/EndpointLatencyTable.h>
+#include <Ice/EndpointI.h>
+#include <Ice/DefaultsAndOverrides.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(EndpointLatencyTable* p) { return p; }
+
+namespace
+{
+
+//
+// The weight of the round-trip time of a request in the moving average.
+//
+const double roundTripTimeWeight = 0.25;
+
+}
+
+IceInternal::EndpointLatencyTable::EndpointLatencyTable(const DefaultsAndOverridesPtr& overrides) :
+    _overrides(overrides)
+{
+}
+
+void
+IceInternal::EndpointLatencyTable::sent(const EndpointIPtr& endpoint)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    ++_stats[endpoint].outstanding;
+}
+
+void
+IceInternal::EndpointLatencyTable::completed(const EndpointIPtr& endpoint, const IceUtil::Time& roundTripTime,
+                                             bool ok)
+{
+    IceUtil::Mutex::Lock sync(*this);
+#ifdef ICE_CPP11_MAPPING
+    auto p = _stats.find(endpoint);
+#else
+    map<EndpointIPtr, Stats>::iterator p = _stats.find(endpoint);
+#endif
+    if(p == _stats.end())
+    {
+        return;
+    }
+
+    Stats& stats = p->second;
+    if(stats.outstanding > 0)
+    {
+        --stats.outstanding;
+    }
+
+    //
+    // A failed request doesn't lower the latency of the endpoint, it only raises it if
+    // the request took longer than the average (for example, if it timed out).
+    //
+    double ms = roundTripTime.toMilliSecondsDouble();
+    if(stats.roundTripTime == 0)
+    {
+        stats.roundTripTime = ms;
+    }
+    else if(ok || ms > stats.roundTripTime)
+    {
+        stats.roundTripTime += (ms - stats.roundTripTime) * roundTripTimeWeight;
+    }
+}
+
+void
+IceInternal::EndpointLatencyTable::select(vector<EndpointIPtr>& endpoints) const
+{
+    if(endpoints.size() < 2)
+    {
+        return;
+    }
+
+    IceUtil::Mutex::Lock sync(*this);
+    if(latency(endpoints[1]) < latency(endpoints[0]))
+    {
+        swap(endpoints[0], endpoints[1]);
+    }
+}
+
+double
+IceInternal::EndpointLatencyTable::latency(const EndpointIPtr& endpoint) const
+{
+    //
+    // The requests are tracked with the endpoint of their connection which has the
+    // timeout override, if set.
+    //
+#ifdef ICE_CPP11_MAPPING
+    auto p = _stats.find(_overrides->overrideTimeout ? endpoint->timeout(_overrides->overrideTimeoutValue) : endpoint);
+#else
+    map<EndpointIPtr, Stats>::const_iterator p =
+        _stats.find(_overrides->overrideTimeout ? endpoint->timeout(_overrides->overrideTimeoutValue) : endpoint);
+#endif
+    if(p == _stats.end())
+    {
+        return 1;
+    }
+
+    //
+    // One millisecond is added to the round-trip time so that the endpoints without
+    // completed requests are still ranked by their outstanding requests.
+    //
+    return (p->second.roundTripTime + 1) * (p->second.outstanding + 1);
+}
@@ -0,0 +1,69 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_ENDPOINT_LATENCY_TABLE_H
+#define ICE_ENDPOINT_LATENCY_TABLE_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/EndpointLatencyTableF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/DefaultsAndOverridesF.h>
+#include <Ice/Comparable.h>
+
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The latency of the endpoints used by proxies with the LeastLatency endpoint
+// selection. The latency of an endpoint is the moving average of the round-trip
+// time of its requests, weighted by the number of outstanding requests.
+//
+class EndpointLatencyTable : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointLatencyTable(const DefaultsAndOverridesPtr&);
+
+    //
+    // Called by the invocations with the endpoint of the connection of the request.
+    //
+    void sent(const EndpointIPtr&);
+    void completed(const EndpointIPtr&, const IceUtil::Time&, bool);
+
+    //
+    // Moves the endpoint with the lowest latency of the first two endpoints to the
+    // front of the given endpoints.
+    //
+    void select(std::vector<EndpointIPtr>&) const;
+
+private:
+
+    double latency(const EndpointIPtr&) const;
+
+    struct Stats
+    {
+        Stats() : roundTripTime(0), outstanding(0)
+        {
+        }
+
+        double roundTripTime; // Moving average in milliseconds, 0 until a request completed.
+        int outstanding;
+    };
+
+    const DefaultsAndOverridesPtr _overrides;
+#ifdef ICE_CPP11_MAPPING
+    std::map<EndpointIPtr, Stats, Ice::TargetCompare<EndpointIPtr, std::less>> _stats;
+#else
+    std::map<EndpointIPtr, Stats> _stats;
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,19 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_ENDPOINT_LATENCY_TABLE_F_H
+#define ICE_ENDPOINT_LATENCY_TABLE_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class EndpointLatencyTable;
+IceUtil::Shared* upCast(EndpointLatencyTable*);
+typedef Handle<EndpointLatencyTable> EndpointLatencyTablePtr;
+
+}
+
+#endif
@@ -23,7 +23,8 @@ IceInternal::EventHandler::EventHandler() :
     _disabled(SocketOperationNone),
 #endif
     _ready(SocketOperationNone),
-    _registered(SocketOperationNone)
+    _registered(SocketOperationNone),
+    _shard(0)
 {
 }
 
@@ -67,6 +67,7 @@ protected:
 #endif
     SocketOperation _ready;
     SocketOperation _registered;
+    ThreadPool* _shard; // The thread pool shard this handler is assigned to, if the thread pool is sharded.
 
     friend class ThreadPool;
     friend class ThreadPoolCurrent;
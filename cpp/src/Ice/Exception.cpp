@@ -518,6 +518,20 @@ Ice::InvocationCanceledException::ice_print(ostream& out) const
     out << ":\ninvocation canceled";
 }
 
+void
+Ice::SendQueueFullException::ice_print(ostream& out) const
+{
+    Exception::ice_print(out);
+    out << ":\nthe send queue of the connection is full";
+}
+
+void
+Ice::ServerBusyException::ice_print(ostream& out) const
+{
+    Exception::ice_print(out);
+    out << ":\nthe request was rejected by the server because the concurrency limit of the object adapter was reached";
+}
+
 void
 Ice::ProtocolException::ice_print(ostream& out) const
 {
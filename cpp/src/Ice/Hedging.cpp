@@ -0,0 +1,291 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Hedging.h>
+#include <Ice/Instance.h>
+#include <Ice/Reference.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/ReplyStatus.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+#ifndef ICE_CPP11_MAPPING
+IceUtil::Shared* IceInternal::upCast(Hedging* p) { return p; }
+#endif
+
+namespace
+{
+
+//
+// An attempt of a hedged invocation, it sends a copy of the request of the invocation
+// and hands over its reply to the hedging. It doesn't notify any callback.
+//
+class HedgedOutgoingAsync : public OutgoingAsync
+{
+public:
+
+    HedgedOutgoingAsync(const ObjectPrxPtr& proxy, const HedgingPtr& hedging, const OutputStream& request,
+                        OperationMode mode) :
+        OutgoingAsync(proxy, false)
+    {
+        _hedging = hedging;
+        _mode = mode;
+        _os.writeBlob(request.b.begin(), request.b.size());
+
+        //
+        // The connection of the invocation might have set the compression status of the
+        // request, the connection of the attempt sets it again if it compresses the request.
+        // The request ID is also set by the connection.
+        //
+        _os.b[9] = 0;
+    }
+
+    void
+    invoke()
+    {
+        invokeImpl(true); // userThread = true, the exception is raised if the attempt fails right away.
+    }
+
+    virtual bool
+    response()
+    {
+        latencyCompleted(true);
+        _hedging->reply(this);
+        return responseImpl(true, false);
+    }
+
+protected:
+
+    virtual bool handleSent(bool, bool)
+    {
+        return false;
+    }
+
+    virtual bool handleException(const Ice::Exception&)
+    {
+        return false;
+    }
+
+    virtual bool handleResponse(bool)
+    {
+        return false;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const
+    {
+    }
+};
+ICE_DEFINE_PTR(HedgedOutgoingAsyncPtr, HedgedOutgoingAsync);
+
+}
+
+IceInternal::Hedging::Hedging(const OutgoingAsyncPtr& outAsync, const ObjectPrxPtr& proxy, OperationMode mode) :
+    _instance(proxy->_getReference()->getInstance()),
+    _proxy(proxy),
+    _mode(mode),
+    _delay(IceUtil::Time::milliSeconds(proxy->_getReference()->getHedgingDelay())),
+    _maxAttempts(proxy->_getReference()->getHedgingMaxAttempts()),
+    _outAsync(outAsync),
+    _reply(0),
+    _sent(1),
+    _chunked(false)
+{
+}
+
+void
+IceInternal::Hedging::start()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_outAsync)
+    {
+        schedule(_delay);
+    }
+}
+
+void
+IceInternal::Hedging::chunk()
+{
+    //
+    // The chunks of a streamed result can't be merged from several attempts, the
+    // invocation or the attempt which received a chunk is left to complete.
+    //
+    IceUtil::Mutex::Lock sync(*this);
+    _chunked = true;
+}
+
+void
+IceInternal::Hedging::reply(OutgoingAsync* attempt)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(!_outAsync || _reply || _chunked)
+    {
+        return;
+    }
+
+    //
+    // Only a reply with the result of the operation completes the invocation, the
+    // invocation doesn't retry a request failure received with another connection.
+    //
+    InputStream* is = attempt->getIs();
+    if(is->i == is->b.end() || (*is->i != replyOK && *is->i != replyUserException))
+    {
+        return;
+    }
+
+    _reply = attempt;
+    schedule(IceUtil::Time()); // Cancel the invocation from the timer thread.
+}
+
+bool
+IceInternal::Hedging::takeReply(OutgoingAsync* outAsync, InputStream& is)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_outAsync.get() != outAsync || !_reply)
+    {
+        return false;
+    }
+    is.swap(*_reply->getIs());
+    _reply = 0;
+    return true;
+}
+
+void
+IceInternal::Hedging::completed(OutgoingAsync* outAsync)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_outAsync.get() != outAsync)
+    {
+        return;
+    }
+
+    _outAsync = 0;
+    _reply = 0;
+    if(_attempts.empty())
+    {
+        try
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+    }
+    else
+    {
+        schedule(IceUtil::Time()); // Cancel the remaining attempts from the timer thread.
+    }
+}
+
+void
+IceInternal::Hedging::runTimerTask()
+{
+    OutgoingAsyncPtr outAsync;
+    vector<OutgoingAsyncPtr> attempts;
+    HedgedOutgoingAsyncPtr attempt;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(!_outAsync)
+        {
+            _attempts.swap(attempts);
+        }
+        else if(_reply)
+        {
+            outAsync = _outAsync;
+        }
+        else if(!_chunked && _sent < _maxAttempts)
+        {
+            try
+            {
+                //
+                // The attempt uses its own connection and, if the proxy has several
+                // endpoints, starts with another endpoint than the previous attempts.
+                //
+                ostringstream os;
+                os << _proxy->ice_getConnectionId() << "-hedging-" << _sent;
+                ObjectPrxPtr proxy = _proxy->ice_connectionId(os.str());
+                EndpointSeq endpoints = proxy->ice_getEndpoints();
+                if(endpoints.size() > 1)
+                {
+                    size_t first = static_cast<size_t>(_sent) % endpoints.size();
+                    rotate(endpoints.begin(), endpoints.begin() + first, endpoints.end());
+                    proxy = proxy->ice_endpoints(endpoints)->ice_endpointSelection(
+                        ICE_ENUM(EndpointSelectionType, Ordered));
+                }
+
+                attempt = ICE_MAKE_SHARED(HedgedOutgoingAsync, proxy, ICE_SHARED_FROM_THIS, *_outAsync->getOs(), _mode);
+                _attempts.push_back(attempt);
+                if(++_sent < _maxAttempts)
+                {
+                    schedule(_delay);
+                }
+            }
+            catch(const Ice::LocalException&)
+            {
+                attempt = 0; // No more attempts.
+            }
+
+            if(attempt && _instance->traceLevels()->retry >= 1)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->retryCat);
+                out << "sending hedged request, attempt " << _sent << " of " << _maxAttempts;
+            }
+        }
+    }
+
+    if(outAsync)
+    {
+        outAsync->cancel(); // Completes the invocation with the reply of the attempt.
+    }
+
+    for(vector<OutgoingAsyncPtr>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
+    {
+        (*p)->cancel();
+    }
+
+    if(attempt)
+    {
+        try
+        {
+            attempt->invoke();
+        }
+        catch(const Ice::Exception&)
+        {
+            // Ignore, the invocation completes without this attempt.
+        }
+    }
+}
+
+void
+IceInternal::Hedging::schedule(const IceUtil::Time& delay)
+{
+    try
+    {
+        _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        _instance->timer()->schedule(ICE_SHARED_FROM_THIS, delay);
+    }
+    catch(const IceUtil::Exception&)
+    {
+        //
+        // The communicator is destroyed, the invocation and its attempts fail. The
+        // attempts are released here since the timer won't run this task anymore.
+        //
+        _outAsync = 0;
+        _reply = 0;
+        _attempts.clear();
+    }
+}
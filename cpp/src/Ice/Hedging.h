@@ -0,0 +1,80 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_HEDGING_H
+#define ICE_HEDGING_H
+
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ProxyF.h>
+
+namespace IceInternal
+{
+
+//
+// The hedging of an idempotent twoway invocation, see ice_hedging. If the invocation
+// didn't complete after the hedging delay, a copy of its request is sent over another
+// connection, up to the maximum number of attempts spaced by the delay. The attempts
+// use their own connection ID and, for proxies with several endpoints, start with a
+// different endpoint.
+//
+// The first reply completes the invocation: the invocation is canceled to remove its
+// request from its request handler, and it then completes with the reply of the attempt
+// instead of the cancellation exception, see ProxyOutgoingAsyncBase::hedgedResponse. The
+// remaining attempts are canceled once the invocation completes. If the invocation fails
+// before an attempt replies, it fails with its own exception. The failure of an attempt
+// is ignored.
+//
+// The request is only copied for an attempt, from the stream of the invocation which
+// keeps it until the invocation completes.
+//
+// The attempts are sent and canceled from the timer thread, the invocation and its
+// attempts might be completed with a connection locked.
+//
+class Hedging : public IceUtil::TimerTask, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+              , public std::enable_shared_from_this<Hedging>
+#endif
+{
+public:
+
+    Hedging(const OutgoingAsyncPtr&, const Ice::ObjectPrxPtr&, Ice::OperationMode);
+
+    //
+    // Schedules the first attempt, called once the invocation is sent.
+    //
+    void start();
+
+    //
+    // Called by the invocation and its attempts.
+    //
+    void chunk();
+    void reply(OutgoingAsync*);
+    bool takeReply(OutgoingAsync*, Ice::InputStream&);
+    void completed(OutgoingAsync*);
+
+    virtual void runTimerTask();
+
+private:
+
+    void schedule(const IceUtil::Time&);
+
+    const InstancePtr _instance;
+    const Ice::ObjectPrxPtr _proxy;
+    const Ice::OperationMode _mode;
+    const IceUtil::Time _delay;
+    const int _maxAttempts;
+
+    OutgoingAsyncPtr _outAsync; // Cleared once the invocation completed.
+    std::vector<OutgoingAsyncPtr> _attempts;
+    OutgoingAsync* _reply; // The first attempt which replied, it's kept alive by _attempts.
+    int _sent;
+    bool _chunked;
+};
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/HashUtil.h>
 #include <Ice/NetworkProxy.h>
+#include <Ice/InstrumentationI.h>
 #include <IceUtil/MutexPtrLock.h>
 
 using namespace std;
@@ -538,13 +539,57 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, Input
 #ifndef ICE_OS_UWP
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
-    _destroyed(false)
+    _size(0),
+    _hasPriority(false),
+    _priority(0),
+    _destroyed(false),
+    _idle(0)
 {
-    updateObserver();
+    PropertiesPtr properties = instance->initializationData().properties;
+
+    int size = properties->getPropertyAsIntWithDefault("Ice.HostResolver.Size", 4);
+    if(size < 1)
+    {
+        Warning out(instance->initializationData().logger);
+        out << "Ice.HostResolver.Size < 1; Size adjusted to 1";
+        size = 1;
+    }
+    const_cast<int&>(_size) = size;
+
+    //
+    // The cache isn't used with a network proxy, the connectors of an endpoint
+    // are created with the network proxy resolved by each lookup.
+    //
+    if(!instance->networkProxy())
+    {
+        int ttl = properties->getPropertyAsIntWithDefault("Ice.HostResolver.CacheTTL", 30);
+        const_cast<IceUtil::Time&>(_cacheTTL) = IceUtil::Time::seconds(max(ttl, 0));
+        ttl = properties->getPropertyAsIntWithDefault("Ice.HostResolver.NegativeCacheTTL", 5);
+        const_cast<IceUtil::Time&>(_negativeCacheTTL) = IceUtil::Time::seconds(max(ttl, 0));
+    }
+
+    const_cast<bool&>(_hasPriority) = properties->getProperty("Ice.ThreadPriority") != "";
+    const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
+
+    //
+    // The first thread is started right away, the other threads are started
+    // when there are more hosts to resolve than idle threads.
+    //
+    __setNoDelete(true);
+    try
+    {
+        Lock sync(*this);
+        startThread();
+    }
+    catch(...)
+    {
+        __setNoDelete(false);
+        throw;
+    }
+    __setNoDelete(false);
 }
 
 void
@@ -552,8 +597,9 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
                                            const IPEndpointIPtr& endpoint, const EndpointI_connectorsPtr& callback)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup. If this doesn't work, we look up the
+    // cache or queue a resolve entry and a thread will take care of getting the endpoint
+    // addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -574,11 +620,7 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    Lock sync(*this);
-    assert(!_destroyed);
-
     ResolveEntry entry;
-    entry.host = host;
     entry.port = port;
     entry.selType = selType;
     entry.endpoint = endpoint;
@@ -594,7 +636,44 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
-    _queue.push_back(entry);
+    if(lookupCache(host, entry))
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    assert(!_destroyed);
+
+    //
+    // If the host is already queued or being resolved, the entry is completed with
+    // the result of this lookup.
+    //
+    map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+    if(p != _pending.end())
+    {
+        EndpointLookupObserverI* observer = dynamic_cast<EndpointLookupObserverI*>(entry.observer.get());
+        if(observer)
+        {
+            observer->coalesced();
+        }
+        p->second.push_back(entry);
+        return;
+    }
+
+    _pending[host].push_back(entry);
+    _queue.push_back(host);
+    if(_idle < static_cast<int>(_queue.size()) && static_cast<int>(_threads.size()) < _size)
+    {
+        try
+        {
+            startThread();
+        }
+        catch(const IceUtil::Exception& ex)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "cannot create thread for `Ice.HostResolver':\n" << ex;
+        }
+    }
     notify();
 }
 
@@ -604,41 +683,68 @@ IceInternal::EndpointHostResolver::destroy()
     Lock sync(*this);
     assert(!_destroyed);
     _destroyed = true;
-    notify();
+    notifyAll();
+}
+
+void
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    assert(_destroyed);
+
+    //
+    // _threads is immutable after destroy() has been called, therefore no
+    // synchronization is needed.
+    //
+    for(vector<HelperThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::updateObservers()
+{
+    Lock sync(*this);
+    if(_destroyed)
+    {
+        return; // The threads might already be gone.
+    }
+    for(vector<HelperThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::run(const HelperThreadPtr& thread)
 {
     while(true)
     {
-        ResolveEntry r;
-        ThreadObserverPtr threadObserver;
+        string host;
         {
             Lock sync(*this);
+            thread->setState(ICE_ENUM(ThreadState, ThreadStateIdle));
+
+            ++_idle;
             while(!_destroyed && _queue.empty())
             {
                 wait();
             }
+            --_idle;
 
             if(_destroyed)
             {
                 break;
             }
 
-            r = _queue.front();
+            host = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
-        }
-
-        if(threadObserver)
-        {
-            threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateIdle), ICE_ENUM(ThreadState, ThreadStateInUseForOther));
+            thread->setState(ICE_ENUM(ThreadState, ThreadStateInUseForOther));
         }
 
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
             ProtocolSupport protocol = _protocol;
             if(networkProxy)
             {
@@ -649,68 +755,226 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if(r.observer)
-            {
-                r.observer->detach();
-                r.observer = 0;
-            }
+            //
+            // The host is resolved once for all the pending entries, the port and the
+            // order of the addresses are set for each entry.
+            //
+            vector<Address> addresses = getAddresses(host, 0, protocol, ICE_ENUM(EndpointSelectionType, Ordered),
+                                                     _preferIPv6, true);
+            resolved(host, networkProxy, addresses, 0);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            resolved(host, networkProxy, vector<Address>(), &ex);
+        }
+    }
 
-            r.callback->connectors(r.endpoint->connectors(addresses, networkProxy));
+    vector<ResolveEntry> entries;
+    {
+        Lock sync(*this);
+        for(deque<string>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+        {
+            map<string, vector<ResolveEntry> >::iterator q = _pending.find(*p);
+            assert(q != _pending.end());
+            entries.insert(entries.end(), q->second.begin(), q->second.end());
+            _pending.erase(q);
+        }
+        _queue.clear();
+    }
 
-            if(threadObserver)
-            {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
-            }
+    Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+    for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
+    {
+        finished(*p, vector<Address>(), 0, &ex);
+    }
+}
 
+void
+IceInternal::EndpointHostResolver::startThread()
+{
+    // Must be called with the mutex locked
+    ostringstream os;
+    os << "Ice.HostResolver-" << _threads.size();
+    HelperThreadPtr thread = new HelperThread(this, os.str());
+    if(_hasPriority)
+    {
+        thread->start(0, _priority);
+    }
+    else
+    {
+        thread->start();
+    }
+    _threads.push_back(thread);
+}
+
+bool
+IceInternal::EndpointHostResolver::lookupCache(const string& host, const ResolveEntry& entry)
+{
+    CacheEntry cached;
+    {
+        Lock sync(*this);
+        map<string, CacheEntry>::const_iterator p = _cache.find(host);
+        if(p == _cache.end() || p->second.expires <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+        {
+            return false;
         }
-        catch(const Ice::LocalException& ex)
+        cached = p->second;
+    }
+
+    EndpointLookupObserverI* observer = dynamic_cast<EndpointLookupObserverI*>(entry.observer.get());
+    if(cached.addresses.empty())
+    {
+        if(observer)
+        {
+            observer->negativeCacheHit();
+        }
+        Ice::DNSException ex(__FILE__, __LINE__, cached.error, host);
+        finished(entry, cached.addresses, 0, &ex);
+    }
+    else
+    {
+        if(observer)
+        {
+            observer->cacheHit();
+        }
+        finished(entry, cached.addresses, 0, 0);
+    }
+    return true;
+}
+
+void
+IceInternal::EndpointHostResolver::resolved(const string& host, const NetworkProxyPtr& networkProxy,
+                                            const vector<Address>& addresses, const Ice::LocalException* ex)
+{
+    vector<ResolveEntry> entries;
+    {
+        Lock sync(*this);
+        map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+        if(p != _pending.end())
+        {
+            entries.swap(p->second);
+            _pending.erase(p);
+        }
+
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(map<string, CacheEntry>::iterator q = _cache.begin(); q != _cache.end();)
         {
-            if(threadObserver)
+            if(q->second.expires <= now)
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                _cache.erase(q++);
             }
-            if(r.observer)
+            else
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                ++q;
             }
-            r.callback->exception(ex);
+        }
+
+        //
+        // Temporary failures aren't cached, the next connection attempt retries the lookup.
+        //
+        const Ice::DNSException* dnsEx = dynamic_cast<const Ice::DNSException*>(ex);
+        if(!ex && _cacheTTL > IceUtil::Time())
+        {
+            CacheEntry& entry = _cache[host];
+            entry.addresses = addresses;
+            entry.error = 0;
+            entry.expires = now + _cacheTTL;
+        }
+        else if(dnsEx && dnsEx->error != EAI_AGAIN && _negativeCacheTTL > IceUtil::Time())
+        {
+            CacheEntry& entry = _cache[host];
+            entry.addresses.clear();
+            entry.error = dnsEx->error;
+            entry.expires = now + _negativeCacheTTL;
         }
     }
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+    for(vector<ResolveEntry>::const_iterator p = entries.begin(); p != entries.end(); ++p)
     {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        finished(*p, addresses, networkProxy, ex);
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::finished(const ResolveEntry& entry, const vector<Address>& addrs,
+                                            const NetworkProxyPtr& networkProxy, const Ice::LocalException* ex)
+{
+    if(ex)
+    {
+        if(entry.observer)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
+            entry.observer->failed(ex->ice_id());
+            entry.observer->detach();
         }
-        p->callback->exception(ex);
+        entry.callback->exception(*ex);
+        return;
+    }
+
+    vector<Address> addresses = addrs;
+    for(vector<Address>::iterator p = addresses.begin(); p != addresses.end(); ++p)
+    {
+        setPort(*p, entry.port);
     }
-    _queue.clear();
+    sortAddresses(addresses, _protocol, entry.selType, _preferIPv6);
 
-    if(_observer)
+    if(entry.observer)
     {
-        _observer.detach();
+        entry.observer->detach();
     }
+    entry.callback->connectors(entry.endpoint->connectors(addresses, networkProxy));
+}
+
+IceInternal::EndpointHostResolver::HelperThread::HelperThread(const EndpointHostResolverPtr& resolver,
+                                                              const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver),
+    _state(ICE_ENUM(ThreadState, ThreadStateIdle))
+{
+    updateObserver();
 }
 
 void
-IceInternal::EndpointHostResolver::updateObserver()
+IceInternal::EndpointHostResolver::HelperThread::updateObserver()
 {
-    Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    // Must be called with the resolver mutex locked
+    const CommunicatorObserverPtr& obsv = _resolver->_instance->initializationData().observer;
     if(obsv)
     {
-        _observer.attach(obsv->getThreadObserver("Communicator",
-                                                 name(),
-                                                 ICE_ENUM(ThreadState, ThreadStateIdle),
-                                                 _observer.get()));
+        _observer.attach(obsv->getThreadObserver("Communicator", name(), _state, _observer.get()));
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::setState(Ice::Instrumentation::ThreadState s)
+{
+    // Must be called with the resolver mutex locked
+    if(_observer && _state != s)
+    {
+        _observer->stateChanged(_state, s);
     }
+    _state = s;
+}
+
+void
+IceInternal::EndpointHostResolver::HelperThread::run()
+{
+    try
+    {
+        _resolver->run(this);
+    }
+    catch(const exception& ex)
+    {
+        Error out(_resolver->_instance->initializationData().logger);
+        out << "exception in `Ice.HostResolver':\n" << ex;
+    }
+    catch(...)
+    {
+        Error out(_resolver->_instance->initializationData().logger);
+        out << "unknown exception in `Ice.HostResolver'";
+    }
+
+    _observer.detach();
+    _resolver = 0; // Break cyclic dependency.
 }
 
 #else
@@ -744,12 +1008,12 @@ IceInternal::EndpointHostResolver::destroy()
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
 {
 }
 
 void
-IceInternal::EndpointHostResolver::updateObserver()
+IceInternal::EndpointHostResolver::updateObservers()
 {
 }
 
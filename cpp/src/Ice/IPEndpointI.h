@@ -16,7 +16,9 @@
 #include <Ice/ObserverHelper.h>
 
 #ifndef ICE_OS_UWP
+#   include <IceUtil/Time.h>
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -104,8 +106,14 @@ private:
     mutable Ice::Int _hashValue;
 };
 
+//
+// Resolves the host of IP endpoints. The lookups are performed by up to
+// Ice.HostResolver.Size threads. Concurrent lookups of the same host are
+// coalesced and the results are cached for Ice.HostResolver.CacheTTL
+// seconds, or Ice.HostResolver.NegativeCacheTTL seconds for failures.
+//
 #ifndef ICE_OS_UWP
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
@@ -117,16 +125,34 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
                  const EndpointI_connectorsPtr&);
     void destroy();
+    void joinWithAllThreads();
 
-    virtual void run();
-    void updateObserver();
+    void updateObservers();
 
 private:
 
 #ifndef ICE_OS_UWP
+    class HelperThread : public IceUtil::Thread
+    {
+    public:
+
+        HelperThread(const EndpointHostResolverPtr&, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+        void setState(Ice::Instrumentation::ThreadState);
+
+    private:
+
+        EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+        Ice::Instrumentation::ThreadState _state;
+    };
+    typedef IceUtil::Handle<HelperThread> HelperThreadPtr;
+    friend class HelperThread;
+
     struct ResolveEntry
     {
-        std::string host;
         int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
@@ -134,12 +160,35 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    struct CacheEntry
+    {
+        std::vector<Address> addresses; // Empty if the lookup failed.
+        int error; // The DNSException error if the lookup failed.
+        IceUtil::Time expires;
+    };
+
+    void run(const HelperThreadPtr&);
+    void startThread();
+    bool lookupCache(const std::string&, const ResolveEntry&);
+    void resolved(const std::string&, const NetworkProxyPtr&, const std::vector<Address>&,
+                  const Ice::LocalException*);
+    void finished(const ResolveEntry&, const std::vector<Address>&, const NetworkProxyPtr&,
+                  const Ice::LocalException*);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const int _size; // Maximum number of threads.
+    const IceUtil::Time _cacheTTL;
+    const IceUtil::Time _negativeCacheTTL;
+    const bool _hasPriority;
+    const int _priority;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    int _idle; // Number of threads waiting for a host to resolve.
+    std::vector<HelperThreadPtr> _threads;
+    std::deque<std::string> _queue; // The hosts waiting for a lookup.
+    std::map<std::string, std::vector<ResolveEntry> > _pending; // The entries waiting for the lookup of a host.
+    std::map<std::string, CacheEntry> _cache;
 #else
     const InstancePtr _instance;
 #endif
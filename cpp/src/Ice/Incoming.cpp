@@ -5,7 +5,8 @@
 #include <Ice/Incoming.h>
 #include <Ice/IncomingAsync.h>
 #include <Ice/IncomingRequest.h>
-#include <Ice/ObjectAdapter.h>
+#include <Ice/ObjectAdapterI.h>
+#include <Ice/ConcurrencyLimiter.h>
 #include <Ice/ServantLocator.h>
 #include <Ice/ServantManager.h>
 #include <Ice/Object.h>
@@ -18,6 +19,8 @@
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
 #include <Ice/StringUtil.h>
+#include <Ice/DispatchDeadline.h>
+#include <IceUtil/InputUtil.h>
 #include <typeinfo>
 
 using namespace std;
@@ -609,59 +612,50 @@ IceInternal::Incoming::startOver()
 }
 
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream,
+                              const IceUtil::Time& received)
 {
     _is = stream;
 
     InputStream::Container::iterator start = _is->i;
 
-    //
-    // Read the current.
-    //
-    _is->read(_current.id);
+    readCurrent();
 
-    //
-    // For compatibility with the old FacetPath.
-    //
-    string facet;
+    IceUtil::Time deadline;
+    bool expired = false;
+    if(!_current.ctx.empty())
     {
-        vector<string> facetPath;
-        _is->read(facetPath);
-        if(!facetPath.empty())
+        Context::const_iterator p = _current.ctx.find(deadlineContextKey);
+        IceUtil::Int64 timeout;
+        if(p != _current.ctx.end() && IceUtilInternal::stringToInt64(p->second, timeout))
         {
-            if(facetPath.size() > 1)
-            {
-                throw MarshalException(__FILE__, __LINE__);
-            }
-            facet.swap(facetPath[0]);
+            IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            deadline = (received != IceUtil::Time() ? received : now) + IceUtil::Time::milliSeconds(timeout);
+            expired = deadline <= now;
         }
     }
-    _current.facet.swap(facet);
-
-    _is->read(_current.operation, false);
 
-    Byte b;
-    _is->read(b);
-    _current.mode = static_cast<OperationMode>(b);
-
-    Int sz = _is->readSize();
-    while(sz--)
-    {
-        pair<const string, string> pr;
-        _is->read(const_cast<string&>(pr.first));
-        _is->read(pr.second);
-        _current.ctx.insert(_current.ctx.end(), pr);
-    }
+    attachObserver(start);
 
-    const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
-    if(obsv)
+    if(expired)
     {
-        // Read the parameter encapsulation size.
-        Ice::Int encapsSize;
-        _is->read(encapsSize);
-        _is->i -= 4;
-
-        _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + encapsSize)));
+        //
+        // The caller gave up waiting for the response, the request is dropped
+        // without being dispatched and without response.
+        //
+        skipReadParams(); // Required for batch requests.
+        _observer.expired();
+        _observer.detach();
+        try
+        {
+            _responseHandler->sendNoResponse();
+        }
+        catch(const LocalException& ex)
+        {
+            _responseHandler->invokeException(_current.requestId, ex, 1, false); // Fatal invocation exception
+        }
+        _responseHandler = 0;
+        return;
     }
 
     //
@@ -727,9 +721,18 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     try
     {
         //
-        // Dispatch in the incoming call
+        // Dispatch in the incoming call, the invocations made by the servant from
+        // this thread inherit the deadline of the request.
         //
-        _servant->_iceDispatch(*this, _current);
+        if(deadline != IceUtil::Time())
+        {
+            DispatchDeadline dispatchDeadline(deadline);
+            _servant->_iceDispatch(*this, _current);
+        }
+        else
+        {
+            _servant->_iceDispatch(*this, _current);
+        }
 
         //
         // If the request was not dispatched asynchronously, send the response.
@@ -793,3 +796,116 @@ IceInternal::IncomingRequest::getCurrent()
 {
     return _in.getCurrent();
 }
+
+void
+IceInternal::Incoming::reject(InputStream* stream, bool serverBusy)
+{
+    _is = stream;
+
+    InputStream::Container::iterator start = _is->i;
+
+    readCurrent();
+    attachObserver(start);
+
+    skipReadParams(); // Required for batch requests.
+    _observer.rejected();
+    try
+    {
+        if(_response)
+        {
+            _os.writeBlob(replyHdr, sizeof(replyHdr));
+            _os.write(_current.requestId);
+            if(serverBusy)
+            {
+                _os.write(replyServerBusy);
+            }
+            else
+            {
+                //
+                // Earlier versions raise UnknownReplyStatusException for the server busy reply status.
+                //
+                ostringstream str;
+                str << ServerBusyException(__FILE__, __LINE__);
+                _os.write(replyUnknownLocalException);
+                _os.write(str.str(), false);
+            }
+            _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
+            _observer.detach();
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, false);
+        }
+        else
+        {
+            _observer.detach();
+            _responseHandler->sendNoResponse();
+        }
+    }
+    catch(const LocalException& ex)
+    {
+        _responseHandler->invokeException(_current.requestId, ex, 1, false); // Fatal invocation exception
+    }
+    _responseHandler = 0;
+}
+
+void
+IceInternal::Incoming::readCurrent()
+{
+    _is->read(_current.id);
+
+    //
+    // For compatibility with the old FacetPath.
+    //
+    string facet;
+    {
+        vector<string> facetPath;
+        _is->read(facetPath);
+        if(!facetPath.empty())
+        {
+            if(facetPath.size() > 1)
+            {
+                throw MarshalException(__FILE__, __LINE__);
+            }
+            facet.swap(facetPath[0]);
+        }
+    }
+    _current.facet.swap(facet);
+
+    _is->read(_current.operation, false);
+
+    Byte b;
+    _is->read(b);
+    _current.mode = static_cast<OperationMode>(b);
+
+    Int sz = _is->readSize();
+    while(sz--)
+    {
+        pair<const string, string> pr;
+        _is->read(const_cast<string&>(pr.first));
+        _is->read(pr.second);
+        _current.ctx.insert(_current.ctx.end(), pr);
+    }
+}
+
+void
+IceInternal::Incoming::attachObserver(InputStream::Container::iterator start)
+{
+    const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
+    if(obsv)
+    {
+        // Read the parameter encapsulation size.
+        Ice::Int encapsSize;
+        _is->read(encapsSize);
+        _is->i -= 4;
+
+        _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + encapsSize)));
+
+        ObjectAdapterI* adapter = dynamic_cast<ObjectAdapterI*>(_current.adapter.get());
+        if(_observer && adapter)
+        {
+            ConcurrencyLimiterPtr limiter = adapter->getConcurrencyLimiter();
+            if(limiter)
+            {
+                _observer.concurrency(limiter->limit(), limiter->inflight());
+            }
+        }
+    }
+}
@@ -21,6 +21,7 @@ using namespace IceInternal;
 #ifndef ICE_CPP11_MAPPING
 IceUtil::Shared* IceInternal::upCast(IncomingAsync* p) { return p; }
 IceUtil::Shared* Ice::upCast(AMD_Object_ice_invoke* p) { return p; }
+IceUtil::Shared* Ice::upCast(ChunkReadyCallback* p) { return p; }
 
 Ice::AMDCallback::~AMDCallback()
 {
@@ -31,6 +32,11 @@ Ice::AMD_Object_ice_invoke::~AMD_Object_ice_invoke()
 {
     // Out of line to avoid weak vtable
 }
+
+Ice::ChunkReadyCallback::~ChunkReadyCallback()
+{
+    // Out of line to avoid weak vtable
+}
 #endif
 
 namespace
@@ -61,7 +67,10 @@ Init init;
 IceInternal::IncomingAsync::IncomingAsync(Incoming& in) :
     IncomingBase(in),
     _responseSent(false),
-    _responseHandlerCopy(ICE_GET_SHARED_FROM_THIS(_responseHandler))
+    _responseHandlerCopy(ICE_GET_SHARED_FROM_THIS(_responseHandler)),
+    _sendChunks(_current.ctx.find(chunksContextKey) != _current.ctx.end()),
+    _chunkOs(_os.instance(), Ice::currentProtocolEncoding),
+    _heldChunksSize(0)
 {
 #ifndef ICE_CPP11_MAPPING
     in.setAsync(this);
@@ -154,6 +163,10 @@ IceInternal::IncomingAsync::completed()
     }
 
     checkResponseSent();
+    if(_heldChunksSize > 0)
+    {
+        writeHeldChunks();
+    }
     IncomingBase::response(true); // User thread
 }
 
@@ -191,6 +204,84 @@ IceInternal::IncomingAsync::completed(exception_ptr ex)
 }
 #endif
 
+OutputStream*
+IceInternal::IncomingAsync::startWriteChunk()
+{
+    if(!_response)
+    {
+        throw MarshalException(__FILE__, __LINE__, "can't marshal out parameters for oneway dispatch");
+    }
+
+    assert(_current.encoding >= Ice::Encoding_1_0); // Encoding for reply is known.
+
+    //
+    // The buffer of the previous chunk is reused unless the connection adopted it.
+    //
+    _chunkOs.clear();
+    _chunkOs.b.clear();
+    _chunkOs.writeBlob(replyHdr, sizeof(replyHdr));
+    _chunkOs.write(_current.requestId);
+    _chunkOs.write(replyChunk);
+    _chunkOs.startEncapsulation(_current.encoding, _format);
+    return &_chunkOs;
+}
+
+bool
+IceInternal::IncomingAsync::endWriteChunk(const ICE_DELEGATE(Ice::ChunkReadyCallback)& ready)
+{
+    _chunkOs.endEncapsulation();
+    {
+        IceUtil::Mutex::Lock sync(*globalMutex);
+        if(_responseSent)
+        {
+            throw ResponseSentException(__FILE__, __LINE__);
+        }
+    }
+
+    if(!_sendChunks)
+    {
+        //
+        // The client didn't request the chunks, it's an earlier version or a dynamic invocation.
+        // The elements of the chunk are held to be sent with the response, see writeHeldChunks.
+        //
+        InputStream is(currentProtocolEncoding, _chunkOs);
+        is.i = is.b.begin() + headerSize + sizeof(Int) + 1; // Skip the reply header, request ID and status.
+        is.startEncapsulation();
+        _heldChunksSize += is.readSize();
+        _heldChunks.insert(_heldChunks.end(), is.i, is.b.end());
+        return true;
+    }
+
+    return _responseHandlerCopy->sendResponseChunk(_current.requestId, &_chunkOs, _compress, ready);
+}
+
+void
+IceInternal::IncomingAsync::writeHeldChunks()
+{
+    //
+    // The result of an operation with the cpp:stream metadata is a sequence, the elements of the
+    // held chunks are inserted before the elements of the last part of the result to marshal the
+    // complete result. The sequence is the only content of the encapsulation.
+    //
+    const size_t replyHeaderSize = headerSize + sizeof(Int) + 1;
+    InputStream is(currentProtocolEncoding, _os);
+    is.i = is.b.begin() + replyHeaderSize;
+    is.startEncapsulation();
+    Int sz = is.readSize();
+
+    OutputStream os(_os.instance(), currentProtocolEncoding);
+    os.writeBlob(&_os.b[0], replyHeaderSize);
+    os.startEncapsulation(_current.encoding, _format);
+    os.writeSize(_heldChunksSize + sz);
+    os.writeBlob(_heldChunks);
+    os.writeBlob(is.i, static_cast<size_t>(is.b.end() - is.i));
+    os.endEncapsulation();
+    _os.swap(os);
+
+    _heldChunks.clear();
+    _heldChunksSize = 0;
+}
+
 void
 IceInternal::IncomingAsync::checkResponseSent()
 {
@@ -558,7 +558,7 @@ IceInternal::getInstanceTimer(const CommunicatorPtr& communicator)
 {
     CommunicatorIPtr p = ICE_DYNAMIC_CAST(::Ice::CommunicatorI, communicator);
     assert(p);
-    return p->_instance->timer();
+    return p->_instance->pluginTimer();
 }
 
 Identity
@@ -156,6 +156,7 @@ Ice::InputStream::initialize(Instance* instance, const EncodingVersion& encoding
     initialize(encoding);
 
     _instance = instance;
+    b.setPoolSize(_instance->bufferPoolSize());
 
 #ifndef ICE_CPP11_MAPPING
     _collectObjects = _instance->collectObjects();
@@ -26,6 +26,7 @@
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/EndpointLatencyTable.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
 #include <Ice/Initialize.h>
@@ -191,17 +192,12 @@ private:
 //
 // Timer specialization which supports the thread observer
 //
-class Timer : public IceUtil::Timer
+class Timer : public TimerWheel
 {
 public:
 
-    Timer(int priority) :
-        IceUtil::Timer(priority),
-        _hasObserver(0)
-    {
-    }
-
-    Timer() :
+    Timer(int shards, bool hasPriority, int priority) :
+        TimerWheel(shards, hasPriority, priority),
         _hasObserver(0)
     {
     }
@@ -496,7 +492,15 @@ IceInternal::Instance::retryQueue()
     return _retryQueue;
 }
 
-IceUtil::TimerPtr
+EndpointLatencyTablePtr
+IceInternal::Instance::endpointLatencyTable() const
+{
+    // No mutex lock, immutable.
+    assert(_endpointLatencyTable);
+    return _endpointLatencyTable;
+}
+
+TimerWheelPtr
 IceInternal::Instance::timer()
 {
     Lock sync(*this);
@@ -509,6 +513,48 @@ IceInternal::Instance::timer()
     return _timer;
 }
 
+IceUtil::TimerPtr
+IceInternal::Instance::pluginTimer()
+{
+    Lock sync(*this);
+
+    if(_state == StateDestroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    //
+    // The timer returned to the plug-ins by getInstanceTimer is a plain IceUtil::Timer, it's
+    // only created if a plug-in requests it.
+    //
+    if(!_pluginTimer)
+    {
+        if(_state != StateActive)
+        {
+            throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+
+        try
+        {
+            if(_initData.properties->getProperty("Ice.ThreadPriority") != "")
+            {
+                _pluginTimer = new IceUtil::Timer(_initData.properties->getPropertyAsInt("Ice.ThreadPriority"));
+            }
+            else
+            {
+                _pluginTimer = new IceUtil::Timer;
+            }
+        }
+        catch(const IceUtil::Exception& ex)
+        {
+            Error out(_initData.logger);
+            out << "cannot create thread for timer:\n" << ex;
+            throw;
+        }
+    }
+    return _pluginTimer;
+}
+
 EndpointFactoryManagerPtr
 IceInternal::Instance::endpointFactoryManager() const
 {
@@ -537,6 +583,37 @@ IceInternal::Instance::dynamicLibraryList() const
     return _dynamicLibraryList;
 }
 
+void
+IceInternal::Instance::addCompressionCodec(const CompressionCodecPtr& codec)
+{
+    Byte id = codec->id();
+    if(id >= maxCompressionCodecs)
+    {
+        throw InitializationException(__FILE__, __LINE__, "invalid id for compression codec `" + codec->name() + "'");
+    }
+    _compressionCodecs[id] = codec;
+    _compressionCodecMask = static_cast<Byte>(_compressionCodecMask | (1 << id));
+}
+
+CompressionCodecPtr
+IceInternal::Instance::getCompressionCodec(Byte id) const
+{
+    return id < maxCompressionCodecs ? _compressionCodecs[id] : CompressionCodecPtr();
+}
+
+CompressionCodecPtr
+IceInternal::Instance::findCompressionCodec(const string& name) const
+{
+    for(Byte i = 0; i < maxCompressionCodecs; ++i)
+    {
+        if(_compressionCodecs[i] && _compressionCodecs[i]->name() == name)
+        {
+            return _compressionCodecs[i];
+        }
+    }
+    return ICE_NULLPTR;
+}
+
 PluginManagerPtr
 IceInternal::Instance::pluginManager() const
 {
@@ -947,6 +1024,16 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _initData(initData),
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
+    _writeCoalesceSize(0),
+    _messageFragmentSize(0),
+    _tcpZeroCopySize(0),
+    _streamChunkWindow(0),
+    _sendQueueSizeMax(0),
+    _sendQueueLengthMax(0),
+    _sendQueueWait(true),
+    _propagateDeadline(false),
+    _bufferPoolSize(0),
+    _compressionCodecMask(0),
     _classGraphDepthMax(0),
     _collectObjects(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
@@ -1145,6 +1232,8 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
         const_cast<DefaultsAndOverridesPtr&>(_defaultsAndOverrides) =
             new DefaultsAndOverrides(_initData.properties, _initData.logger);
 
+        const_cast<EndpointLatencyTablePtr&>(_endpointLatencyTable) = new EndpointLatencyTable(_defaultsAndOverrides);
+
         const ACMConfig defaultClientACM(_initData.properties, _initData.logger, "Ice.ACM", ACMConfig(false));
         const ACMConfig defaultServerACM(_initData.properties, _initData.logger, "Ice.ACM", ACMConfig(true));
 
@@ -1198,6 +1287,127 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.WriteCoalesceSize", 0); // Disabled by default
+            if(num < 1)
+            {
+                const_cast<size_t&>(_writeCoalesceSize) = 0; // Disabled
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.MessageFragmentSize", 0); // Disabled
+            if(num < 1)
+            {
+                const_cast<size_t&>(_messageFragmentSize) = 0; // Disabled
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_messageFragmentSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_messageFragmentSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.TCP.ZeroCopySize", 0); // Disabled
+            if(num > 0)
+            {
+                // Property is in bytes.
+                const_cast<size_t&>(_tcpZeroCopySize) = static_cast<size_t>(num);
+            }
+        }
+
+        {
+            //
+            // The number of chunks of streamed results which can be queued by a connection before
+            // the sender waits or the receiver stops reading.
+            //
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.StreamChunkWindow", 16);
+            const_cast<size_t&>(_streamChunkWindow) = static_cast<size_t>(num < 1 ? 1 : num);
+        }
+
+        {
+            //
+            // The limits of the requests queued by a connection for sending, an invocation waits
+            // for the queue to drain or fails with SendQueueFullException once they're reached.
+            //
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.SendQueueSizeMax", 0); // Unlimited
+            if(num < 1)
+            {
+                const_cast<size_t&>(_sendQueueSizeMax) = 0; // Unlimited
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_sendQueueSizeMax) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_sendQueueSizeMax) = static_cast<size_t>(num) * 1024;
+            }
+
+            num = _initData.properties->getPropertyAsIntWithDefault("Ice.SendQueueLengthMax", 0); // Unlimited
+            const_cast<size_t&>(_sendQueueLengthMax) = static_cast<size_t>(num < 1 ? 0 : num);
+
+            num = _initData.properties->getPropertyAsIntWithDefault("Ice.SendQueueWait", 1);
+            const_cast<bool&>(_sendQueueWait) = num > 0;
+        }
+
+        //
+        // If set, twoway invocations with an invocation timeout send the remaining time before
+        // the timeout with the request, the server drops the request if it expires before it's
+        // dispatched.
+        //
+        const_cast<bool&>(_propagateDeadline) =
+            _initData.properties->getPropertyAsInt("Ice.PropagateDeadline") > 0;
+
+        {
+            //
+            // The buffer pools are per-thread and shared by all the communicators of the
+            // process, the buffers of the streams of this communicator are kept in the pool
+            // of the releasing thread up to this size.
+            //
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPoolSize", 1024); // 1MB default
+            if(num < 1)
+            {
+                const_cast<size_t&>(_bufferPoolSize) = 0; // Disabled
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_bufferPoolSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            CompressionCodecPtr codecs[] =
+            {
+                createBzip2CompressionCodec(),
+                createZstdCompressionCodec(),
+                createLz4CompressionCodec()
+            };
+            for(size_t i = 0; i < sizeof(codecs) / sizeof(codecs[0]); ++i)
+            {
+                if(codecs[i])
+                {
+                    addCompressionCodec(codecs[i]);
+                }
+            }
+        }
+
         {
             static const int defaultValue = 100;
             Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.ClassGraphDepthMax", defaultValue);
@@ -1309,6 +1519,7 @@ IceInternal::Instance::~Instance()
     assert(!_endpointHostResolver);
     assert(!_retryQueue);
     assert(!_timer);
+    assert(!_pluginTimer);
     assert(!_routerManager);
     assert(!_locatorManager);
     assert(!_endpointFactoryManager);
@@ -1457,14 +1668,13 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     {
         bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
         int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            _timer = new Timer(priority);
-        }
-        else
-        {
-            _timer = new Timer;
-        }
+
+        //
+        // The timer can be split into shards with their own thread, the timer tasks of
+        // the connections, invocations and retries are spread over the shards.
+        //
+        int shards = _initData.properties->getPropertyAsIntWithDefault("Ice.Timer.Shards", 1);
+        _timer = new Timer(shards < 1 ? 1 : shards, hasPriority, priority);
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -1476,18 +1686,6 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     try
     {
         _endpointHostResolver = new EndpointHostResolver(this);
-#ifndef ICE_OS_UWP
-        bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            _endpointHostResolver->start(0, priority);
-        }
-        else
-        {
-            _endpointHostResolver->start();
-        }
-#endif
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -1669,6 +1867,16 @@ IceInternal::Instance::destroy()
         _timer->destroy();
     }
 
+    IceUtil::TimerPtr pluginTimer;
+    {
+        Lock sync(*this);
+        pluginTimer = _pluginTimer;
+    }
+    if(pluginTimer)
+    {
+        pluginTimer->destroy();
+    }
+
     //
     // Wait for all the threads to be finished.
     //
@@ -1680,12 +1888,10 @@ IceInternal::Instance::destroy()
     {
         _serverThreadPool->joinWithAllThreads();
     }
-#ifndef ICE_OS_UWP
     if(_endpointHostResolver)
     {
-        _endpointHostResolver->getThreadControl().join();
+        _endpointHostResolver->joinWithAllThreads();
     }
-#endif
 
 #ifdef ICE_CPP11_COMPILER
     for(const auto& p : _objectFactoryMap)
@@ -1746,6 +1952,7 @@ IceInternal::Instance::destroy()
         _clientThreadPool = 0;
         _endpointHostResolver = 0;
         _timer = 0;
+        _pluginTimer = 0;
 
         _referenceFactory = 0;
         _requestHandlerFactory = 0;
@@ -1796,7 +2003,7 @@ IceInternal::Instance::updateThreadObservers()
         _objectAdapterFactory->updateObservers(&ObjectAdapterI::updateThreadObservers);
         if(_endpointHostResolver)
         {
-            _endpointHostResolver->updateObserver();
+            _endpointHostResolver->updateObservers();
         }
         if(_timer)
         {
@@ -10,6 +10,7 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/RecMutex.h>
 #include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <Ice/StringConverter.h>
 #include <Ice/InstanceF.h>
 #include <Ice/CommunicatorF.h>
@@ -28,7 +29,9 @@
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
+#include <Ice/EndpointLatencyTableF.h>
 #include <Ice/DynamicLibraryF.h>
+#include <Ice/CompressionCodecI.h>
 #include <Ice/PluginF.h>
 #include <Ice/NetworkF.h>
 #include <Ice/NetworkProxyF.h>
@@ -97,12 +100,33 @@ public:
     ThreadPoolPtr serverThreadPool();
     EndpointHostResolverPtr endpointHostResolver();
     RetryQueuePtr retryQueue();
-    IceUtil::TimerPtr timer();
+    EndpointLatencyTablePtr endpointLatencyTable() const;
+    TimerWheelPtr timer();
+    IceUtil::TimerPtr pluginTimer();
     EndpointFactoryManagerPtr endpointFactoryManager() const;
     DynamicLibraryListPtr dynamicLibraryList() const;
     Ice::PluginManagerPtr pluginManager() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+    size_t writeCoalesceSize() const { return _writeCoalesceSize; }
+    size_t messageFragmentSize() const { return _messageFragmentSize; }
+    size_t tcpZeroCopySize() const { return _tcpZeroCopySize; }
+    size_t streamChunkWindow() const { return _streamChunkWindow; }
+    size_t sendQueueSizeMax() const { return _sendQueueSizeMax; }
+    size_t sendQueueLengthMax() const { return _sendQueueLengthMax; }
+    bool sendQueueWait() const { return _sendQueueWait; }
+    bool propagateDeadline() const { return _propagateDeadline; }
+    size_t bufferPoolSize() const { return _bufferPoolSize; }
+
+    //
+    // Compression codecs must be added before any connection is established, for
+    // example from a plug-in initialize method.
+    //
+    void addCompressionCodec(const Ice::CompressionCodecPtr&);
+    Ice::CompressionCodecPtr getCompressionCodec(Ice::Byte) const;
+    Ice::CompressionCodecPtr findCompressionCodec(const std::string&) const;
+    Ice::Byte compressionCodecs() const { return _compressionCodecMask; } // Bit mask of the registered codec ids.
+
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
     bool collectObjects() const { return _collectObjects; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
@@ -170,8 +194,20 @@ private:
     Ice::InitializationData _initData;
     const TraceLevelsPtr _traceLevels; // Immutable, not reset by destroy().
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
+    const EndpointLatencyTablePtr _endpointLatencyTable; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
+    const size_t _writeCoalesceSize; // Immutable, not reset by destroy().
+    const size_t _messageFragmentSize; // Immutable, not reset by destroy().
+    const size_t _tcpZeroCopySize; // Immutable, not reset by destroy().
+    const size_t _streamChunkWindow; // Immutable, not reset by destroy().
+    const size_t _sendQueueSizeMax; // Immutable, not reset by destroy().
+    const size_t _sendQueueLengthMax; // Immutable, not reset by destroy().
+    const bool _sendQueueWait; // Immutable, not reset by destroy().
+    const bool _propagateDeadline; // Immutable, not reset by destroy().
+    const size_t _bufferPoolSize; // Immutable, not reset by destroy().
+    Ice::CompressionCodecPtr _compressionCodecs[maxCompressionCodecs]; // Not reset by destroy().
+    Ice::Byte _compressionCodecMask;
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
@@ -192,6 +228,7 @@ private:
     EndpointHostResolverPtr _endpointHostResolver;
     RetryQueuePtr _retryQueue;
     TimerPtr _timer;
+    IceUtil::TimerPtr _pluginTimer;
     EndpointFactoryManagerPtr _endpointFactoryManager;
     DynamicLibraryListPtr _dynamicLibraryList;
     Ice::PluginManagerPtr _pluginManager;
@@ -67,6 +67,22 @@ struct ThreadStateChanged
     ThreadState newState;
 };
 
+struct ConcurrencyChanged
+{
+    ConcurrencyChanged(Int limitP, Int inflightP) : limit(limitP), inflight(inflightP)
+    {
+    }
+
+    void operator()(const DispatchMetricsPtr& v)
+    {
+        v->concurrencyLimit = limit;
+        v->inflight = inflight;
+    }
+
+    Int limit;
+    Int inflight;
+};
+
 IPConnectionInfo*
 getIPConnectionInfo(const ConnectionInfoPtr& info)
 {
@@ -695,28 +711,32 @@ private:
 
 ThreadHelper::Attributes ThreadHelper::attributes;
 
-class EndpointHelper : public MetricsHelperT<Metrics>
+//
+// The endpoint lookups use their own metrics type, the connection establishments
+// use the base metrics type.
+//
+template<typename MetricsType> class EndpointHelperT : public MetricsHelperT<MetricsType>
 {
 public:
 
-    class Attributes : public AttributeResolverT<EndpointHelper>
+    class Attributes : public MetricsHelperT<MetricsType>::template AttributeResolverT<EndpointHelperT>
     {
     public:
 
         Attributes()
         {
-            add("parent", &EndpointHelper::getParent);
-            add("id", &EndpointHelper::getId);
-            addEndpointAttributes<EndpointHelper>(*this);
+            this->add("parent", &EndpointHelperT::getParent);
+            this->add("id", &EndpointHelperT::getId);
+            addEndpointAttributes<EndpointHelperT>(*this);
         }
     };
     static Attributes attributes;
 
-    EndpointHelper(const EndpointPtr& endpt, const string& id) : _endpoint(endpt), _id(id)
+    EndpointHelperT(const EndpointPtr& endpt, const string& id) : _endpoint(endpt), _id(id)
     {
     }
 
-    EndpointHelper(const EndpointPtr& endpt) : _endpoint(endpt)
+    EndpointHelperT(const EndpointPtr& endpt) : _endpoint(endpt)
     {
     }
 
@@ -764,7 +784,10 @@ private:
     mutable EndpointInfoPtr _endpointInfo;
 };
 
-EndpointHelper::Attributes EndpointHelper::attributes;
+template<typename MetricsType> typename EndpointHelperT<MetricsType>::Attributes EndpointHelperT<MetricsType>::attributes;
+
+typedef EndpointHelperT<Metrics> EndpointHelper;
+typedef EndpointHelperT<EndpointLookupMetrics> EndpointLookupHelper;
 
 }
 
@@ -788,6 +811,31 @@ ConnectionObserverI::receivedBytes(Int num)
     }
 }
 
+void
+ConnectionObserverI::compressed()
+{
+    forEach(inc(&ConnectionMetrics::compressedMessages));
+}
+
+void
+ConnectionObserverI::compressionSkipped()
+{
+    forEach(inc(&ConnectionMetrics::compressionSkipped));
+}
+
+void
+ConnectionObserverI::sendQueueChanged(Int length, Long size)
+{
+    forEach(add(&ConnectionMetrics::sendQueueLength, length));
+    forEach(add(&ConnectionMetrics::sendQueueSize, size));
+}
+
+void
+ConnectionObserverI::sendQueueFull()
+{
+    forEach(inc(&ConnectionMetrics::sendQueueFull));
+}
+
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
@@ -819,6 +867,24 @@ DispatchObserverI::reply(Int size)
     }
 }
 
+void
+DispatchObserverI::expired()
+{
+    forEach(inc(&DispatchMetrics::expired));
+}
+
+void
+DispatchObserverI::rejected()
+{
+    forEach(inc(&DispatchMetrics::rejected));
+}
+
+void
+DispatchObserverI::concurrency(Int limit, Int inflight)
+{
+    forEach(ConcurrencyChanged(limit, inflight));
+}
+
 void
 RemoteObserverI::reply(Int size)
 {
@@ -902,6 +968,24 @@ InvocationObserverI::getCollocatedObserver(const Ice::ObjectAdapterPtr& adapter,
     return ICE_NULLPTR;
 }
 
+void
+EndpointLookupObserverI::cacheHit()
+{
+    forEach(inc(&EndpointLookupMetrics::cacheHits));
+}
+
+void
+EndpointLookupObserverI::negativeCacheHit()
+{
+    forEach(inc(&EndpointLookupMetrics::negativeCacheHits));
+}
+
+void
+EndpointLookupObserverI::coalesced()
+{
+    forEach(inc(&EndpointLookupMetrics::coalesced));
+}
+
 CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData) :
     _metrics(new MetricsAdminI(initData.properties, initData.logger)),
     _delegate(initData.observer),
@@ -962,7 +1046,7 @@ CommunicatorObserverI::getEndpointLookupObserver(const EndpointPtr& endpt)
             {
                 delegate = _delegate->getEndpointLookupObserver(endpt);
             }
-            return _endpointLookups.getObserverWithDelegate(EndpointHelper(endpt), delegate);
+            return _endpointLookups.getObserverWithDelegate(EndpointLookupHelper(endpt), delegate);
         }
         catch(const exception& ex)
         {
@@ -153,6 +153,19 @@ public:
 
     virtual void sentBytes(Ice::Int);
     virtual void receivedBytes(Ice::Int);
+
+    //
+    // Compression metrics, these aren't part of the Instrumentation observer
+    // interface and therefore aren't forwarded to the delegate.
+    //
+    void compressed();
+    void compressionSkipped();
+
+    //
+    // Send queue metrics, not part of the Instrumentation observer interface either.
+    //
+    void sendQueueChanged(Ice::Int, Ice::Long);
+    void sendQueueFull();
 };
 
 class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::Instrumentation::ThreadObserver>
@@ -169,6 +182,10 @@ public:
     virtual void userException();
 
     virtual void reply(Ice::Int);
+
+    void expired();
+    void rejected();
+    void concurrency(Ice::Int, Ice::Int);
 };
 
 class RemoteObserverI : public ObserverWithDelegateT<IceMX::RemoteMetrics, Ice::Instrumentation::RemoteObserver>
@@ -204,6 +221,21 @@ public:
 
 typedef ObserverWithDelegateT<IceMX::Metrics, Ice::Instrumentation::Observer> ObserverI;
 
+class EndpointLookupObserverI : public ObserverWithDelegateT<IceMX::EndpointLookupMetrics,
+                                                             Ice::Instrumentation::Observer>
+{
+public:
+
+    //
+    // Cache metrics of the endpoint host resolver, these aren't part of the
+    // Instrumentation observer interface and therefore aren't forwarded to
+    // the delegate.
+    //
+    void cacheHit();
+    void negativeCacheHit();
+    void coalesced();
+};
+
 class ICE_API CommunicatorObserverI : public Ice::Instrumentation::CommunicatorObserver
 {
 public:
@@ -247,7 +279,7 @@ private:
     ObserverFactoryWithDelegateT<InvocationObserverI> _invocations;
     ObserverFactoryWithDelegateT<ThreadObserverI> _threads;
     ObserverFactoryWithDelegateT<ObserverI> _connects;
-    ObserverFactoryWithDelegateT<ObserverI> _endpointLookups;
+    ObserverFactoryWithDelegateT<EndpointLookupObserverI> _endpointLookups;
 };
 ICE_DEFINE_PTR(CommunicatorObserverIPtr, CommunicatorObserverI);
 
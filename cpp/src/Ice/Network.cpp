@@ -135,46 +135,6 @@ public:
 };
 #   endif
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
-    {
-        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
-    }
-
-    if(protocol == EnableBoth)
-    {
-#ifdef ICE_CPP11_COMPILER
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family == AF_INET6;
-                             });
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family != AF_INET6;
-                             });
-        }
-#else
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
-        }
-#endif
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -1065,6 +1025,47 @@ IceInternal::NativeInfo::newFd()
     return true;
 }
 
+#if defined(ICE_USE_IO_URING)
+void
+IceInternal::NativeInfo::disableReceive()
+{
+    _receiveDisabled = true;
+}
+
+ReceiveStatus
+IceInternal::NativeInfo::startReceive(const ReceiveBuffersPtr&)
+{
+    return ReceiveUnsupported;
+}
+
+void
+IceInternal::NativeInfo::finishReceive(int, int)
+{
+    assert(false); // Receive requests are only submitted if supported.
+}
+
+IceInternal::ReceiveBuffers::ReceiveBuffers(int count, size_t size) :
+    _count(count),
+    _size(size),
+    _data(static_cast<size_t>(count) * size)
+{
+}
+
+void
+IceInternal::ReceiveBuffers::release(int id)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _released.push_back(id);
+}
+
+void
+IceInternal::ReceiveBuffers::takeReleased(vector<int>& released)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _released.swap(released);
+}
+#endif
+
 #endif
 
 bool
@@ -1136,6 +1137,47 @@ IceInternal::getAddresses(const string& host, int port, ProtocolSupport, Ice::En
 
 }
 #else
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType != Ice::ICE_ENUM(EndpointSelectionType, Ordered))
+    {
+        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
+    }
+
+    if(protocol == EnableBoth)
+    {
+#ifdef ICE_CPP11_COMPILER
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family == AF_INET6;
+                             });
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family != AF_INET6;
+                             });
+        }
+#else
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(), AddressIsIPv6());
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(), not1(AddressIsIPv6()));
+        }
+#endif
+    }
+}
+
 vector<Address>
 IceInternal::getAddresses(const string& host, int port, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
                           bool preferIPv6, bool canBlock)
@@ -18,6 +18,7 @@
 #include <Ice/Protocol.h>
 #include <Ice/ProtocolInstanceF.h>
 #include <Ice/EndpointTypes.h>
+#include <IceUtil/Mutex.h>
 
 #if defined(ICE_OS_UWP)
 #   include <ppltasks.h>
@@ -55,6 +56,30 @@ typedef int ssize_t;
 #   define ICE_USE_POLL 1
 #endif
 
+//
+// On Linux, TCP connections can optionally send large messages with MSG_ZEROCOPY
+// (see the Ice.TCP.ZeroCopySize property) if the system headers provide the
+// definitions.
+//
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#   define ICE_USE_ZEROCOPY 1
+#endif
+
+//
+// On Linux, the thread pool selector can optionally use io_uring instead of
+// epoll (see the Ice.ThreadPool.<name>.Backend property). Support is only
+// compiled in if the system headers provide the io_uring definitions, timed
+// waits (IORING_FEAT_EXT_ARG) are required.
+//
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_IO_URING) && defined(__has_include)
+#   if __has_include(<linux/io_uring.h>)
+#      include <linux/io_uring.h>
+#      if defined(IORING_FEAT_EXT_ARG)
+#         define ICE_USE_IO_URING 1
+#      endif
+#   endif
+#endif
+
 #if defined(_WIN32) || defined(__osf__)
 typedef int socklen_t;
 #endif
@@ -183,6 +208,54 @@ public:
 };
 typedef IceUtil::Handle<ReadyCallback> ReadyCallbackPtr;
 
+#if defined(ICE_USE_IO_URING)
+//
+// The receive buffers provided to the kernel by the io_uring selector backend. The kernel
+// selects a buffer when a receive request completes with data, the buffer is handed over
+// to the stream socket and released once its data is read. The released buffers are
+// provided again to the kernel by the selector.
+//
+class ICE_API ReceiveBuffers : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    ReceiveBuffers(int, size_t);
+
+    int count() const
+    {
+        return _count;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    char* data(int id)
+    {
+        return &_data[static_cast<size_t>(id) * _size];
+    }
+
+    void release(int);
+    void takeReleased(std::vector<int>&);
+
+private:
+
+    const int _count;
+    const size_t _size;
+    std::vector<char> _data;
+    std::vector<int> _released;
+};
+typedef IceUtil::Handle<ReceiveBuffers> ReceiveBuffersPtr;
+
+enum ReceiveStatus
+{
+    ReceiveUnsupported, // The socket doesn't support completion-based receives.
+    ReceiveReady, // Received data (or a receive error) is waiting to be read.
+    ReceiveStarted // A receive request must be submitted for the socket.
+};
+#endif
+
 class ICE_API NativeInfo : public virtual IceUtil::Shared
 {
 public:
@@ -190,6 +263,9 @@ public:
     virtual ~NativeInfo();
 
     NativeInfo(SOCKET socketFd = INVALID_SOCKET) : _fd(socketFd)
+#if defined(ICE_USE_IO_URING)
+        , _receiveDisabled(false)
+#endif
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
         , _newFd(INVALID_SOCKET)
 #endif
@@ -225,12 +301,27 @@ public:
 #else
     bool newFd();
     void setNewFd(SOCKET);
+#   if defined(ICE_USE_IO_URING)
+    //
+    // Completion-based receives of the io_uring selector backend. The selector calls
+    // startReceive before submitting a receive request for the socket and finishReceive
+    // with the result of the request and the selected buffer (-1 if none). This is only
+    // supported by stream sockets which are always read with StreamSocket::read, a
+    // transceiver which reads the socket directly must call disableReceive first.
+    //
+    void disableReceive();
+    virtual ReceiveStatus startReceive(const ReceiveBuffersPtr&);
+    virtual void finishReceive(int, int);
+#   endif
 #endif
 
 protected:
 
     SOCKET _fd;
     ReadyCallbackPtr _readyCallback;
+#if defined(ICE_USE_IO_URING)
+    bool _receiveDisabled;
+#endif
 
 #if defined(ICE_USE_IOCP)
     HANDLE _handle;
@@ -258,6 +349,9 @@ ICE_API bool noMoreFds(int);
 ICE_API std::string errorToStringDNS(int);
 ICE_API std::vector<Address> getAddresses(const std::string&, int, ProtocolSupport, Ice::EndpointSelectionType, bool,
                                           bool);
+#ifndef ICE_OS_UWP
+ICE_API void sortAddresses(std::vector<Address>&, ProtocolSupport, Ice::EndpointSelectionType, bool);
+#endif
 ICE_API ProtocolSupport getProtocolSupport(const Address&);
 ICE_API Address getAddressForServer(const std::string&, int, ProtocolSupport, bool, bool);
 ICE_API int compareAddress(const Address&, const Address&);
@@ -22,6 +22,8 @@
 #include <Ice/Locator.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/ThreadPool.h>
+#include <Ice/DispatchLanes.h>
+#include <Ice/ConcurrencyLimiter.h>
 #include <Ice/Communicator.h>
 #include <Ice/Router.h>
 #include <Ice/DefaultsAndOverrides.h>
@@ -372,6 +374,11 @@ Ice::ObjectAdapterI::destroy() ICE_NOEXCEPT
     //
     _servantManager->destroy();
 
+    if(_dispatchLanes)
+    {
+        _dispatchLanes->destroy();
+    }
+
     //
     // Destroy the thread pool.
     //
@@ -400,6 +407,8 @@ Ice::ObjectAdapterI::destroy() ICE_NOEXCEPT
         //
         _instance = 0;
         _threadPool = 0;
+        _dispatchLanes = 0;
+        _concurrencyLimiter = 0;
         _routerInfo = 0;
         _publishedEndpoints.clear();
         _locatorInfo = 0;
@@ -913,6 +922,26 @@ Ice::ObjectAdapterI::getServantManager() const
     return _servantManager;
 }
 
+DispatchLanesPtr
+Ice::ObjectAdapterI::getDispatchLanes() const
+{
+    //
+    // No mutex lock necessary, _dispatchLanes is immutable after
+    // creation until it's removed in destroy().
+    //
+    return _dispatchLanes;
+}
+
+ConcurrencyLimiterPtr
+Ice::ObjectAdapterI::getConcurrencyLimiter() const
+{
+    //
+    // No mutex lock necessary, _concurrencyLimiter is immutable after
+    // creation until it's removed in destroy().
+    //
+    return _concurrencyLimiter;
+}
+
 IceInternal::ACMConfig
 Ice::ObjectAdapterI::getACM() const
 {
@@ -927,7 +956,8 @@ Ice::ObjectAdapterI::setAdapterOnConnection(const Ice::ConnectionIPtr& connectio
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(*this);
     checkForDeactivation();
-    connection->setAdapterAndServantManager(ICE_SHARED_FROM_THIS, _servantManager);
+    connection->setAdapterAndServantManager(ICE_SHARED_FROM_THIS, _servantManager, _dispatchLanes,
+                                            _concurrencyLimiter);
 }
 
 //
@@ -1034,6 +1064,9 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             _threadPool = new ThreadPool(_instance, _name + ".ThreadPool", 0);
         }
 
+        _dispatchLanes = DispatchLanes::create(_instance, _name, getThreadPool());
+        _concurrencyLimiter = ConcurrencyLimiter::create(_instance, _name);
+
         if(!router)
         {
             const_cast<RouterPrxPtr&>(router) = ICE_UNCHECKED_CAST(RouterPrx,
@@ -1454,6 +1487,10 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Heartbeat",
         "ACM.Timeout",
         "AdapterId",
+        "ConcurrencyLimit",
+        "ConcurrencyLimit.Latency",
+        "ConcurrencyLimit.Max",
+        "ConcurrencyLimit.Min",
         "Endpoints",
         "Locator",
         "Locator.EncodingVersion",
@@ -1481,6 +1518,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.LocatorCacheTimeout",
         "Router.InvocationTimeout",
         "ProxyOptions",
+        "LaneContext",
         "ThreadPool.Size",
         "ThreadPool.SizeMax",
         "ThreadPool.SizeWarn",
@@ -1520,6 +1558,12 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
             }
         }
 
+        if(!valid && p->first.find(prefix + "Lane.") == 0)
+        {
+            noProps = false;
+            valid = true;
+        }
+
         if(!valid && addUnknown)
         {
             unknownProps.push_back(p->first);
@@ -20,6 +20,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/LocatorInfoF.h>
 #include <Ice/ThreadPoolF.h>
+#include <Ice/DispatchLanesF.h>
+#include <Ice/ConcurrencyLimiterF.h>
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/Exception.h>
 #include <Ice/BuiltinSequences.h>
@@ -101,6 +103,8 @@ public:
 
     IceInternal::ThreadPoolPtr getThreadPool() const;
     IceInternal::ServantManagerPtr getServantManager() const;
+    IceInternal::DispatchLanesPtr getDispatchLanes() const;
+    IceInternal::ConcurrencyLimiterPtr getConcurrencyLimiter() const;
     IceInternal::ACMConfig getACM() const;
     void setAdapterOnConnection(const Ice::ConnectionIPtr&);
     size_t messageSizeMax() const { return _messageSizeMax; }
@@ -141,6 +145,8 @@ private:
     IceInternal::ThreadPoolPtr _threadPool;
     IceInternal::ACMConfig _acm;
     IceInternal::ServantManagerPtr _servantManager;
+    IceInternal::DispatchLanesPtr _dispatchLanes;
+    IceInternal::ConcurrencyLimiterPtr _concurrencyLimiter;
     const std::string _name;
     const std::string _id;
     const std::string _replicaGroupId;
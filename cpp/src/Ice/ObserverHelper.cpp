@@ -6,6 +6,7 @@
 #include <Ice/Reference.h>
 #include <Ice/Instance.h>
 #include <Ice/Proxy.h>
+#include <Ice/InstrumentationI.h>
 
 using namespace std;
 using namespace Ice;
@@ -54,3 +55,42 @@ IceInternal::InvocationObserver::attach(IceInternal::Instance* instance, const s
 
     attach(obsv->getInvocationObserver(0, op, Ice::noExplicitContext));
 }
+
+void
+IceInternal::DispatchObserver::expired()
+{
+    if(_observer)
+    {
+        DispatchObserverI* observer = dynamic_cast<DispatchObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->expired();
+        }
+    }
+}
+
+void
+IceInternal::DispatchObserver::rejected()
+{
+    if(_observer)
+    {
+        DispatchObserverI* observer = dynamic_cast<DispatchObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->rejected();
+        }
+    }
+}
+
+void
+IceInternal::DispatchObserver::concurrency(Int limit, Int inflight)
+{
+    if(_observer)
+    {
+        DispatchObserverI* observer = dynamic_cast<DispatchObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->concurrency(limit, inflight);
+        }
+    }
+}
@@ -12,9 +12,14 @@
 #include <Ice/ImplicitContextI.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/EndpointLatencyTable.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/DispatchDeadline.h>
+#include <Ice/Hedging.h>
+
+#include <sstream>
 
 using namespace std;
 using namespace Ice;
@@ -26,6 +31,28 @@ IceUtil::Shared* IceInternal::upCast(ProxyOutgoingAsyncBase* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(OutgoingAsync* p) { return p; }
 #endif
 
+namespace
+{
+
+Context
+addContextEntries(const Context& context, bool deadline, int timeout, bool chunks)
+{
+    Context ctx = context;
+    if(deadline)
+    {
+        ostringstream os;
+        os << timeout;
+        ctx[deadlineContextKey] = os.str();
+    }
+    if(chunks)
+    {
+        ctx[chunksContextKey] = "1";
+    }
+    return ctx;
+}
+
+}
+
 const unsigned char OutgoingAsyncBase::OK = 0x1;
 const unsigned char OutgoingAsyncBase::Sent = 0x2;
 #ifndef ICE_CPP11_MAPPING
@@ -525,6 +552,17 @@ OutgoingAsyncBase::_throwUserException()
     }
 }
 
+Ice::InputStream*
+OutgoingAsyncBase::_startReadChunk()
+{
+    return 0; // Only the invocation of an operation with a streamed result receives chunks.
+}
+
+void
+OutgoingAsyncBase::_endReadChunk()
+{
+}
+
 void
 OutgoingAsyncBase::_scheduleCallback(const CallbackPtr& cb)
 {
@@ -591,6 +629,11 @@ OutgoingAsyncBase::warning() const
 bool
 ProxyOutgoingAsyncBase::exception(const Exception& exc)
 {
+    if(hedgedResponse())
+    {
+        return false;
+    }
+
     if(_childObserver)
     {
         _childObserver.failed(exc.ice_id());
@@ -598,7 +641,7 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
     }
 
     _cachedConnection = 0;
-    if(_proxy->_getReference()->getInvocationTimeout() == -2)
+    if(_invocationTimeout == -2)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
@@ -626,7 +669,7 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
 void
 ProxyOutgoingAsyncBase::cancelable(const CancellationHandlerPtr& handler)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() == -2 && _cachedConnection)
+    if(_invocationTimeout == -2 && _cachedConnection)
     {
         const int timeout = _cachedConnection->timeout();
         if(timeout > 0)
@@ -704,9 +747,31 @@ ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(const ObjectPrxPtr& prx) :
     OutgoingAsyncBase(prx->_getReference()->getInstance()),
     _proxy(prx),
     _mode(ICE_ENUM(OperationMode, Normal)),
+    _invocationTimeout(prx->_getReference()->getInvocationTimeout()),
+    _propagateDeadline(false),
     _cnt(0),
     _sent(false)
 {
+    if(prx->_getReference()->getMode() == Reference::ModeTwoway && _invocationTimeout != -2)
+    {
+        //
+        // A twoway invocation made by a thread dispatching a request with a deadline
+        // inherits the deadline.
+        //
+        IceUtil::Time deadline = DispatchDeadline::current();
+        if(deadline != IceUtil::Time())
+        {
+            IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            int remaining = deadline > now ? static_cast<int>((deadline - now).toMilliSeconds()) : 0;
+            remaining = max(remaining, 1);
+            _invocationTimeout = _invocationTimeout > 0 ? min(_invocationTimeout, remaining) : remaining;
+            _propagateDeadline = true;
+        }
+        else
+        {
+            _propagateDeadline = _invocationTimeout > 0 && _instance->propagateDeadline();
+        }
+    }
 }
 
 ProxyOutgoingAsyncBase::~ProxyOutgoingAsyncBase()
@@ -720,10 +785,9 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
     {
         if(userThread)
         {
-            int invocationTimeout = _proxy->_getReference()->getInvocationTimeout();
-            if(invocationTimeout > 0)
+            if(_invocationTimeout > 0)
             {
-                _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(invocationTimeout));
+                _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(_invocationTimeout));
             }
         }
         else
@@ -805,7 +869,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
     _sent = true;
     if(done)
     {
-        if(_proxy->_getReference()->getInvocationTimeout() != -1)
+        if(_invocationTimeout != -1)
         {
             _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
         }
@@ -816,27 +880,61 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    if(_invocationTimeout != -1)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
+    if(_hedging)
+    {
+        if(hedgedResponse())
+        {
+            return false;
+        }
+        _hedging->completed(static_cast<OutgoingAsync*>(this));
+    }
     return OutgoingAsyncBase::exceptionImpl(ex);
 }
 
+bool
+ProxyOutgoingAsyncBase::hedgedResponse()
+{
+    //
+    // Once another attempt replied, the hedging cancels the invocation to remove its request
+    // from the request handler. The invocation then completes with the reply of the attempt,
+    // swapped into _is by takeReply, instead of the cancellation exception.
+    //
+    if(!_hedging || !_hedging->takeReply(static_cast<OutgoingAsync*>(this), _is))
+    {
+        return false;
+    }
+
+    _childObserver.detach();
+    _cachedConnection = 0;
+    if(response())
+    {
+        invokeResponseAsync();
+    }
+    return true;
+}
+
 bool
 ProxyOutgoingAsyncBase::responseImpl(bool ok, bool invoke)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    if(_invocationTimeout != -1)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
+    if(_hedging)
+    {
+        _hedging->completed(static_cast<OutgoingAsync*>(this));
+    }
     return OutgoingAsyncBase::responseImpl(ok, invoke);
 }
 
 void
 ProxyOutgoingAsyncBase::runTimerTask()
 {
-    if(_proxy->_getReference()->getInvocationTimeout() == -2)
+    if(_invocationTimeout == -2)
     {
         cancel(ConnectionTimeoutException(__FILE__, __LINE__));
     }
@@ -849,10 +947,27 @@ ProxyOutgoingAsyncBase::runTimerTask()
 OutgoingAsync::OutgoingAsync(const ObjectPrxPtr& prx, bool synchronous) :
     ProxyOutgoingAsyncBase(prx),
     _encoding(getCompatibleEncoding(prx->_getReference()->getEncoding())),
-    _synchronous(synchronous)
+    _synchronous(synchronous),
+    _requestChunks(false),
+    _chunked(false),
+#ifdef ICE_CPP11_MAPPING
+    _chunksPending(false),
+    _invokingChunks(false)
+#else
+    _chunksDiscarded(false),
+    _chunkIs(_instance.get(), currentProtocolEncoding)
+#endif
 {
 }
 
+OutgoingAsync::~OutgoingAsync()
+{
+    for(list<InputStream*>::const_iterator p = _chunks.begin(); p != _chunks.end(); ++p)
+    {
+        delete *p;
+    }
+}
+
 void
 OutgoingAsync::prepare(const string& operation, OperationMode mode, const Context& context)
 {
@@ -915,7 +1030,14 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         // Explicit context
         //
-        _os.write(context);
+        if(_propagateDeadline || _requestChunks)
+        {
+            _os.write(addContextEntries(context, _propagateDeadline, _invocationTimeout, _requestChunks));
+        }
+        else
+        {
+            _os.write(context);
+        }
     }
     else
     {
@@ -926,11 +1048,26 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         const Context& prxContext = ref->getContext()->getValue();
         if(implicitContext == 0)
         {
-            _os.write(prxContext);
+            if(_propagateDeadline || _requestChunks)
+            {
+                _os.write(addContextEntries(prxContext, _propagateDeadline, _invocationTimeout, _requestChunks));
+            }
+            else
+            {
+                _os.write(prxContext);
+            }
         }
         else
         {
-            implicitContext->write(prxContext, &_os);
+            if(_propagateDeadline || _requestChunks)
+            {
+                implicitContext->write(addContextEntries(prxContext, _propagateDeadline, _invocationTimeout,
+                                                         _requestChunks), &_os);
+            }
+            else
+            {
+                implicitContext->write(prxContext, &_os);
+            }
         }
     }
 }
@@ -941,6 +1078,35 @@ OutgoingAsync::sent()
     return ProxyOutgoingAsyncBase::sentImpl(!_proxy->ice_isTwoway()); // done = true if it's not a two-way proxy
 }
 
+bool
+OutgoingAsync::exception(const Exception& ex)
+{
+    latencyCompleted(false);
+
+    bool chunked;
+    {
+        Lock sync(_m);
+        chunked = _chunked;
+    }
+
+    if(!chunked)
+    {
+        return ProxyOutgoingAsyncBase::exception(ex);
+    }
+
+    //
+    // The invocation isn't retried once chunks of the result were received, the
+    // application might already have consumed them.
+    //
+    if(_childObserver)
+    {
+        _childObserver.failed(ex.ice_id());
+        _childObserver.detach();
+    }
+    _cachedConnection = 0;
+    return exceptionImpl(ex);
+}
+
 bool
 OutgoingAsync::response()
 {
@@ -951,6 +1117,8 @@ OutgoingAsync::response()
     //
     assert(_proxy->ice_isTwoway()); // Can only be called for twoways.
 
+    latencyCompleted(true);
+
     if(_childObserver)
     {
         _childObserver->reply(static_cast<Int>(_is.b.size() - headerSize - 4));
@@ -1074,6 +1242,11 @@ OutgoingAsync::response()
                 break;
             }
 
+            case replyServerBusy:
+            {
+                throw ServerBusyException(__FILE__, __LINE__);
+            }
+
             default:
             {
                 throw UnknownReplyStatusException(__FILE__, __LINE__);
@@ -1088,13 +1261,306 @@ OutgoingAsync::response()
     }
 }
 
+bool
+OutgoingAsync::chunk(InputStream& is, const ConnectionIPtr& connection, const ICE_DELEGATE(ChunkReadyCallback)& ready)
+{
+    //
+    // NOTE: this method is called from ConnectionI.parseMessage
+    // with the connection locked. Therefore, it must not invoke
+    // any user callbacks.
+    //
+#ifdef ICE_CPP11_MAPPING
+    class InvokeChunks : public DispatchWorkItem
+    {
+    public:
+
+        InvokeChunks(const ConnectionPtr& connection, const OutgoingAsyncPtr& outAsync) :
+            DispatchWorkItem(connection), _outAsync(outAsync)
+        {
+        }
+
+        virtual void
+        run()
+        {
+            _outAsync->invokeChunks(false);
+        }
+
+    private:
+
+        const OutgoingAsyncPtr _outAsync;
+    };
+
+    bool dispatch = false;
+#endif
+    if(_hedging)
+    {
+        _hedging->chunk();
+    }
+
+    bool resume = true;
+    {
+        Lock sync(_m);
+        _chunked = true;
+#ifdef ICE_CPP11_MAPPING
+        if(!_chunk)
+        {
+            return true; // Nobody to consume the chunks.
+        }
+#else
+        if(!_requestChunks || _chunksDiscarded)
+        {
+            return true; // Nobody to consume the chunks.
+        }
+#endif
+
+        InputStream* stream = new InputStream(_instance.get(), currentProtocolEncoding);
+        stream->swap(is);
+        _chunks.push_back(stream);
+
+#ifdef ICE_CPP11_MAPPING
+        dispatch = !_chunksPending;
+        _chunksPending = true;
+#else
+        _m.notifyAll();
+#endif
+
+        if(_chunks.size() >= _instance->streamChunkWindow())
+        {
+            if(connection)
+            {
+                _chunkConnection = connection;
+            }
+            else
+            {
+                _chunkReady = ready;
+            }
+            resume = false;
+        }
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    if(dispatch)
+    {
+        try
+        {
+            _instance->clientThreadPool()->dispatch(new InvokeChunks(_cachedConnection,
+                                                                     static_pointer_cast<OutgoingAsync>(shared_from_this())));
+        }
+        catch(const CommunicatorDestroyedException&)
+        {
+            // Ignore, the invocation fails once the connection is closed.
+        }
+    }
+#endif
+    return resume;
+}
+
+void
+OutgoingAsync::invokeException()
+{
+#ifdef ICE_CPP11_MAPPING
+    if(_chunk)
+    {
+        invokeChunks(true); // The chunks are invoked before the exception callback.
+    }
+#endif
+    ProxyOutgoingAsyncBase::invokeException();
+}
+
+void
+OutgoingAsync::invokeResponse()
+{
+#ifdef ICE_CPP11_MAPPING
+    if(_chunk)
+    {
+        invokeChunks(true); // The chunks are invoked before the response callback.
+    }
+#endif
+    ProxyOutgoingAsyncBase::invokeResponse();
+}
+
+#ifndef ICE_CPP11_MAPPING
+bool
+OutgoingAsync::_waitForResponse()
+{
+    //
+    // The chunks which weren't read are discarded once the end_ method is called.
+    //
+    ConnectionIPtr connection;
+    ChunkReadyCallbackPtr ready;
+    {
+        Lock sync(_m);
+        _chunksDiscarded = true;
+        for(list<InputStream*>::const_iterator p = _chunks.begin(); p != _chunks.end(); ++p)
+        {
+            delete *p;
+        }
+        _chunks.clear();
+        connection = _chunkConnection;
+        _chunkConnection = 0;
+        ready = _chunkReady;
+        _chunkReady = 0;
+    }
+    resumeChunks(connection, ready);
+    return ProxyOutgoingAsyncBase::_waitForResponse();
+}
+
+Ice::InputStream*
+OutgoingAsync::_startReadChunk()
+{
+    ConnectionIPtr connection;
+    ChunkReadyCallbackPtr ready;
+    {
+        Lock sync(_m);
+        if(_state & EndCalled)
+        {
+            throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, "next_ method called after end_ method");
+        }
+        while(_chunks.empty() && !(_state & Done))
+        {
+            _m.wait();
+        }
+        if(_chunks.empty())
+        {
+            return 0; // No more chunks, the end_ method returns or raises the result.
+        }
+        popChunk(_chunkIs, connection, ready);
+    }
+    resumeChunks(connection, ready);
+    _chunkIs.startEncapsulation();
+    return &_chunkIs;
+}
+
+void
+OutgoingAsync::_endReadChunk()
+{
+    _chunkIs.endEncapsulation();
+}
+#endif
+
+void
+OutgoingAsync::popChunk(InputStream& is, ConnectionIPtr& connection, ICE_DELEGATE(ChunkReadyCallback)& ready)
+{
+    //
+    // Must be called with _m locked. Returns the connection or the collocated producer to
+    // resume once half of the chunks window is consumed.
+    //
+    assert(!_chunks.empty());
+    is.swap(*_chunks.front());
+    delete _chunks.front();
+    _chunks.pop_front();
+
+    if((_chunkConnection || _chunkReady) && _chunks.size() <= _instance->streamChunkWindow() / 2)
+    {
+        connection = _chunkConnection;
+        _chunkConnection = ICE_NULLPTR;
+        ready = _chunkReady;
+        _chunkReady = ICE_NULLPTR;
+    }
+}
+
+void
+OutgoingAsync::resumeChunks(const ConnectionIPtr& connection, const ICE_DELEGATE(ChunkReadyCallback)& ready)
+{
+    if(connection)
+    {
+        connection->resumeReading();
+    }
+    if(ready)
+    {
+#ifdef ICE_CPP11_MAPPING
+        ready();
+#else
+        ready->ready();
+#endif
+    }
+}
+
+#ifdef ICE_CPP11_MAPPING
+void
+OutgoingAsync::invokeChunks(bool wait)
+{
+    //
+    // Invoke the chunk callback with the queued chunks in order. The callback is only
+    // invoked by one thread at a time, the thread invoking the response or exception
+    // callback first waits for the chunks to be invoked.
+    //
+    unique_lock<mutex> lock(_m);
+    if(!wait)
+    {
+        _chunksPending = false;
+        if(_invokingChunks)
+        {
+            return; // The thread invoking the chunks will invoke the new chunk.
+        }
+    }
+    _chunksInvoked.wait(lock, [this] { return !_invokingChunks; });
+    _invokingChunks = true;
+    while(!_chunks.empty())
+    {
+        InputStream is(_instance.get(), currentProtocolEncoding);
+        ConnectionIPtr connection;
+        ChunkReadyCallback ready;
+        popChunk(is, connection, ready);
+        lock.unlock();
+        resumeChunks(connection, ready);
+        try
+        {
+            _chunk(&is);
+        }
+        catch(const std::exception& ex)
+        {
+            warning(ex);
+        }
+        catch(...)
+        {
+            warning();
+        }
+        lock.lock();
+    }
+    _invokingChunks = false;
+    _chunksInvoked.notify_all();
+}
+#endif
+
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    if(response && _proxy->_getReference()->getEndpointSelection() == ICE_ENUM(EndpointSelectionType, LeastLatency))
+    {
+        //
+        // Track the round-trip time and the outstanding requests of the endpoint for
+        // the endpoint selection, the request completes with response() or exception().
+        //
+        _latencyConnection = connection;
+        _latencyStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        _instance->endpointLatencyTable()->sent(connection->endpoint());
+        try
+        {
+            return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
+        }
+        catch(const Ice::Exception&)
+        {
+            latencyCompleted(false);
+            throw;
+        }
+    }
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
 
+void
+OutgoingAsync::latencyCompleted(bool ok)
+{
+    if(_latencyConnection)
+    {
+        _instance->endpointLatencyTable()->completed(_latencyConnection->endpoint(),
+                                                     IceUtil::Time::now(IceUtil::Time::Monotonic) - _latencyStart,
+                                                     ok);
+        _latencyConnection = 0;
+    }
+}
+
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
@@ -1130,12 +1596,32 @@ OutgoingAsync::invoke(const string& operation)
         return;
     }
 
+    //
+    // An idempotent twoway invocation is hedged if enabled on the proxy, the
+    // request is copied from _os for each attempt.
+    //
+    Reference* ref = _proxy->_getReference().get();
+    if(ref->getHedgingMaxAttempts() > 1 && mode == Reference::ModeTwoway &&
+       _mode != ICE_ENUM(OperationMode, Normal) && !_proxy->ice_isFixed())
+    {
+#ifdef ICE_CPP11_MAPPING
+        _hedging = make_shared<Hedging>(static_pointer_cast<OutgoingAsync>(shared_from_this()), _proxy, _mode);
+#else
+        _hedging = new Hedging(this, _proxy, _mode);
+#endif
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort(ex) in case of an
     // exception.
     //
     invokeImpl(true); // userThread = true
+
+    if(_hedging)
+    {
+        _hedging->start();
+    }
 }
 
 #ifdef ICE_CPP11_MAPPING
@@ -128,6 +128,7 @@ Ice::OutputStream::initialize(Instance* instance, const EncodingVersion& encodin
 
     _instance = instance;
     _encoding = encoding;
+    b.setPoolSize(_instance->bufferPoolSize());
 
     _format = _instance->defaultsAndOverrides()->defaultFormat;
 }
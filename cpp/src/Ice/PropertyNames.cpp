@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Sep  6 18:11:04 2019
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 09:14:43 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -59,7 +59,17 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Shards", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Backend", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.Lane.*", false, 0),
+    IceInternal::Property("Ice.Admin.LaneContext", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -71,14 +81,21 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BufferPoolSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Adaptive", false, 0),
+    IceInternal::Property("Ice.Compression.Codec", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.MaxRatio", false, 0),
+    IceInternal::Property("Ice.Compression.ProbeInterval", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectAttemptDelay", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
@@ -114,6 +131,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.NegativeCacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.Size", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
@@ -121,6 +141,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.LogFile", false, 0),
     IceInternal::Property("Ice.LogFile.SizeMax", false, 0),
     IceInternal::Property("Ice.LogStdErr.Convert", false, 0),
+    IceInternal::Property("Ice.MessageFragmentSize", false, 0),
     IceInternal::Property("Ice.MessageSizeMax", false, 0),
     IceInternal::Property("Ice.Nohup", false, 0),
     IceInternal::Property("Ice.NullHandleAbort", false, 0),
@@ -137,13 +158,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintAdapterReady", false, 0),
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
+    IceInternal::Property("Ice.PropagateDeadline", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
+    IceInternal::Property("Ice.SendQueueLengthMax", false, 0),
+    IceInternal::Property("Ice.SendQueueSizeMax", false, 0),
+    IceInternal::Property("Ice.SendQueueWait", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
     IceInternal::Property("Ice.SOCKSProxyPort", false, 0),
     IceInternal::Property("Ice.StdErr", false, 0),
     IceInternal::Property("Ice.StdOut", false, 0),
+    IceInternal::Property("Ice.StreamChunkWindow", false, 0),
     IceInternal::Property("Ice.SyslogFacility", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeMax", false, 0),
@@ -152,6 +178,10 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Shards", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchWorkers", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Backend", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BackendQueueSize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -159,7 +189,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Shards", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchWorkers", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Backend", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BackendQueueSize", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Timer.Shards", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
@@ -169,11 +204,13 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.UDP.BatchSize", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
     IceInternal::Property("Ice.TCP.RcvSize", false, 0),
     IceInternal::Property("Ice.TCP.SndSize", false, 0),
+    IceInternal::Property("Ice.TCP.ZeroCopySize", false, 0),
     IceInternal::Property("Ice.UseApplicationClassLoader", false, 0),
     IceInternal::Property("Ice.UseOSLog", false, 0),
     IceInternal::Property("Ice.UseSyslog", false, 0),
@@ -185,6 +222,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Warn.Endpoints", false, 0),
     IceInternal::Property("Ice.Warn.UnknownProperties", false, 0),
     IceInternal::Property("Ice.Warn.UnusedProperties", false, 0),
+    IceInternal::Property("Ice.WriteCoalesceSize", false, 0),
     IceInternal::Property("Ice.CacheMessageBuffers", false, 0),
     IceInternal::Property("Ice.ThreadInterruptSafe", false, 0),
     IceInternal::Property("Ice.Voip", true, 0),
@@ -246,7 +284,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Lane.*", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.LaneContext", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -283,7 +331,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Lane.*", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.LaneContext", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -320,7 +378,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Lane.*", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.LaneContext", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -373,7 +441,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Lane.*", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.LaneContext", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
@@ -410,7 +488,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Lane.*", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.LaneContext", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.RetryCount", false, 0),
@@ -507,7 +595,17 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
+    IceInternal::Property("IceBridge.Source.Lane.*", false, 0),
+    IceInternal::Property("IceBridge.Source.LaneContext", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceBridge.Target.Endpoints", false, 0),
     IceInternal::Property("IceBridge.InstanceName", false, 0),
 };
@@ -562,7 +660,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Lane.*", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.LaneContext", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Address", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Interface", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Lookup", false, 0),
@@ -602,7 +710,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Lane.*", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.LaneContext", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
@@ -639,7 +757,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Lane.*", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.LaneContext", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -686,7 +814,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -724,7 +862,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Node.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -802,7 +950,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
@@ -849,7 +1007,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
@@ -888,7 +1056,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -930,7 +1108,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
@@ -984,7 +1172,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -1022,7 +1220,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Lane.*", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.LaneContext", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -1093,7 +1301,17 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Shards", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Backend", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.Lane.*", false, 0),
+    IceInternal::Property("IcePatch2.LaneContext", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
@@ -1226,7 +1444,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Shards", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Backend", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.Lane.*", false, 0),
+    IceInternal::Property("Glacier2.Client.LaneContext", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1301,7 +1529,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Shards", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchWorkers", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Backend", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BackendQueueSize", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.Lane.*", false, 0),
+    IceInternal::Property("Glacier2.Server.LaneContext", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Latency", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
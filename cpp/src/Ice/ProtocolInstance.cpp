@@ -123,6 +123,12 @@ IceInternal::ProtocolInstance::messageSizeMax() const
     return _instance->messageSizeMax();
 }
 
+size_t
+IceInternal::ProtocolInstance::tcpZeroCopySize() const
+{
+    return _instance->tcpZeroCopySize();
+}
+
 void
 IceInternal::ProtocolInstance::resolve(const string& host, int port, EndpointSelectionType type,
                                        const IPEndpointIPtr& endpt, const EndpointI_connectorsPtr& cb) const
@@ -70,6 +70,7 @@ public:
     const Ice::EncodingVersion& defaultEncoding() const;
     NetworkProxyPtr networkProxy() const;
     size_t messageSizeMax() const;
+    size_t tcpZeroCopySize() const;
     int defaultTimeout() const;
 
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
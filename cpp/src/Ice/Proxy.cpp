@@ -1073,6 +1073,43 @@ ICE_OBJECT_PRX::ice_invocationTimeout(Int newTimeout) const
     }
 }
 
+Int
+ICE_OBJECT_PRX::ice_getHedgingDelay() const
+{
+    return _reference->getHedgingDelay();
+}
+
+Int
+ICE_OBJECT_PRX::ice_getHedgingMaxAttempts() const
+{
+    return _reference->getHedgingMaxAttempts();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_hedging(Int delay, Int maxAttempts) const
+{
+    if(delay < 0 || maxAttempts < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_hedging: " << delay << ", " << maxAttempts;
+#ifdef ICE_CPP11_MAPPING
+        throw invalid_argument(s.str());
+#else
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+#endif
+    }
+    if(delay == _reference->getHedgingDelay() && maxAttempts == _reference->getHedgingMaxAttempts())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = _newInstance();
+        proxy->setup(_reference->changeHedging(delay, maxAttempts));
+        return proxy;
+    }
+}
+
 ObjectPrxPtr
 ICE_OBJECT_PRX::ice_twoway() const
 {
@@ -1350,6 +1387,9 @@ ICE_OBJECT_PRX::_handleException(const Exception& ex,
     // "at-most-once" (see the implementation of the checkRetryAfterException method
     //  of the ProxyFactory class for the reasons why it can be useful).
     //
+    // A ServerBusyException indicates that the server rejected the request without
+    // dispatching it, and is therefore always repeatable as well.
+    //
     // If the request didn't get sent or if it's non-mutating or idempotent it can
     // also always be retried if the retry count isn't reached.
     //
@@ -1357,7 +1397,8 @@ ICE_OBJECT_PRX::_handleException(const Exception& ex,
     if(localEx && (!sent ||
                    mode == ICE_ENUM(OperationMode, Nonmutating) || mode == ICE_ENUM(OperationMode, Idempotent) ||
                    dynamic_cast<const CloseConnectionException*>(&ex) ||
-                   dynamic_cast<const ObjectNotExistException*>(&ex)))
+                   dynamic_cast<const ObjectNotExistException*>(&ex) ||
+                   dynamic_cast<const ServerBusyException*>(&ex)))
     {
         try
         {
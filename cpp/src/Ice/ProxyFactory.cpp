@@ -214,6 +214,15 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
         ex.ice_throw();
     }
 
+    //
+    // Don't retry if the send queue of the connection is full, the caller asked to
+    // fail instead of waiting for the queue to drain.
+    //
+    if(dynamic_cast<const SendQueueFullException*>(&ex))
+    {
+        ex.ice_throw();
+    }
+
     ++cnt;
     assert(cnt > 0);
 
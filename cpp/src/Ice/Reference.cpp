@@ -22,6 +22,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointLatencyTable.h>
 #include <Ice/Comparable.h>
 #include <Ice/StringUtil.h>
 
@@ -136,6 +137,19 @@ IceInternal::Reference::changeInvocationTimeout(int invocationTimeout) const
     return r;
 }
 
+ReferencePtr
+IceInternal::Reference::changeHedging(int delay, int maxAttempts) const
+{
+    if(_hedgingDelay == delay && _hedgingMaxAttempts == maxAttempts)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_hedgingDelay = delay;
+    r->_hedgingMaxAttempts = maxAttempts;
+    return r;
+}
+
 ReferencePtr
 IceInternal::Reference::changeEncoding(const Ice::EncodingVersion& encoding) const
 {
@@ -389,6 +403,11 @@ IceInternal::Reference::operator==(const Reference& r) const
     {
         return false;
     }
+
+    if(_hedgingDelay != r._hedgingDelay || _hedgingMaxAttempts != r._hedgingMaxAttempts)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -491,6 +510,24 @@ IceInternal::Reference::operator<(const Reference& r) const
         return false;
     }
 
+    if(_hedgingDelay < r._hedgingDelay)
+    {
+        return true;
+    }
+    else if(r._hedgingDelay < _hedgingDelay)
+    {
+        return false;
+    }
+
+    if(_hedgingMaxAttempts < r._hedgingMaxAttempts)
+    {
+        return true;
+    }
+    else if(r._hedgingMaxAttempts < _hedgingMaxAttempts)
+    {
+        return false;
+    }
+
     return false;
 }
 
@@ -539,6 +576,8 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _protocol(protocol),
     _encoding(encoding),
     _invocationTimeout(invocationTimeout),
+    _hedgingDelay(0),
+    _hedgingMaxAttempts(1),
     _overrideCompress(false),
     _compress(false)
 {
@@ -557,6 +596,8 @@ IceInternal::Reference::Reference(const Reference& r) :
     _protocol(r._protocol),
     _encoding(r._encoding),
     _invocationTimeout(r._invocationTimeout),
+    _hedgingDelay(r._hedgingDelay),
+    _hedgingMaxAttempts(r._hedgingMaxAttempts),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
@@ -582,6 +623,8 @@ IceInternal::Reference::hashInit() const
     hashAdd(h, _encoding.major);
     hashAdd(h, _encoding.minor);
     hashAdd(h, _invocationTimeout);
+    hashAdd(h, _hedgingDelay);
+    hashAdd(h, _hedgingMaxAttempts);
     return h;
 }
 
@@ -1288,7 +1331,24 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] = _endpointSelection == ICE_ENUM(EndpointSelectionType, Random) ? "Random" : "Ordered";
+    switch(_endpointSelection)
+    {
+        case ICE_ENUM(EndpointSelectionType, Random):
+        {
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        }
+        case ICE_ENUM(EndpointSelectionType, Ordered):
+        {
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        }
+        case ICE_ENUM(EndpointSelectionType, LeastLatency):
+        {
+            properties[prefix + ".EndpointSelection"] = "LeastLatency";
+            break;
+        }
+    }
     {
         ostringstream s;
         s << _locatorCacheTimeout;
@@ -1979,6 +2039,16 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case ICE_ENUM(EndpointSelectionType, LeastLatency):
+        {
+            //
+            // Power of two choices: the best of the first two endpoints of the shuffled
+            // endpoints is used first.
+            //
+            IceUtilInternal::shuffle(endpoints.begin(), endpoints.end());
+            getInstance()->endpointLatencyTable()->select(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
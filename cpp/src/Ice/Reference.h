@@ -67,6 +67,8 @@ public:
     const InstancePtr& getInstance() const { return _instance; }
     const SharedContextPtr& getContext() const { return _context; }
     int getInvocationTimeout() const { return _invocationTimeout; }
+    int getHedgingDelay() const { return _hedgingDelay; }
+    int getHedgingMaxAttempts() const { return _hedgingMaxAttempts; }
     IceUtil::Optional<bool> getCompress() const
     {
         return _overrideCompress ? IceUtil::Optional<bool>(_compress) : IceUtil::None;
@@ -97,6 +99,7 @@ public:
     ReferencePtr changeIdentity(const Ice::Identity&) const;
     ReferencePtr changeFacet(const std::string&) const;
     ReferencePtr changeInvocationTimeout(int) const;
+    ReferencePtr changeHedging(int, int) const;
     virtual ReferencePtr changeEncoding(const Ice::EncodingVersion&) const;
     virtual ReferencePtr changeCompress(bool) const;
 
@@ -174,6 +177,8 @@ private:
     Ice::ProtocolVersion _protocol;
     Ice::EncodingVersion _encoding;
     int _invocationTimeout;
+    int _hedgingDelay;
+    int _hedgingMaxAttempts;
 
 protected:
 
@@ -818,10 +818,14 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             {
                 endpointSelection = ICE_ENUM(EndpointSelectionType, Ordered);
             }
+            else if(type == "LeastLatency")
+            {
+                endpointSelection = ICE_ENUM(EndpointSelectionType, LeastLatency);
+            }
             else
             {
                 throw EndpointSelectionTypeParseException(__FILE__, __LINE__, "illegal value `" + type +
-                                                          "'; expected `Random' or `Ordered'");
+                                                          "'; expected `Random', `Ordered' or `LeastLatency'");
             }
         }
 
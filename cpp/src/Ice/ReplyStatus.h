@@ -18,6 +18,15 @@ static const Ice::Byte replyOperationNotExist = 4;
 static const Ice::Byte replyUnknownLocalException = 5;
 static const Ice::Byte replyUnknownUserException = 6;
 static const Ice::Byte replyUnknownException = 7;
+static const Ice::Byte replyChunk = 8; // A chunk of a streamed result, followed by other replies.
+static const Ice::Byte replyServerBusy = 9; // The request was rejected without being dispatched.
+
+//
+// The request context entry with which a client requests the result of an operation with the
+// cpp:stream metadata as replyChunk replies, the server otherwise sends the result with a single
+// reply.
+//
+static const char* const chunksContextKey = "_chunks";
 
 }
 
@@ -9,6 +9,7 @@
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/DefaultsAndOverrides.h>
 
 using namespace std;
 using namespace IceInternal;
@@ -29,9 +30,14 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    //
+    // Proxies with the same reference share the connection request handler unless the
+    // connections are pooled, in which case each proxy gets its own connection from the
+    // pool.
+    //
     ConnectRequestHandlerPtr handler;
     bool connect = false;
-    if(ref->getCacheConnection())
+    if(ref->getCacheConnection() && _instance->defaultsAndOverrides()->defaultConnectionPoolSize == 1)
     {
         Lock sync(*this);
         map<ReferencePtr, ConnectRequestHandlerPtr>::iterator p = _handlers.find(ref);
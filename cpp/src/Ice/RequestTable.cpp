@@ -0,0 +1,192 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/RequestTable.h>
+#include <Ice/OutgoingAsync.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const size_t minSize = 16; // Must be a power of 2.
+
+struct RequestIdLess
+{
+    template<typename T> bool operator()(const T& lhs, const T& rhs) const
+    {
+        return lhs.requestId < rhs.requestId;
+    }
+};
+
+}
+
+IceInternal::RequestTable::RequestTable() :
+    _slots(minSize),
+    _mask(minSize - 1),
+    _size(0)
+{
+}
+
+void
+IceInternal::RequestTable::add(Int requestId, const OutgoingAsyncBasePtr& outAsync)
+{
+    assert(requestId > 0);
+
+    //
+    // Keep the load factor under 1/2 to keep the probe sequences short.
+    //
+    if((_size + 1) * 2 > _slots.size())
+    {
+        resize(_slots.size() * 2);
+    }
+
+    size_t i = static_cast<size_t>(requestId) & _mask;
+    while(_slots[i].requestId != 0)
+    {
+        assert(_slots[i].requestId != requestId);
+        i = (i + 1) & _mask;
+    }
+    _slots[i].requestId = requestId;
+    _slots[i].outAsync = outAsync;
+    ++_size;
+}
+
+OutgoingAsyncBasePtr
+IceInternal::RequestTable::remove(Int requestId)
+{
+    OutgoingAsyncBasePtr outAsync;
+    size_t i = find(requestId);
+    if(i < _slots.size())
+    {
+        outAsync = _slots[i].outAsync;
+        erase(i);
+    }
+    return outAsync;
+}
+
+OutgoingAsyncBasePtr
+IceInternal::RequestTable::get(Int requestId) const
+{
+    size_t i = find(requestId);
+    return i < _slots.size() ? _slots[i].outAsync : OutgoingAsyncBasePtr();
+}
+
+bool
+IceInternal::RequestTable::contains(Int requestId, const OutgoingAsyncBasePtr& outAsync) const
+{
+    size_t i = find(requestId);
+    return i < _slots.size() && _slots[i].outAsync.get() == outAsync.get();
+}
+
+void
+IceInternal::RequestTable::removeAll(vector<OutgoingAsyncBasePtr>& requests)
+{
+    vector<Slot> slots;
+    slots.reserve(_size);
+    for(vector<Slot>::const_iterator p = _slots.begin(); p != _slots.end(); ++p)
+    {
+        if(p->requestId != 0)
+        {
+            slots.push_back(*p);
+        }
+    }
+    sort(slots.begin(), slots.end(), RequestIdLess());
+
+    requests.reserve(requests.size() + slots.size());
+    for(vector<Slot>::const_iterator p = slots.begin(); p != slots.end(); ++p)
+    {
+        requests.push_back(p->outAsync);
+    }
+
+    vector<Slot>(minSize).swap(_slots);
+    _mask = minSize - 1;
+    _size = 0;
+}
+
+size_t
+IceInternal::RequestTable::find(Int requestId) const
+{
+    if(requestId <= 0)
+    {
+        return _slots.size();
+    }
+
+    size_t i = static_cast<size_t>(requestId) & _mask;
+    while(_slots[i].requestId != 0)
+    {
+        if(_slots[i].requestId == requestId)
+        {
+            return i;
+        }
+        i = (i + 1) & _mask;
+    }
+    return _slots.size();
+}
+
+void
+IceInternal::RequestTable::erase(size_t i)
+{
+    //
+    // Move back the following entries of the probe sequence which can't be found
+    // anymore once the slot is empty, this avoids the need for tombstones.
+    //
+    size_t j = i;
+    while(true)
+    {
+        j = (j + 1) & _mask;
+        if(_slots[j].requestId == 0)
+        {
+            break;
+        }
+
+        //
+        // The entry can stay if its home slot is cyclically in (i, j].
+        //
+        size_t k = static_cast<size_t>(_slots[j].requestId) & _mask;
+        if(i <= j ? (i < k && k <= j) : (i < k || k <= j))
+        {
+            continue;
+        }
+
+        _slots[i].requestId = _slots[j].requestId;
+        _slots[i].outAsync = _slots[j].outAsync;
+        i = j;
+    }
+    _slots[i].requestId = 0;
+    _slots[i].outAsync = 0;
+    --_size;
+
+    //
+    // Shrink the table once a burst of requests completed.
+    //
+    if(_slots.size() > minSize && _size * 8 < _slots.size())
+    {
+        resize(_slots.size() / 2);
+    }
+}
+
+void
+IceInternal::RequestTable::resize(size_t size)
+{
+    vector<Slot> slots(size);
+    slots.swap(_slots);
+    _mask = size - 1;
+    for(vector<Slot>::const_iterator p = slots.begin(); p != slots.end(); ++p)
+    {
+        if(p->requestId != 0)
+        {
+            size_t i = static_cast<size_t>(p->requestId) & _mask;
+            while(_slots[i].requestId != 0)
+            {
+                i = (i + 1) & _mask;
+            }
+            _slots[i] = *p;
+        }
+    }
+}
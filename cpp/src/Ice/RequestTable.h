@@ -0,0 +1,93 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_REQUEST_TABLE_H
+#define ICE_REQUEST_TABLE_H
+
+#include <IceUtil/Config.h>
+#include <Ice/OutgoingAsyncF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The table of the outstanding requests of a connection, indexed by request ID.
+//
+// Request IDs are allocated sequentially by the connection so the table is a
+// power of 2 array of slots indexed by the low bits of the request ID, with linear
+// probing for the IDs which collide with an older outstanding request. Adding,
+// finding and removing a request are O(1). The table isn't synchronized, it's
+// protected by the connection monitor.
+//
+class RequestTable : private IceUtil::noncopyable
+{
+public:
+
+    RequestTable();
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    //
+    // Add the request with the given ID, the ID must be positive and not already
+    // in the table.
+    //
+    void add(Ice::Int, const OutgoingAsyncBasePtr&);
+
+    //
+    // Remove the request with the given ID and return it, return a null request if
+    // there's no such request.
+    //
+    OutgoingAsyncBasePtr remove(Ice::Int);
+
+    //
+    // Return the request with the given ID without removing it, return a null request
+    // if there's no such request.
+    //
+    OutgoingAsyncBasePtr get(Ice::Int) const;
+
+    //
+    // Check whether the request with the given ID is the given request.
+    //
+    bool contains(Ice::Int, const OutgoingAsyncBasePtr&) const;
+
+    //
+    // Remove all the requests and return them in the given vector, in the order of
+    // their request ID.
+    //
+    void removeAll(std::vector<OutgoingAsyncBasePtr>&);
+
+private:
+
+    struct Slot
+    {
+        Slot() : requestId(0)
+        {
+        }
+
+        Ice::Int requestId; // 0 if the slot is empty.
+        OutgoingAsyncBasePtr outAsync;
+    };
+
+    size_t find(Ice::Int) const;
+    void erase(size_t);
+    void resize(size_t);
+
+    std::vector<Slot> _slots;
+    size_t _mask;
+    size_t _size;
+};
+
+}
+
+#endif
@@ -3,6 +3,10 @@
 //
 
 #include <Ice/ResponseHandler.h>
+#include <Ice/IncomingAsync.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/Instance.h>
+#include <Ice/LoggerUtil.h>
 
 using namespace std;
 using namespace IceInternal;
@@ -10,3 +14,65 @@ using namespace IceInternal;
 #ifndef ICE_CPP11_MAPPING
 IceUtil::Shared* IceInternal::upCast(ResponseHandler* obj) { return obj; }
 #endif
+
+namespace
+{
+
+class ChunkReadyWorkItem : public DispatchWorkItem
+{
+public:
+
+    ChunkReadyWorkItem(const InstancePtr& instance, const ICE_DELEGATE(Ice::ChunkReadyCallback)& ready) :
+        _instance(instance), _ready(ready)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            _ready();
+#else
+            _ready->ready();
+#endif
+        }
+        catch(const std::exception& ex)
+        {
+            Ice::Warning out(_instance->initializationData().logger);
+            out << "exception raised by the chunk ready callback:\n" << ex;
+        }
+        catch(...)
+        {
+            Ice::Warning out(_instance->initializationData().logger);
+            out << "unknown exception raised by the chunk ready callback";
+        }
+    }
+
+private:
+
+    const InstancePtr _instance;
+    const ICE_DELEGATE(Ice::ChunkReadyCallback) _ready;
+};
+
+}
+
+void
+IceInternal::dispatchChunkReady(const InstancePtr& instance, const ThreadPoolPtr& threadPool,
+                                const ICE_DELEGATE(Ice::ChunkReadyCallback)& ready)
+{
+    if(!ready)
+    {
+        return;
+    }
+
+    try
+    {
+        threadPool->dispatch(new ChunkReadyWorkItem(instance, ready));
+    }
+    catch(const Ice::CommunicatorDestroyedException&)
+    {
+        // Ignore, the producer's next chunk fails.
+    }
+}
@@ -11,6 +11,9 @@
 #include <Ice/Config.h>
 #include <Ice/LocalException.h>
 #include <Ice/ResponseHandlerF.h>
+#include <Ice/IncomingAsyncF.h>
+#include <Ice/ThreadPoolF.h>
+#include <Ice/InstanceF.h>
 #include <Ice/VirtualShared.h>
 
 namespace Ice
@@ -36,8 +39,15 @@ public:
     virtual void sendNoResponse() = 0;
     virtual bool systemException(Ice::Int, const Ice::SystemException&, bool) = 0;
     virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool) = 0;
+    virtual bool sendResponseChunk(Ice::Int, Ice::OutputStream*, Ice::Byte,
+                                   const ICE_DELEGATE(Ice::ChunkReadyCallback)&) = 0;
 };
 
+//
+// Call the ready callback of a streamed result from a thread of the given thread pool.
+//
+void dispatchChunkReady(const InstancePtr&, const ThreadPoolPtr&, const ICE_DELEGATE(Ice::ChunkReadyCallback)&);
+
 }
 
 #endif
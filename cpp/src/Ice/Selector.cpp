@@ -14,6 +14,11 @@
 #   include <CoreFoundation/CFStream.h>
 #endif
 
+#if defined(ICE_USE_IO_URING)
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
 using namespace std;
 using namespace IceInternal;
 
@@ -21,6 +26,52 @@ using namespace IceInternal;
 namespace
 {
 struct timespec zeroTimeout = { 0, 0 };
+}
+#elif defined(ICE_USE_IO_URING)
+namespace
+{
+
+//
+// Reserved io_uring user data values, poll requests for event handlers use
+// identifiers starting at uringFirstId.
+//
+const IceUtil::Int64 uringIgnore = 0;
+const IceUtil::Int64 uringInterrupt = 1;
+const IceUtil::Int64 uringFirstId = 16;
+
+//
+// The size of the receive buffers, the data of a message larger than a buffer is read
+// directly from the socket once the buffer is read.
+//
+const size_t uringBufferSize = 8 * 1024;
+
+int
+uringSetup(unsigned int entries, struct io_uring_params* params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int
+uringEnter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, void* arg, size_t argSize)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+unsigned int
+toPollEvents(SocketOperation status)
+{
+    unsigned int events = 0;
+    if(status & SocketOperationRead)
+    {
+        events |= POLLIN;
+    }
+    if(status & SocketOperationWrite)
+    {
+        events |= POLLOUT;
+    }
+    return events;
+}
+
 }
 #endif
 
@@ -242,7 +293,14 @@ Selector::completed(EventHandler* handler, SocketOperation op)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
 
-Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrupted(false)
+Selector::Selector(const InstancePtr& instance) :
+    _instance(instance),
+    _interrupted(false)
+#if defined(ICE_USE_IO_URING)
+    , _uring(false),
+    _uringInterruptArmed(false),
+    _uringNextId(uringFirstId)
+#endif
 {
     SOCKET fds[2];
     createPipe(fds);
@@ -303,6 +361,72 @@ Selector::~Selector()
 void
 Selector::destroy()
 {
+#if defined(ICE_USE_IO_URING)
+    if(_uring)
+    {
+        //
+        // Cancel the pending receive requests and wait for their completion, the kernel must
+        // not use the receive buffers once the selector is destroyed.
+        //
+        for(map<IceUtil::Int64, UringRequest>::const_iterator p = _uringRequests.begin(); p != _uringRequests.end();
+            ++p)
+        {
+            if(p->second.nativeInfo)
+            {
+                struct io_uring_sqe* sqe = getUringSqe();
+                sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                sqe->fd = -1;
+                sqe->addr = static_cast<__u64>(p->first);
+                sqe->user_data = static_cast<__u64>(uringIgnore);
+            }
+        }
+        submitUring();
+        while(true)
+        {
+            map<IceUtil::Int64, UringRequest>::const_iterator p = _uringRequests.begin();
+            while(p != _uringRequests.end() && !p->second.nativeInfo)
+            {
+                ++p;
+            }
+            if(p == _uringRequests.end())
+            {
+                break;
+            }
+
+            if(uringEnter(_queueFd, 0, 1, IORING_ENTER_GETEVENTS, 0, 0) < 0 && !interrupted())
+            {
+                break;
+            }
+
+            unsigned int head = *_uringCqHead;
+            unsigned int tail = __atomic_load_n(_uringCqTail, __ATOMIC_ACQUIRE);
+            for(; head != tail; ++head)
+            {
+                const struct io_uring_cqe& cqe = _uringCqes[head & *_uringCqMask];
+                map<IceUtil::Int64, UringRequest>::iterator q =
+                    _uringRequests.find(static_cast<IceUtil::Int64>(cqe.user_data));
+                if(q != _uringRequests.end() && q->second.nativeInfo)
+                {
+                    q->second.nativeInfo->finishReceive(cqe.res, (cqe.flags & IORING_CQE_F_BUFFER) ?
+                                                        static_cast<int>(cqe.flags >> IORING_CQE_BUFFER_SHIFT) : -1);
+                }
+                if(q != _uringRequests.end())
+                {
+                    _uringRequests.erase(q);
+                }
+            }
+            __atomic_store_n(_uringCqHead, head, __ATOMIC_RELEASE);
+        }
+        _uringRequests.clear();
+
+        munmap(_uringSqes, _uringSqesSize);
+        if(_uringCqRing != _uringSqRing)
+        {
+            munmap(_uringCqRing, _uringCqRingSize);
+        }
+        munmap(_uringSqRing, _uringSqRingSize);
+    }
+#endif
 #if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -336,6 +460,134 @@ Selector::destroy()
     }
 }
 
+#if defined(ICE_USE_IO_URING)
+bool
+Selector::setupUring(unsigned int entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = entries * 8;
+    int fd = uringSetup(entries, &params);
+    if(fd < 0)
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "io_uring is not available:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+        return false;
+    }
+
+    //
+    // IORING_FEAT_NODROP ensures that completions are never lost if the completion queue
+    // overflows and IORING_FEAT_EXT_ARG is required to wait for completions with a timeout.
+    //
+    if(!(params.features & IORING_FEAT_NODROP) || !(params.features & IORING_FEAT_EXT_ARG))
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "io_uring is not supported by this kernel (Linux 5.11 or later is required)";
+        close(fd);
+        return false;
+    }
+
+    _uringSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    _uringCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _uringSqRingSize = max(_uringSqRingSize, _uringCqRingSize);
+        _uringCqRingSize = _uringSqRingSize;
+    }
+    _uringSqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    _uringSqRing = mmap(0, _uringSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                        IORING_OFF_SQ_RING);
+    if(_uringSqRing == MAP_FAILED)
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "cannot map io_uring submission queue:\n" << IceUtilInternal::errorToString(errno);
+        close(fd);
+        return false;
+    }
+
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _uringCqRing = _uringSqRing;
+    }
+    else
+    {
+        _uringCqRing = mmap(0, _uringCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                            IORING_OFF_CQ_RING);
+        if(_uringCqRing == MAP_FAILED)
+        {
+            Ice::Warning out(_instance->initializationData().logger);
+            out << "cannot map io_uring completion queue:\n" << IceUtilInternal::errorToString(errno);
+            munmap(_uringSqRing, _uringSqRingSize);
+            close(fd);
+            return false;
+        }
+    }
+
+    _uringSqes = static_cast<struct io_uring_sqe*>(mmap(0, _uringSqesSize, PROT_READ | PROT_WRITE,
+                                                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+    if(_uringSqes == MAP_FAILED)
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "cannot map io_uring submission queue entries:\n" << IceUtilInternal::errorToString(errno);
+        if(_uringCqRing != _uringSqRing)
+        {
+            munmap(_uringCqRing, _uringCqRingSize);
+        }
+        munmap(_uringSqRing, _uringSqRingSize);
+        close(fd);
+        return false;
+    }
+
+    char* sq = static_cast<char*>(_uringSqRing);
+    _uringSqEntries = params.sq_entries;
+    _uringSqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    _uringSqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    _uringSqPendingTail = *_uringSqTail;
+    _uringSqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    _uringSqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+
+    char* cq = static_cast<char*>(_uringCqRing);
+    _uringCqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    _uringCqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    _uringCqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    _uringCqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    //
+    // The epoll file descriptor isn't needed anymore, no event handlers are registered
+    // with the selector yet.
+    //
+    closeSocket(_queueFd);
+    _queueFd = fd;
+    _uring = true;
+    _events.resize(max(_events.size(), static_cast<size_t>(params.cq_entries)));
+
+    //
+    // Provide the receive buffers to the kernel, they are shared by the receive requests
+    // and only selected once data is received.
+    //
+    _uringBuffers = new ReceiveBuffers(static_cast<int>(min(params.sq_entries, 32768U)), uringBufferSize);
+    struct io_uring_sqe* sqe = getUringSqe();
+    sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = _uringBuffers->count();
+    sqe->addr = reinterpret_cast<__u64>(_uringBuffers->data(0));
+    sqe->len = static_cast<__u32>(_uringBuffers->size());
+    sqe->off = 0;
+    sqe->buf_group = 0;
+    sqe->user_data = static_cast<__u64>(uringIgnore);
+
+    sqe = getUringSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = _fdIntrRead;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = static_cast<__u64>(uringInterrupt);
+    _uringInterruptArmed = true;
+    submitUring();
+    return true;
+}
+#endif
+
 void
 Selector::update(EventHandler* handler, SocketOperation remove, SocketOperation add)
 {
@@ -374,6 +626,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_uring)
+        {
+            updateUring(handler, false);
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -428,6 +687,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_uring)
+        {
+            updateUring(handler, false);
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
         epoll_event event;
@@ -483,6 +749,16 @@ Selector::finish(EventHandler* handler, bool closeNow)
         //
         updateSelector();
     }
+#elif defined(ICE_USE_IO_URING)
+    if(_uring && closeNow)
+    {
+        //
+        // Submit the poll remove request now, the pending poll request holds a reference
+        // on the socket which would otherwise delay the closure of the connection until
+        // the next select.
+        //
+        submitUring();
+    }
 #elif !defined(ICE_USE_EPOLL)
     if(!_changes.empty())
     {
@@ -572,6 +848,12 @@ Selector::startSelect()
     {
         updateSelector();
     }
+#elif defined(ICE_USE_IO_URING)
+    if(_uring)
+    {
+        rearmUring();
+        submitUring();
+    }
 #endif
     _selecting = true;
 
@@ -580,6 +862,9 @@ Selector::startSelect()
     // select to retrieve new ready handlers from the Java selector.
     //
     _selectNow = !_readyHandlers.empty();
+#if defined(ICE_USE_IO_URING)
+    _selectNow = _selectNow || !_uringReady.empty();
+#endif
 }
 
 void
@@ -589,6 +874,13 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
 
     assert(handlers.empty());
 
+#if defined(ICE_USE_IO_URING)
+    if(_uring)
+    {
+        _count = reapUring();
+    }
+#endif
+
 #if defined(ICE_USE_POLL) || defined(ICE_USE_SELECT)
     if(_interrupted) // Interrupted, we have to process the interrupt before returning any handlers
     {
@@ -720,7 +1012,44 @@ Selector::select(int timeout)
     int spuriousWakeup = 0;
     while(true)
     {
-#if defined(ICE_USE_EPOLL)
+#if defined(ICE_USE_IO_URING)
+        if(_uring)
+        {
+            //
+            // Wait for completions, the poll requests were submitted by startSelect or
+            // updateUring with the selector lock held. The completions are reaped by
+            // finishSelect.
+            //
+            int rs;
+            if(timeout == 0)
+            {
+                rs = 0;
+            }
+            else
+            {
+                struct __kernel_timespec ts;
+                struct io_uring_getevents_arg arg;
+                memset(&arg, 0, sizeof(arg));
+                if(timeout > 0)
+                {
+                    ts.tv_sec = timeout / 1000;
+                    ts.tv_nsec = 0;
+                    arg.ts = reinterpret_cast<__u64>(&ts);
+                }
+                rs = uringEnter(_queueFd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+            }
+            if(rs < 0 && errno == ETIME)
+            {
+                rs = 0;
+            }
+            _count = rs < 0 ? rs :
+                static_cast<int>(__atomic_load_n(_uringCqTail, __ATOMIC_ACQUIRE) - *_uringCqHead);
+        }
+        else
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
+#elif defined(ICE_USE_EPOLL)
         _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
 #elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
@@ -933,6 +1262,18 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
                                         ICE_MAYBE_UNUSED SocketOperation add)
 {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+    if(_uring)
+    {
+        //
+        // If remove and add are both empty, the handler file descriptor changed and the
+        // poll request must be re-submitted for the new file descriptor.
+        //
+        updateUring(handler, !remove && !add);
+        checkReady(handler);
+        return;
+    }
+#   endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -1017,6 +1358,358 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
     checkReady(handler);
 }
 
+#if defined(ICE_USE_IO_URING)
+void
+Selector::updateUring(EventHandler* handler, bool force)
+{
+    if(force || !handler->_registered)
+    {
+        //
+        // The handler file descriptor changed or the handler is unregistered, cancel all
+        // its requests.
+        //
+        cancelUring(handler, true);
+    }
+
+    if(handler->_registered)
+    {
+        armUring(handler);
+    }
+    else
+    {
+        _uringRearm.erase(handler);
+        _uringReady.erase(handler);
+        _uringPollRead.erase(handler);
+    }
+
+    if(_selecting)
+    {
+        submitUring();
+    }
+}
+
+void
+Selector::armUring(EventHandler* handler)
+{
+    SocketOperation status = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
+    SocketOperation poll = status;
+
+    //
+    // The data of sockets which support completion-based receives is received with a
+    // receive request instead of polling the socket. A pending receive request is kept
+    // if the handler is disabled for read, its data is read once the handler is enabled
+    // again.
+    //
+    if(_uringReceives.find(handler) != _uringReceives.end())
+    {
+        poll = static_cast<SocketOperation>(poll & ~SocketOperationRead);
+    }
+    else if((status & SocketOperationRead) && _uringPollRead.find(handler) == _uringPollRead.end())
+    {
+        NativeInfoPtr nativeInfo = handler->getNativeInfo();
+        switch(nativeInfo->startReceive(_uringBuffers))
+        {
+        case ReceiveStarted:
+        {
+            IceUtil::Int64 id = _uringNextId++;
+            struct io_uring_sqe* sqe = getUringSqe();
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = nativeInfo->fd();
+            sqe->len = static_cast<__u32>(_uringBuffers->size());
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = 0;
+            sqe->user_data = static_cast<__u64>(id);
+            UringRequest request = { handler, nativeInfo };
+            _uringRequests[id] = request;
+            _uringReceives[handler] = id;
+            poll = static_cast<SocketOperation>(poll & ~SocketOperationRead);
+            break;
+        }
+        case ReceiveReady:
+        {
+            _uringReady.insert(handler);
+            wakeup();
+            poll = static_cast<SocketOperation>(poll & ~SocketOperationRead);
+            break;
+        }
+        case ReceiveUnsupported:
+        {
+            break;
+        }
+        }
+    }
+
+    map<EventHandler*, pair<IceUtil::Int64, SocketOperation> >::iterator p = _uringPolls.find(handler);
+    if(p != _uringPolls.end())
+    {
+        if(p->second.second == poll)
+        {
+            return;
+        }
+        cancelUring(handler, false);
+    }
+
+    if(poll)
+    {
+        IceUtil::Int64 id = _uringNextId++;
+        struct io_uring_sqe* sqe = getUringSqe();
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = handler->getNativeInfo()->fd();
+        sqe->poll32_events = toPollEvents(poll);
+        sqe->user_data = static_cast<__u64>(id);
+        UringRequest request = { handler, 0 };
+        _uringRequests[id] = request;
+        _uringPolls[handler] = make_pair(id, poll);
+    }
+}
+
+void
+Selector::cancelUring(EventHandler* handler, bool receive)
+{
+    //
+    // The completion of a cancelled poll request is ignored since the request is removed.
+    // A cancelled receive request might still complete with data, the request is kept
+    // until it completes to hand over the data (or the selected buffer) to the socket.
+    //
+    map<EventHandler*, pair<IceUtil::Int64, SocketOperation> >::iterator p = _uringPolls.find(handler);
+    if(p != _uringPolls.end())
+    {
+        struct io_uring_sqe* sqe = getUringSqe();
+        sqe->opcode = IORING_OP_POLL_REMOVE;
+        sqe->fd = -1;
+        sqe->addr = static_cast<__u64>(p->second.first);
+        sqe->user_data = static_cast<__u64>(uringIgnore);
+        _uringRequests.erase(p->second.first);
+        _uringPolls.erase(p);
+    }
+
+    map<EventHandler*, IceUtil::Int64>::iterator q = _uringReceives.find(handler);
+    if(receive && q != _uringReceives.end())
+    {
+        struct io_uring_sqe* sqe = getUringSqe();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = static_cast<__u64>(q->second);
+        sqe->user_data = static_cast<__u64>(uringIgnore);
+        _uringRequests[q->second].handler = 0;
+        _uringReceives.erase(q);
+    }
+}
+
+void
+Selector::rearmUring()
+{
+    //
+    // Requests are one-shot: re-submit the requests of the handlers which were returned
+    // by the last select. If the socket is still ready, the poll request completes
+    // immediately which provides the same level-triggered semantics as epoll. Data which
+    // wasn't read yet is reported again without submitting a new receive request.
+    //
+    provideUringBuffers();
+
+    for(set<EventHandler*>::const_iterator p = _uringRearm.begin(); p != _uringRearm.end(); ++p)
+    {
+        armUring(*p);
+    }
+    _uringRearm.clear();
+
+    if(!_uringInterruptArmed)
+    {
+        struct io_uring_sqe* sqe = getUringSqe();
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = _fdIntrRead;
+        sqe->poll32_events = POLLIN;
+        sqe->user_data = static_cast<__u64>(uringInterrupt);
+        _uringInterruptArmed = true;
+    }
+}
+
+int
+Selector::reapUring()
+{
+    //
+    // Convert the completions to epoll events for finishSelect. A handler might have a
+    // poll and a receive request completed, its events are merged in a single entry.
+    //
+    map<EventHandler*, size_t> indexes;
+    int count = 0;
+    while(!_uringReady.empty() && count < static_cast<int>(_events.size()))
+    {
+        EventHandler* handler = *_uringReady.begin();
+        struct epoll_event& ev = _events[static_cast<size_t>(count)];
+        ev.data.ptr = handler;
+        ev.events = EPOLLIN;
+        indexes[handler] = static_cast<size_t>(count++);
+        _uringRearm.insert(handler);
+        _uringReady.erase(_uringReady.begin());
+    }
+
+    unsigned int head = *_uringCqHead;
+    unsigned int tail = __atomic_load_n(_uringCqTail, __ATOMIC_ACQUIRE);
+    while(head != tail && count < static_cast<int>(_events.size()))
+    {
+        const struct io_uring_cqe& cqe = _uringCqes[head & *_uringCqMask];
+        ++head;
+
+        IceUtil::Int64 id = static_cast<IceUtil::Int64>(cqe.user_data);
+        if(id == uringInterrupt)
+        {
+            _uringInterruptArmed = false;
+            continue;
+        }
+
+        int buffer = (cqe.flags & IORING_CQE_F_BUFFER) ? static_cast<int>(cqe.flags >> IORING_CQE_BUFFER_SHIFT) : -1;
+        map<IceUtil::Int64, UringRequest>::iterator p = _uringRequests.find(id);
+        if(p == _uringRequests.end())
+        {
+            continue; // Completion of a cancelled poll request or of a remove or cancel request.
+        }
+
+        UringRequest request = p->second;
+        _uringRequests.erase(p);
+
+        unsigned int events = 0;
+        if(request.nativeInfo)
+        {
+            //
+            // Hand over the data to the socket even if the handler is finished or disabled,
+            // the socket releases the buffer if it's closed.
+            //
+            request.nativeInfo->finishReceive(cqe.res, buffer);
+            if(!request.handler)
+            {
+                continue;
+            }
+
+            _uringReceives.erase(request.handler);
+            if(cqe.res == -ENOBUFS)
+            {
+                _uringPollRead.insert(request.handler); // Poll the socket until buffers are released.
+            }
+            else if(cqe.res != -ECANCELED)
+            {
+                events = EPOLLIN;
+            }
+        }
+        else
+        {
+            _uringPolls.erase(request.handler);
+            if(cqe.res < 0)
+            {
+                Ice::Error out(_instance->initializationData().logger);
+                out << "error while polling with io_uring:\n" << IceUtilInternal::errorToString(-cqe.res);
+            }
+            else
+            {
+                if(cqe.res & (POLLIN | POLLERR | POLLHUP))
+                {
+                    events |= EPOLLIN;
+                    _uringPollRead.erase(request.handler);
+                }
+                if(cqe.res & (POLLOUT | POLLERR | POLLHUP))
+                {
+                    events |= EPOLLOUT;
+                }
+            }
+        }
+        _uringRearm.insert(request.handler);
+
+        if(events)
+        {
+            map<EventHandler*, size_t>::const_iterator q = indexes.find(request.handler);
+            if(q != indexes.end())
+            {
+                _events[q->second].events |= events;
+            }
+            else
+            {
+                struct epoll_event& ev = _events[static_cast<size_t>(count)];
+                ev.data.ptr = request.handler;
+                ev.events = events;
+                indexes[request.handler] = static_cast<size_t>(count++);
+            }
+        }
+    }
+    __atomic_store_n(_uringCqHead, head, __ATOMIC_RELEASE);
+    return count;
+}
+
+void
+Selector::provideUringBuffers()
+{
+    vector<int> released;
+    _uringBuffers->takeReleased(released);
+    for(vector<int>::const_iterator p = released.begin(); p != released.end(); ++p)
+    {
+        struct io_uring_sqe* sqe = getUringSqe();
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = 1;
+        sqe->addr = reinterpret_cast<__u64>(_uringBuffers->data(*p));
+        sqe->len = static_cast<__u32>(_uringBuffers->size());
+        sqe->off = static_cast<__u64>(*p);
+        sqe->buf_group = 0;
+        sqe->user_data = static_cast<__u64>(uringIgnore);
+    }
+    if(!released.empty())
+    {
+        _uringPollRead.clear(); // Try again to receive the data of the polled sockets.
+    }
+}
+
+struct io_uring_sqe*
+Selector::getUringSqe()
+{
+    //
+    // The request isn't visible to the kernel until submitUring publishes the new tail,
+    // the caller fills the request before.
+    //
+    if(_uringSqPendingTail - __atomic_load_n(_uringSqHead, __ATOMIC_ACQUIRE) == _uringSqEntries)
+    {
+        submitUring(); // The submission queue is full, submit the pending requests now.
+    }
+    unsigned int index = _uringSqPendingTail & *_uringSqMask;
+    struct io_uring_sqe* sqe = &_uringSqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    _uringSqArray[index] = index;
+    ++_uringSqPendingTail;
+    return sqe;
+}
+
+void
+Selector::submitUring()
+{
+    //
+    // Publish the filled requests and submit all the requests which haven't been consumed
+    // by the kernel yet. This is always called with the selector lock held, the selecting
+    // thread doesn't submit requests.
+    //
+    __atomic_store_n(_uringSqTail, _uringSqPendingTail, __ATOMIC_RELEASE);
+    while(true)
+    {
+        unsigned int toSubmit = _uringSqPendingTail - __atomic_load_n(_uringSqHead, __ATOMIC_ACQUIRE);
+        if(toSubmit == 0)
+        {
+            break;
+        }
+        int rs = uringEnter(_queueFd, toSubmit, 0, 0, 0, 0);
+        if(rs < 0)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            Ice::Error out(_instance->initializationData().logger);
+            out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+            break;
+        }
+        else if(rs == 0)
+        {
+            break;
+        }
+    }
+}
+#endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
@@ -16,6 +16,9 @@
 
 #if defined(ICE_USE_EPOLL)
 #   include <sys/epoll.h>
+#   if defined(ICE_USE_IO_URING)
+#      include <set>
+#   endif
 #elif defined(ICE_USE_KQUEUE)
 #   include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -115,6 +118,10 @@ public:
 
     void destroy();
 
+#if defined(ICE_USE_IO_URING)
+    bool setupUring(unsigned int);
+#endif
+
     void initialize(EventHandler*)
     {
         // Nothing to do
@@ -137,6 +144,17 @@ private:
     void updateSelector();
     void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
 
+#if defined(ICE_USE_IO_URING)
+    void updateUring(EventHandler*, bool);
+    void armUring(EventHandler*);
+    void cancelUring(EventHandler*, bool);
+    void rearmUring();
+    int reapUring();
+    void provideUringBuffers();
+    struct io_uring_sqe* getUringSqe();
+    void submitUring();
+#endif
+
     const InstancePtr _instance;
 
     SOCKET _fdIntrRead;
@@ -150,6 +168,47 @@ private:
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
     int _queueFd;
+#   if defined(ICE_USE_IO_URING)
+    //
+    // When the io_uring backend is enabled, _queueFd is the ring file descriptor. The data
+    // of stream sockets is received with completion-based receive requests into buffers
+    // provided to the kernel, the other sockets and write operations use one-shot poll
+    // requests. Requests are queued and submitted with the selector lock held, the select
+    // call only waits for completions.
+    //
+    struct UringRequest
+    {
+        EventHandler* handler; // Cleared once the handler is finished.
+        NativeInfoPtr nativeInfo; // Set for receive requests.
+    };
+
+    bool _uring;
+    unsigned int _uringSqEntries;
+    unsigned int* _uringSqHead;
+    unsigned int* _uringSqTail;
+    unsigned int _uringSqPendingTail; // Tail of the filled requests, published by submitUring.
+    unsigned int* _uringSqMask;
+    unsigned int* _uringSqArray;
+    struct io_uring_sqe* _uringSqes;
+    unsigned int* _uringCqHead;
+    unsigned int* _uringCqTail;
+    unsigned int* _uringCqMask;
+    struct io_uring_cqe* _uringCqes;
+    void* _uringSqRing;
+    size_t _uringSqRingSize;
+    void* _uringCqRing;
+    size_t _uringCqRingSize;
+    size_t _uringSqesSize;
+    bool _uringInterruptArmed;
+    IceUtil::Int64 _uringNextId;
+    ReceiveBuffersPtr _uringBuffers;
+    std::map<IceUtil::Int64, UringRequest> _uringRequests;
+    std::map<EventHandler*, std::pair<IceUtil::Int64, SocketOperation> > _uringPolls;
+    std::map<EventHandler*, IceUtil::Int64> _uringReceives;
+    std::set<EventHandler*> _uringRearm;
+    std::set<EventHandler*> _uringReady; // Handlers with received data waiting to be read.
+    std::set<EventHandler*> _uringPollRead; // Handlers polled for read, no receive buffer was available.
+#   endif
 #elif defined(ICE_USE_KQUEUE)
     std::vector<struct kevent> _events;
     std::vector<struct kevent> _changes;
@@ -8,6 +8,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
 #include <Ice/StringUtil.h>
+#include <IceUtil/Thread.h>
 
 using namespace std;
 using namespace Ice;
@@ -15,42 +16,191 @@ using namespace IceInternal;
 
 ICE_API IceUtil::Shared* IceInternal::upCast(ServantManager* p) { return p; }
 
+namespace
+{
+
+const size_t initialServantTableSize = 32;
+
+size_t
+hashIdentity(const Identity& ident)
+{
+    //
+    // FNV-1a hash of the identity name and category.
+    //
+    size_t h = 2166136261U;
+    for(string::const_iterator p = ident.name.begin(); p != ident.name.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    h = (h ^ '/') * 16777619U;
+    for(string::const_iterator p = ident.category.begin(); p != ident.category.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+//
+// The reader slot is picked from the address of the read lock on the stack of the
+// calling thread, so that concurrent lookups from different threads usually use
+// different slots. Sharing a slot is correct, it's only slower.
+//
+size_t
+readerSlot(const void* p, size_t slots)
+{
+    size_t h = reinterpret_cast<size_t>(p) >> 12;
+    h ^= h >> 7;
+    h ^= h >> 11;
+    return h % slots;
+}
+
+string
+servantToString(const Identity& ident, const string& facet, ToStringMode toStringMode)
+{
+    ostringstream os;
+    os << Ice::identityToString(ident, toStringMode);
+    if(!facet.empty())
+    {
+        os << " -f " + escapeString(facet, "", toStringMode);
+    }
+    return os.str();
+}
+
+}
+
+IceInternal::ServantManager::ServantTable::ServantTable(size_t sz) :
+    size(sz),
+    buckets(new AtomicPtr<ServantEntry>[sz])
+{
+}
+
+IceInternal::ServantManager::ServantTable::~ServantTable()
+{
+    delete[] buckets;
+}
+
 void
-IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity& ident, const string& facet)
+IceInternal::ServantManager::ServantTable::deleteEntries()
 {
-    IceUtil::Mutex::Lock sync(*this);
+    for(size_t i = 0; i < size; ++i)
+    {
+        ServantEntry* e = buckets[i].load();
+        while(e)
+        {
+            ServantEntry* next = e->next.load();
+            delete e;
+            e = next;
+        }
+        buckets[i].store(0);
+    }
+}
 
-    assert(_instance); // Must not be called after destruction.
+AtomicPtr<IceInternal::ServantManager::ServantEntry>&
+IceInternal::ServantManager::ServantTable::bucket(const Identity& ident)
+{
+    return buckets[hashIdentity(ident) & (size - 1)];
+}
+
+IceInternal::ServantManager::ReadLock::ReadLock(const ServantManager& manager) :
+    _slot(manager._readers[readerSlot(this, sizeof(manager._readers) / sizeof(manager._readers[0]))])
+{
+    //
+    // If the epoch changes after the slot count is incremented, the writer might have
+    // already checked the count and the lookup must be retried with the new epoch.
+    //
+    while(true)
+    {
+        _epoch = manager._epoch.load();
+        _slot.count[_epoch].fetch_add(1);
+        if(manager._epoch.load() == _epoch)
+        {
+            break;
+        }
+        _slot.count[_epoch].fetch_sub(1);
+    }
+}
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+IceInternal::ServantManager::ReadLock::~ReadLock()
+{
+    _slot.count[_epoch].fetch_sub(1);
+}
 
-    if(p == _servantMapMap.end() || p->first != ident)
+void
+IceInternal::ServantManager::synchronize()
+{
+    //
+    // Must be called with the servant manager locked, after removing entries or
+    // replacing maps and before deleting them. The lookups which start after the
+    // epoch change use the new epoch and can't see the removed entries, we wait for
+    // the lookups of the previous epoch to complete.
+    //
+    int epoch = _epoch.load();
+    _epoch.exchange(1 - epoch);
+    for(size_t i = 0; i < sizeof(_readers) / sizeof(_readers[0]); ++i)
     {
-        p = _servantMapMap.find(ident);
+        while(_readers[i].count[epoch].load() != 0)
+        {
+            IceUtil::ThreadControl::yield();
+        }
     }
+}
 
-    if(p == _servantMapMap.end())
+void
+IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity& ident, const string& facet)
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    assert(_instance); // Must not be called after destruction.
+
+    ServantTable* table = _servants.load();
+    for(ServantEntry* e = table->bucket(ident).load(); e; e = e->next.load())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        if(e->id == ident && e->facet == facet)
+        {
+            throw AlreadyRegisteredException(__FILE__, __LINE__, "servant",
+                                             servantToString(ident, facet, _instance->toStringMode()));
+        }
     }
-    else
+
+    if(_servantCount >= table->size)
     {
-        if(p->second.find(facet) != p->second.end())
+        //
+        // Grow the table. The entries are copied to the new table since lookups might
+        // still be reading the buckets of the current table.
+        //
+        ServantTable* newTable = new ServantTable(table->size * 2);
+        try
         {
-            ToStringMode toStringMode = _instance->toStringMode();
-            ostringstream os;
-            os << Ice::identityToString(ident, toStringMode);
-            if(!facet.empty())
+            for(size_t i = 0; i < table->size; ++i)
             {
-                os << " -f " << escapeString(facet, "", toStringMode);
+                for(ServantEntry* e = table->buckets[i].load(); e; e = e->next.load())
+                {
+                    AtomicPtr<ServantEntry>& bucket = newTable->bucket(e->id);
+                    ServantEntry* entry = new ServantEntry(e->id, e->facet, e->servant);
+                    entry->next.store(bucket.load());
+                    bucket.store(entry);
+                }
             }
-            throw AlreadyRegisteredException(__FILE__, __LINE__, "servant", os.str());
         }
-    }
+        catch(...)
+        {
+            newTable->deleteEntries();
+            delete newTable;
+            throw;
+        }
 
-    _servantMapMapHint = p;
+        _servants.store(newTable);
+        synchronize();
+        table->deleteEntries();
+        delete table;
+        table = newTable;
+    }
 
-    p->second.insert(pair<const string, ObjectPtr>(facet, object));
+    AtomicPtr<ServantEntry>& bucket = table->bucket(ident);
+    ServantEntry* entry = new ServantEntry(ident, facet, object);
+    entry->next.store(bucket.load());
+    bucket.store(entry);
+    ++_servantCount;
 }
 
 void
@@ -60,13 +210,18 @@ IceInternal::ServantManager::addDefaultServant(const ObjectPtr& object, const st
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p != _defaultServantMap.end())
+    DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    if(defaultServantMap->find(category) != defaultServantMap->end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "default servant", category);
     }
 
-    _defaultServantMap.insert(pair<const string, ObjectPtr>(category, object));
+    DefaultServantMap* newDefaultServantMap = new DefaultServantMap(*defaultServantMap);
+    newDefaultServantMap->insert(pair<const string, ObjectPtr>(category, object));
+
+    _defaultServantMap.store(newDefaultServantMap);
+    synchronize();
+    delete defaultServantMap;
 }
 
 ObjectPtr
@@ -83,41 +238,26 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    if(p == _servantMapMap.end() || p->first != ident)
+    AtomicPtr<ServantEntry>* prev = &_servants.load()->bucket(ident);
+    ServantEntry* e = prev->load();
+    while(e && (e->id != ident || e->facet != facet))
     {
-        p = _servantMapMap.find(ident);
+        prev = &e->next;
+        e = prev->load();
     }
 
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(!e)
     {
-        ToStringMode toStringMode = _instance->toStringMode();
-        ostringstream os;
-        os << Ice::identityToString(ident, toStringMode);
-        if(!facet.empty())
-        {
-            os << " -f " + escapeString(facet, "", toStringMode);
-        }
-        throw NotRegisteredException(__FILE__, __LINE__, "servant", os.str());
+        throw NotRegisteredException(__FILE__, __LINE__, "servant",
+                                     servantToString(ident, facet, _instance->toStringMode()));
     }
 
-    servant = q->second;
-    p->second.erase(q);
+    prev->store(e->next.load());
+    --_servantCount;
+    synchronize();
 
-    if(p->second.empty())
-    {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
-    }
+    servant = e->servant;
+    delete e;
     return servant;
 }
 
@@ -135,14 +275,21 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    DefaultServantMap::const_iterator p = defaultServantMap->find(category);
+    if(p == defaultServantMap->end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "default servant", category);
     }
 
     servant = p->second;
-    _defaultServantMap.erase(p);
+
+    DefaultServantMap* newDefaultServantMap = new DefaultServantMap(*defaultServantMap);
+    newDefaultServantMap->erase(category);
+
+    _defaultServantMap.store(newDefaultServantMap);
+    synchronize();
+    delete defaultServantMap;
 
     return servant;
 }
@@ -154,39 +301,42 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
+    vector<ServantEntry*> removed;
+    AtomicPtr<ServantEntry>* prev = &_servants.load()->bucket(ident);
+    for(ServantEntry* e = prev->load(); e; e = prev->load())
     {
-        p = _servantMapMap.find(ident);
+        if(e->id == ident)
+        {
+            prev->store(e->next.load());
+            removed.push_back(e);
+        }
+        else
+        {
+            prev = &e->next;
+        }
     }
 
-    if(p == _servantMapMap.end())
+    if(removed.empty())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant",
                                      Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
+    _servantCount -= removed.size();
+    synchronize();
 
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
+    FacetMap result;
+    for(vector<ServantEntry*>::const_iterator p = removed.begin(); p != removed.end(); ++p)
     {
-        _servantMapMap.erase(p);
+        result.insert(pair<const string, ObjectPtr>((*p)->facet, (*p)->servant));
+        delete *p;
     }
-
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -195,30 +345,24 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    ReadLock readLock(*this);
 
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
+    for(ServantEntry* e = _servants.load()->bucket(ident).load(); e; e = e->next.load())
     {
-        p = servantMapMap.find(ident);
+        if(e->id == ident && e->facet == facet)
+        {
+            return e->servant;
+        }
     }
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    DefaultServantMap::const_iterator d = defaultServantMap->find(ident.category);
+    if(d == defaultServantMap->end())
     {
-        DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
-        if(d == _defaultServantMap.end())
+        d = defaultServantMap->find("");
+        if(d == defaultServantMap->end())
         {
-            d = _defaultServantMap.find("");
-            if(d == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return d->second;
-            }
+            return 0;
         }
         else
         {
@@ -227,18 +371,18 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return d->second;
     }
 }
 
 ObjectPtr
 IceInternal::ServantManager::findDefaultServant(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ReadLock readLock(*this);
 
-    DefaultServantMap::const_iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    DefaultServantMap::const_iterator p = defaultServantMap->find(category);
+    if(p == defaultServantMap->end())
     {
         return 0;
     }
@@ -251,35 +395,22 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    ReadLock readLock(*this);
 
-    if(p == servantMapMap.end())
+    FacetMap result;
+    for(ServantEntry* e = _servants.load()->bucket(ident).load(); e; e = e->next.load())
     {
-        return FacetMap();
-    }
-    else
-    {
-        _servantMapMapHint = p;
-        return p->second;
+        if(e->id == ident)
+        {
+            result.insert(pair<const string, ObjectPtr>(e->facet, e->servant));
+        }
     }
+    return result;
 }
 
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -288,24 +419,16 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ReadLock readLock(*this);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
-    {
-        return false;
-    }
-    else
+    for(ServantEntry* e = _servants.load()->bucket(ident).load(); e; e = e->next.load())
     {
-        _servantMapMapHint = p;
-        assert(!p->second.empty());
-        return true;
+        if(e->id == ident)
+        {
+            return true;
+        }
     }
+    return false;
 }
 
 void
@@ -315,13 +438,18 @@ IceInternal::ServantManager::addServantLocator(const ServantLocatorPtr& locator,
 
     assert(_instance); // Must not be called after destruction.
 
-    if((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category)
-       || _locatorMap.find(category) != _locatorMap.end())
+    LocatorMap* locatorMap = _locatorMap.load();
+    if(locatorMap->find(category) != locatorMap->end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
-    _locatorMapHint = _locatorMap.insert(_locatorMapHint, pair<const string, ServantLocatorPtr>(category, locator));
+    LocatorMap* newLocatorMap = new LocatorMap(*locatorMap);
+    newLocatorMap->insert(pair<const string, ServantLocatorPtr>(category, locator));
+
+    _locatorMap.store(newLocatorMap);
+    synchronize();
+    delete locatorMap;
 }
 
 ServantLocatorPtr
@@ -331,36 +459,28 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>::iterator p = _locatorMap.end();
-    if(_locatorMapHint != p)
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
-    if(p == _locatorMap.end())
+    LocatorMap* locatorMap = _locatorMap.load();
+    LocatorMap::const_iterator p = locatorMap->find(category);
+    if(p == locatorMap->end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
     ServantLocatorPtr locator = p->second;
-    _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
+
+    LocatorMap* newLocatorMap = new LocatorMap(*locatorMap);
+    newLocatorMap->erase(category);
+
+    _locatorMap.store(newLocatorMap);
+    synchronize();
+    delete locatorMap;
+
     return locator;
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::findServantLocator(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -369,26 +489,12 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
     //
     //assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>& locatorMap =
-        const_cast<map<string, ServantLocatorPtr>&>(_locatorMap);
-
-    map<string, ServantLocatorPtr>::iterator p = locatorMap.end();
-    if(_locatorMapHint != locatorMap.end())
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == locatorMap.end())
-    {
-        p = locatorMap.find(category);
-    }
+    ReadLock readLock(*this);
 
-    if(p != locatorMap.end())
+    const LocatorMap* locatorMap = _locatorMap.load();
+    LocatorMap::const_iterator p = locatorMap->find(category);
+    if(p != locatorMap->end())
     {
-        _locatorMapHint = p;
         return p->second;
     }
     else
@@ -400,9 +506,17 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _servants(new ServantTable(initialServantTableSize)),
+      _servantCount(0),
+      _defaultServantMap(new DefaultServantMap()),
+      _locatorMap(new LocatorMap()),
+      _epoch(0)
 {
+    for(size_t i = 0; i < sizeof(_readers) / sizeof(_readers[0]); ++i)
+    {
+        _readers[i].count[0].exchange(0);
+        _readers[i].count[1].exchange(0);
+    }
 }
 
 IceInternal::ServantManager::~ServantManager()
@@ -413,14 +527,20 @@ IceInternal::ServantManager::~ServantManager()
     // properly deactivated.
     //
     //assert(!_instance);
+
+    ServantTable* servants = _servants.load();
+    servants->deleteEntries();
+    delete servants;
+    delete _defaultServantMap.load();
+    delete _locatorMap.load();
 }
 
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
-    DefaultServantMap defaultServantMap;
-    map<string, ServantLocatorPtr> locatorMap;
+    ServantTable* servants;
+    DefaultServantMap* defaultServantMap;
+    LocatorMap* locatorMap;
     Ice::LoggerPtr logger;
 
     {
@@ -435,18 +555,25 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        //
+        // Lookups can still occur after destruction, they use empty maps.
+        //
+        servants = _servants.load();
+        _servants.store(new ServantTable(initialServantTableSize));
+        _servantCount = 0;
+
+        defaultServantMap = _defaultServantMap.load();
+        _defaultServantMap.store(new DefaultServantMap());
 
-        defaultServantMap.swap(_defaultServantMap);
+        locatorMap = _locatorMap.load();
+        _locatorMap.store(new LocatorMap());
 
-        locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
+        synchronize();
 
         _instance = 0;
     }
 
-    for(map<string, ServantLocatorPtr>::const_iterator p = locatorMap.begin(); p != locatorMap.end(); ++p)
+    for(LocatorMap::const_iterator p = locatorMap->begin(); p != locatorMap->end(); ++p)
     {
         try
         {
@@ -474,7 +601,8 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
-    locatorMap.clear();
-    defaultServantMap.clear();
+    servants->deleteEntries();
+    delete servants;
+    delete locatorMap;
+    delete defaultServantMap;
 }
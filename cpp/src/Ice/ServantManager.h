@@ -7,6 +7,8 @@
 
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Atomic.h>
+#include <Ice/AtomicPtr.h>
 #include <Ice/ServantManagerF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ServantLocatorF.h>
@@ -52,16 +54,78 @@ private:
 
     const std::string _adapterName;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
+    //
+    // The servants, default servants and servant locators are looked up for each
+    // dispatch without locking the servant manager. Updates are serialized by the
+    // servant manager mutex and the memory of the removed entries is reclaimed once
+    // the lookups which might still be reading it are done (see synchronize()).
+    //
+    // The servants are kept in a hash table with an entry for each identity and
+    // facet, the entries of an identity are all in the same bucket. The default
+    // servants and servant locators are rarely updated, each update replaces the
+    // map with a new copy.
+    //
+    struct ServantEntry
+    {
+        ServantEntry(const Ice::Identity& i, const std::string& f, const Ice::ObjectPtr& s) :
+            id(i), facet(f), servant(s)
+        {
+        }
+
+        const Ice::Identity id;
+        const std::string facet;
+        const Ice::ObjectPtr servant;
+        AtomicPtr<ServantEntry> next;
+    };
+
+    struct ServantTable
+    {
+        ServantTable(size_t);
+        ~ServantTable();
+
+        void deleteEntries();
+        AtomicPtr<ServantEntry>& bucket(const Ice::Identity&);
+
+        const size_t size; // A power of 2.
+        AtomicPtr<ServantEntry>* const buckets;
+    };
+
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
+    typedef std::map<std::string, Ice::ServantLocatorPtr> LocatorMap;
+
+    AtomicPtr<ServantTable> _servants;
+    size_t _servantCount;
+    AtomicPtr<DefaultServantMap> _defaultServantMap;
+    AtomicPtr<LocatorMap> _locatorMap;
+
+    //
+    // Each lookup increments the count of a reader slot for the current epoch while it
+    // reads the maps. The slots are padded to avoid false sharing between threads.
+    //
+    struct ReaderSlot
+    {
+        IceUtilInternal::Atomic count[2];
+        char pad[64];
+    };
+
+    class ReadLock
+    {
+    public:
+
+        ReadLock(const ServantManager&);
+        ~ReadLock();
+
+    private:
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+        ReaderSlot& _slot;
+        int _epoch;
+    };
+    friend class ReadLock;
 
-    DefaultServantMap _defaultServantMap;
+    void synchronize();
 
-    std::map<std::string, Ice::ServantLocatorPtr> _locatorMap;
-    mutable std::map<std::string, Ice::ServantLocatorPtr>::iterator _locatorMapHint;
+    IceUtilInternal::Atomic _epoch;
+    mutable ReaderSlot _readers[32];
 };
 
 }
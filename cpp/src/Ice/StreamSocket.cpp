@@ -6,6 +6,15 @@
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
 
+#if !defined(_WIN32)
+#   include <sys/uio.h>
+#   include <limits.h>
+#endif
+
+#if defined(ICE_USE_ZEROCOPY)
+#   include <linux/errqueue.h>
+#endif
+
 using namespace IceInternal;
 
 #if defined(ICE_OS_UWP)
@@ -24,7 +33,17 @@ StreamSocket::StreamSocket(const ProtocolInstancePtr& instance,
     _proxy(proxy),
     _addr(addr),
     _sourceAddr(sourceAddr),
-    _state(StateNeedConnect)
+    _state(StateNeedConnect),
+    _zeroCopySize(0),
+    _zeroCopySent(0),
+    _zeroCopyCompleted(0)
+#if defined(ICE_USE_IO_URING)
+    , _receivePending(false),
+    _receiveBuffer(-1),
+    _receiveOffset(0),
+    _receiveLength(0),
+    _receiveError(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), _write(SocketOperationWrite)
 #endif
@@ -52,7 +71,17 @@ StreamSocket::StreamSocket(const ProtocolInstancePtr& instance, SOCKET fd) :
     _instance(instance),
     _addr(),
     _sourceAddr(),
-    _state(StateConnected)
+    _state(StateConnected),
+    _zeroCopySize(0),
+    _zeroCopySent(0),
+    _zeroCopyCompleted(0)
+#if defined(ICE_USE_IO_URING)
+    , _receivePending(false),
+    _receiveBuffer(-1),
+    _receiveOffset(0),
+    _receiveLength(0),
+    _receiveError(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead), _write(SocketOperationWrite)
 #endif
@@ -222,6 +251,181 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+SocketOperation
+StreamSocket::writev(Buffer& buf, const std::vector<Buffer*>& buffers)
+{
+#if defined(_WIN32)
+    return write(buf);
+#else
+    if(_state == StateProxyWrite || buffers.empty())
+    {
+        return write(buf);
+    }
+
+    assert(_fd != INVALID_SOCKET);
+
+    //
+    // Gather the remaining data of the buffers and write it with a single system call. The
+    // number of buffers written at once is limited by IOV_MAX.
+    //
+#   ifdef IOV_MAX
+    const size_t maxCount = IOV_MAX < 64 ? IOV_MAX : 64;
+#   else
+    const size_t maxCount = 16;
+#   endif
+    struct iovec iov[64];
+    Buffer* bufs[64];
+    size_t count = 0;
+    if(buf.i != buf.b.end())
+    {
+        iov[count].iov_base = &*buf.i;
+        iov[count].iov_len = static_cast<size_t>(buf.b.end() - buf.i);
+        bufs[count++] = &buf;
+    }
+    for(std::vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end() && count < maxCount; ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            iov[count].iov_base = &*(*p)->i;
+            iov[count].iov_len = static_cast<size_t>((*p)->b.end() - (*p)->i);
+            bufs[count++] = *p;
+        }
+    }
+
+    size_t first = 0;
+    while(first < count)
+    {
+        ssize_t ret = ::writev(_fd, &iov[first], static_cast<int>(count - first));
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        //
+        // Advance the buffers by the number of bytes written.
+        //
+        size_t sent = static_cast<size_t>(ret);
+        while(sent > 0)
+        {
+            size_t n = sent < iov[first].iov_len ? sent : iov[first].iov_len;
+            bufs[first]->i += n;
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + n;
+            iov[first].iov_len -= n;
+            sent -= n;
+            if(iov[first].iov_len == 0)
+            {
+                ++first;
+            }
+        }
+    }
+    return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
+#endif
+}
+
+bool
+StreamSocket::enableZeroCopy(size_t size)
+{
+#if defined(ICE_USE_ZEROCOPY)
+    assert(_fd != INVALID_SOCKET);
+    int flag = 1;
+    if(size == 0 || setsockopt(_fd, SOL_SOCKET, SO_ZEROCOPY, &flag, int(sizeof(int))) == SOCKET_ERROR)
+    {
+        return false; // Not supported by the kernel.
+    }
+    _zeroCopySize = size;
+    return true;
+#else
+    return false;
+#endif
+}
+
+Ice::Long
+StreamSocket::zeroCopySent() const
+{
+    return _zeroCopySent;
+}
+
+Ice::Long
+StreamSocket::zeroCopyCompleted()
+{
+#if defined(ICE_USE_ZEROCOPY)
+    //
+    // Read the completion notifications from the socket error queue. Each notification
+    // provides the range of completed sends, the kernel numbers the sends with a 32-bit
+    // counter which wraps around.
+    //
+    while(_zeroCopyCompleted < _zeroCopySent)
+    {
+        char control[128];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if(::recvmsg(_fd, &msg, MSG_ERRQUEUE) == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            break; // No more notifications, socket errors are reported by read or write.
+        }
+
+        for(struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+        {
+            if((cm->cmsg_level != SOL_IP || cm->cmsg_type != IP_RECVERR) &&
+               (cm->cmsg_level != SOL_IPV6 || cm->cmsg_type != IPV6_RECVERR))
+            {
+                continue;
+            }
+
+            const struct sock_extended_err* err = reinterpret_cast<const struct sock_extended_err*>(CMSG_DATA(cm));
+            if(err->ee_errno != 0 || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            unsigned int pending = static_cast<unsigned int>(_zeroCopySent) - (err->ee_data + 1);
+            Ice::Long completed = _zeroCopySent - static_cast<Ice::Long>(pending);
+            if(completed > _zeroCopyCompleted)
+            {
+                _zeroCopyCompleted = completed;
+            }
+
+            if(err->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+            {
+                //
+                // The kernel copied the data (with the loopback interface for example), zero-copy
+                // sends are slower than regular sends in this case so we stop using them.
+                //
+                _zeroCopySize = 0;
+            }
+        }
+    }
+#endif
+    return _zeroCopyCompleted;
+}
+
 #if !defined(ICE_OS_UWP)
 ssize_t
 StreamSocket::read(char* buf, size_t length)
@@ -231,6 +435,54 @@ StreamSocket::read(char* buf, size_t length)
     size_t packetSize = length;
     ssize_t read = 0;
 
+#if defined(ICE_USE_IO_URING)
+    IceUtil::Mutex::Lock sync(_receiveMutex);
+    if(_receiveBuffer >= 0)
+    {
+        size_t n = std::min(length, _receiveLength - _receiveOffset);
+        memcpy(buf, _receiveBuffers->data(_receiveBuffer) + _receiveOffset, n);
+        _receiveOffset += n;
+        if(_receiveOffset == _receiveLength)
+        {
+            _receiveBuffers->release(_receiveBuffer);
+            _receiveBuffer = -1;
+        }
+        buf += n;
+        read += static_cast<ssize_t>(n);
+        length -= n;
+        packetSize = length;
+        if(length == 0 || _receiveBuffer >= 0)
+        {
+            return read;
+        }
+    }
+
+    if(_receiveError)
+    {
+        int error = _receiveError;
+        _receiveError = 0;
+        if(read > 0)
+        {
+            _receiveError = error; // Raise the error with the next read.
+            return read;
+        }
+        errno = error;
+        if(connectionLost())
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, error);
+        }
+        else
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, error);
+        }
+    }
+
+    if(_receivePending)
+    {
+        return read; // Wait for the completion of the receive request.
+    }
+#endif
+
     while(length > 0)
     {
 #ifdef _WIN32
@@ -296,14 +548,21 @@ StreamSocket::write(const char* buf, size_t length)
     size_t packetSize = _maxSendPacketSize > 0 ? std::min(length, _maxSendPacketSize / 2) : length;
 #else
     size_t packetSize = length;
+#endif
+    int flags = 0;
+#if defined(ICE_USE_ZEROCOPY)
+    if(_zeroCopySize > 0 && length >= _zeroCopySize && _state == StateConnected)
+    {
+        flags = MSG_ZEROCOPY;
+    }
 #endif
     ssize_t sent = 0;
     while(length > 0)
     {
 #ifdef _WIN32
-        ssize_t ret = ::send(_fd, buf, static_cast<int>(packetSize), 0);
+        ssize_t ret = ::send(_fd, buf, static_cast<int>(packetSize), flags);
 #else
-        ssize_t ret = ::send(_fd, buf, packetSize, 0);
+        ssize_t ret = ::send(_fd, buf, packetSize, flags);
 #endif
         if(ret == 0)
         {
@@ -316,6 +575,12 @@ StreamSocket::write(const char* buf, size_t length)
                 continue;
             }
 
+            if(noBuffers() && flags != 0)
+            {
+                flags = 0; // Zero-copy send limit reached, use a regular send instead.
+                continue;
+            }
+
             if(noBuffers() && packetSize > 1024)
             {
                 packetSize /= 2;
@@ -340,6 +605,10 @@ StreamSocket::write(const char* buf, size_t length)
         buf += ret;
         sent += ret;
         length -= static_cast<size_t>(ret);
+        if(flags != 0)
+        {
+            ++_zeroCopySent;
+        }
 
         if(packetSize > length)
         {
@@ -608,10 +877,70 @@ StreamSocket::finishRead(Buffer& buf)
 
 #endif
 
+#if defined(ICE_USE_IO_URING)
+ReceiveStatus
+StreamSocket::startReceive(const ReceiveBuffersPtr& buffers)
+{
+    IceUtil::Mutex::Lock sync(_receiveMutex);
+    if(_receiveDisabled || _fd == INVALID_SOCKET)
+    {
+        return ReceiveUnsupported;
+    }
+    else if(_receiveBuffer >= 0 || _receiveError)
+    {
+        return ReceiveReady;
+    }
+
+    assert(!_receivePending);
+    _receiveBuffers = buffers;
+    _receivePending = true;
+    return ReceiveStarted;
+}
+
+void
+StreamSocket::finishReceive(int result, int buffer)
+{
+    IceUtil::Mutex::Lock sync(_receiveMutex);
+    assert(_receivePending);
+    _receivePending = false;
+    if(result > 0)
+    {
+        assert(buffer >= 0 && _receiveBuffer < 0);
+        if(_fd == INVALID_SOCKET)
+        {
+            _receiveBuffers->release(buffer); // Closed while the request was pending.
+        }
+        else
+        {
+            _receiveBuffer = buffer;
+            _receiveOffset = 0;
+            _receiveLength = static_cast<size_t>(result);
+        }
+    }
+    else if(result < 0 && result != -ECANCELED && result != -ENOBUFS && result != -EAGAIN && result != -EINTR)
+    {
+        _receiveError = -result;
+    }
+
+    //
+    // If the connection was closed by the peer (result == 0), the next read of the socket
+    // returns 0 as well and raises ConnectionLostException.
+    //
+}
+#endif
+
 void
 StreamSocket::close()
 {
     assert(_fd != INVALID_SOCKET);
+#if defined(ICE_USE_IO_URING)
+    IceUtil::Mutex::Lock sync(_receiveMutex);
+    if(_receiveBuffer >= 0)
+    {
+        _receiveBuffers->release(_receiveBuffer);
+        _receiveBuffer = -1;
+    }
+#endif
     try
     {
 #if defined(ICE_OS_UWP)
@@ -30,6 +30,11 @@ public:
 
     SocketOperation read(Buffer&);
     SocketOperation write(Buffer&);
+    SocketOperation writev(Buffer&, const std::vector<Buffer*>&);
+
+    bool enableZeroCopy(size_t);
+    Ice::Long zeroCopySent() const;
+    Ice::Long zeroCopyCompleted();
 
 #if !defined(ICE_OS_UWP)
     ssize_t read(char*, size_t);
@@ -40,6 +45,11 @@ public:
     AsyncInfo* getAsyncInfo(SocketOperation);
 #endif
 
+#if defined(ICE_USE_IO_URING)
+    virtual ReceiveStatus startReceive(const ReceiveBuffersPtr&);
+    virtual void finishReceive(int, int);
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     bool startWrite(Buffer&);
     void finishWrite(Buffer&);
@@ -73,6 +83,25 @@ private:
     State _state;
     std::string _desc;
 
+    size_t _zeroCopySize;
+    Ice::Long _zeroCopySent;
+    Ice::Long _zeroCopyCompleted;
+
+#if defined(ICE_USE_IO_URING)
+    //
+    // The state of the completion-based receives of the io_uring selector backend. The data
+    // of the received buffer is read before the socket is read again. The socket isn't read
+    // directly while a receive request is pending, this would re-order the data.
+    //
+    IceUtil::Mutex _receiveMutex;
+    ReceiveBuffersPtr _receiveBuffers;
+    bool _receivePending;
+    int _receiveBuffer;
+    size_t _receiveOffset;
+    size_t _receiveLength;
+    int _receiveError;
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     size_t _maxSendPacketSize;
     size_t _maxRecvPacketSize;
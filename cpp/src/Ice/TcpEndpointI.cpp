@@ -38,10 +38,11 @@ createIceTCP(const CommunicatorPtr& c, const string&, const StringSeq&)
 
 IceInternal::TcpEndpointI::TcpEndpointI(const ProtocolInstancePtr& instance, const string& host, Int port,
                                         const Address& sourceAddr, Int timeout, const string& connectionId,
-                                        bool compress) :
+                                        bool compress, const string& compressCodec) :
     IPEndpointI(instance, host, port, sourceAddr, connectionId),
     _timeout(timeout),
-    _compress(compress)
+    _compress(compress),
+    _compressCodec(compressCodec)
 {
 }
 
@@ -92,7 +93,8 @@ IceInternal::TcpEndpointI::timeout(Int timeout) const
     }
     else
     {
-        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, _port, _sourceAddr, timeout, _connectionId, _compress);
+        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, _port, _sourceAddr, timeout, _connectionId, _compress,
+                               _compressCodec);
     }
 }
 
@@ -111,10 +113,17 @@ IceInternal::TcpEndpointI::compress(bool compress) const
     }
     else
     {
-        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, _port, _sourceAddr, _timeout, _connectionId, compress);
+        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, _port, _sourceAddr, _timeout, _connectionId, compress,
+                               _compressCodec);
     }
 }
 
+string
+IceInternal::TcpEndpointI::compressionCodec() const
+{
+    return _compressCodec;
+}
+
 bool
 IceInternal::TcpEndpointI::datagram() const
 {
@@ -143,7 +152,8 @@ IceInternal::TcpEndpointI::endpoint(const TcpAcceptorPtr& acceptor) const
     }
     else
     {
-        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, port, _sourceAddr, _timeout, _connectionId, _compress);
+        return ICE_MAKE_SHARED(TcpEndpointI, _instance, _host, port, _sourceAddr, _timeout, _connectionId, _compress,
+                               _compressCodec);
     }
 }
 
@@ -173,6 +183,10 @@ IceInternal::TcpEndpointI::options() const
     if(_compress)
     {
         s << " -z";
+        if(!_compressCodec.empty())
+        {
+            s << ' ' << _compressCodec;
+        }
     }
 
     return s.str();
@@ -210,6 +224,11 @@ IceInternal::TcpEndpointI::operator==(const LocalObject& r) const
     {
         return false;
     }
+
+    if(_compressCodec != p->_compressCodec)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -254,6 +273,15 @@ IceInternal::TcpEndpointI::operator<(const LocalObject& r) const
         return false;
     }
 
+    if(_compressCodec < p->_compressCodec)
+    {
+        return true;
+    }
+    else if(p->_compressCodec < _compressCodec)
+    {
+        return false;
+    }
+
     return IPEndpointI::operator<(r);
 }
 
@@ -263,6 +291,7 @@ IceInternal::TcpEndpointI::hashInit(Ice::Int& h) const
     IPEndpointI::hashInit(h);
     hashAdd(h, _timeout);
     hashAdd(h, _compress);
+    hashAdd(h, _compressCodec);
 }
 
 void
@@ -309,12 +338,12 @@ IceInternal::TcpEndpointI::checkOption(const string& option, const string& argum
 
     case 'z':
     {
-        if(!argument.empty())
-        {
-            throw EndpointParseException(__FILE__, __LINE__, "unexpected argument `" + argument +
-                                         "' provided for -z option in " + endpoint);
-        }
+        //
+        // The optional argument is the name of the compression codec, it's
+        // not marshaled with the endpoint.
+        //
         const_cast<bool&>(_compress) = true;
+        const_cast<string&>(_compressCodec) = argument;
         return true;
     }
 
@@ -334,7 +363,8 @@ IceInternal::TcpEndpointI::createConnector(const Address& address, const Network
 IPEndpointIPtr
 IceInternal::TcpEndpointI::createEndpoint(const string& host, int port, const string& connectionId) const
 {
-    return ICE_MAKE_SHARED(TcpEndpointI, _instance, host, port, _sourceAddr, _timeout, connectionId, _compress);
+    return ICE_MAKE_SHARED(TcpEndpointI, _instance, host, port, _sourceAddr, _timeout, connectionId, _compress,
+                           _compressCodec);
 }
 
 IceInternal::TcpEndpointFactory::TcpEndpointFactory(const ProtocolInstancePtr& instance) : _instance(instance)
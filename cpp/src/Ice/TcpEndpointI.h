@@ -18,7 +18,7 @@ class TcpEndpointI : public IPEndpointI
 public:
 
     TcpEndpointI(const ProtocolInstancePtr&, const std::string&, Ice::Int, const Address&, Ice::Int, const std::string&,
-                 bool);
+                 bool, const std::string& = std::string());
     TcpEndpointI(const ProtocolInstancePtr&);
     TcpEndpointI(const ProtocolInstancePtr&, Ice::InputStream*);
 
@@ -30,6 +30,7 @@ public:
     virtual EndpointIPtr timeout(Ice::Int) const;
     virtual bool compress() const;
     virtual EndpointIPtr compress(bool) const;
+    virtual std::string compressionCodec() const;
     virtual bool datagram() const;
 
     virtual TransceiverPtr transceiver() const;
@@ -63,6 +64,7 @@ private:
     //
     const Ice::Int _timeout;
     const bool _compress;
+    const std::string _compressCodec;
 };
 
 class TcpEndpointFactory : public EndpointFactory
@@ -9,6 +9,7 @@
 #include <Ice/TcpTransceiver.h>
 #include <Ice/Connection.h>
 #include <Ice/ProtocolInstance.h>
+#include <Ice/Properties.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
@@ -49,6 +50,31 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return _stream->write(buf);
 }
 
+SocketOperation
+IceInternal::TcpTransceiver::writev(Buffer& buf, const vector<Buffer*>& buffers)
+{
+    return _stream->writev(buf, buffers);
+}
+
+bool
+IceInternal::TcpTransceiver::enableZeroCopy()
+{
+    size_t size = _instance->tcpZeroCopySize();
+    return size > 0 && _stream->enableZeroCopy(size);
+}
+
+Ice::Long
+IceInternal::TcpTransceiver::zeroCopySent() const
+{
+    return _stream->zeroCopySent();
+}
+
+Ice::Long
+IceInternal::TcpTransceiver::zeroCopyCompleted()
+{
+    return _stream->zeroCopyCompleted();
+}
+
 SocketOperation
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
@@ -28,6 +28,10 @@ public:
     virtual void close();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+    virtual SocketOperation writev(Buffer&, const std::vector<Buffer*>&);
+    virtual bool enableZeroCopy();
+    virtual Ice::Long zeroCopySent() const;
+    virtual Ice::Long zeroCopyCompleted();
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -4,6 +4,7 @@
 
 #include <Ice/ThreadPool.h>
 #include <Ice/EventHandler.h>
+#include <Ice/Connection.h>
 #include <Ice/Network.h>
 #include <Ice/LocalException.h>
 #include <Ice/Instance.h>
@@ -157,7 +158,7 @@ void
 IceInternal::DispatchWorkItem::execute(ThreadPoolCurrent& current)
 {
     current.ioCompleted(); // Promote follower
-    current.dispatchFromThisThread(this);
+    current.dispatch(this);
 }
 
 IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) :
@@ -266,7 +267,8 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
     return 0;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout,
+                                    ThreadPool* parent, int shard) :
     _instance(instance),
 #ifdef ICE_SWIFT
     _dispatchQueue(dispatch_queue_create(prefixToDispatchQueueLabel(prefix).c_str(),
@@ -288,6 +290,11 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _serverIdleTime(timeout),
     _threadIdleTime(0),
     _stackSize(0),
+    _parent(parent),
+    _shard(shard),
+    _load(0),
+    _nextShard(0),
+    _idle(false),
     _inUse(0),
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     _inUseIO(0),
@@ -377,10 +384,87 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
 #endif
     const_cast<int&>(_threadIdleTime) = threadIdleTime;
 
+    int shards = properties->getPropertyAsIntWithDefault(_prefix + ".Shards", 1);
+    if(shards < 1)
+    {
+        if(!_parent)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Shards < 1; Shards adjusted to 1";
+        }
+        shards = 1;
+    }
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+    if(shards > 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Shards is not supported on this platform; Shards adjusted to 1";
+        shards = 1;
+    }
+#else
+    if(_parent)
+    {
+        //
+        // Each shard has a single IO thread with its own selector. The threads of the
+        // parent thread pool are evenly distributed among the shards.
+        //
+        const_cast<int&>(_size) = max(1, (_size + shards - 1) / shards);
+        const_cast<int&>(_sizeMax) = max(_size, (_sizeMax + shards - 1) / shards);
+        if(_sizeWarn != 0)
+        {
+            const_cast<int&>(_sizeWarn) = min(_sizeMax, max(_size, (_sizeWarn + shards - 1) / shards));
+        }
+        const_cast<int&>(_sizeIO) = 1;
+    }
+#endif
+
+    int dispatchWorkers = _parent ? 0 : properties->getPropertyAsInt(_prefix + ".DispatchWorkers");
+    if(dispatchWorkers < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".DispatchWorkers < 0; DispatchWorkers adjusted to 0";
+        dispatchWorkers = 0;
+    }
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+    if(dispatchWorkers > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".DispatchWorkers is not supported on this platform; DispatchWorkers adjusted to 0";
+        dispatchWorkers = 0;
+    }
+#endif
+
 #ifdef ICE_USE_IOCP
     _selector.setup(_sizeIO);
 #endif
 
+    string backend = properties->getProperty(_prefix + ".Backend");
+    if(!backend.empty() && backend != "default")
+    {
+#if defined(ICE_USE_IO_URING)
+        if(backend != "uring")
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "unknown selector backend `" << backend << "' for `" << _prefix << "'; using default";
+        }
+        else if(!_selector.setupUring(static_cast<unsigned int>(
+                    properties->getPropertyAsIntWithDefault(_prefix + ".BackendQueueSize", 256))))
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "cannot use io_uring selector backend for `" << _prefix << "'; using default";
+        }
+        else if(_instance->traceLevels()->threadPool >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+            out << "using io_uring selector backend for `" << _prefix << "'";
+        }
+#else
+        Warning out(_instance->initializationData().logger);
+        out << "selector backend `" << backend << "' is not supported on this platform for `" << _prefix
+            << "'; using default";
+#endif
+    }
+
 #if defined(__APPLE__)
     //
     // We use a default stack size of 1MB on macOS and the new C++11 mapping to allow transmitting
@@ -410,17 +494,43 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
-    if(_instance->traceLevels()->threadPool >= 1)
+    if(!_parent && _instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
         out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
             << _sizeWarn;
+        if(shards > 1)
+        {
+            out << ", Shards = " << shards;
+        }
+        if(dispatchWorkers > 0)
+        {
+            out << ", DispatchWorkers = " << dispatchWorkers;
+        }
     }
 
     __setNoDelete(true);
     try
     {
-        for(int i = 0 ; i < _size ; ++i)
+        if(dispatchWorkers > 0)
+        {
+            _dispatchWorkers = new DispatchWorkerPool(_instance, _prefix, dispatchWorkers, _stackSize, _hasPriority,
+                                                      _priority);
+        }
+        else if(_parent)
+        {
+            _dispatchWorkers = _parent->_dispatchWorkers;
+        }
+
+        if(!_parent && shards > 1)
+        {
+            for(int i = 0; i < shards; ++i)
+            {
+                _shards.push_back(new ThreadPool(_instance, _prefix, timeout, this, i));
+            }
+        }
+
+        for(int i = 0 ; _shards.empty() && i < _size ; ++i)
         {
             EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId());
             if(_hasPriority)
@@ -472,6 +582,10 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+    for(vector<ThreadPoolPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        (*p)->destroy();
+    }
 }
 
 void
@@ -482,11 +596,40 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+    for(vector<ThreadPoolPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        (*p)->updateObservers();
+    }
 }
 
 void
 IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
+    if(!_shards.empty())
+    {
+        //
+        // Assign the handler to the least loaded shard. The search starts with a different
+        // shard each time to evenly distribute the handlers among shards with the same load.
+        // Since the load is decreased when the handler is finished, new handlers are
+        // assigned to the shards whose connections were closed.
+        //
+        int sz = static_cast<int>(_shards.size());
+        int start = (_nextShard.fetch_add(1) & 0x7FFFFFFF) % sz;
+        ThreadPool* shard = _shards[start].get();
+        for(int i = 1; i < sz; ++i)
+        {
+            ThreadPool* p = _shards[(start + i) % sz].get();
+            if(p->_load.load() < shard->_load.load())
+            {
+                shard = p;
+            }
+        }
+        shard->_load.fetch_add(1);
+        handler->_shard = shard;
+        shard->initialize(handler);
+        return;
+    }
+
     Lock sync(*this);
     assert(!_destroyed);
     _selector.initialize(handler.get());
@@ -517,6 +660,12 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 void
 IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation remove, SocketOperation add)
 {
+    if(!_shards.empty())
+    {
+        getShard(handler)->update(handler, remove, add);
+        return;
+    }
+
     Lock sync(*this);
     assert(!_destroyed);
 
@@ -537,6 +686,14 @@ IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation
 bool
 IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 {
+    if(!_shards.empty())
+    {
+        ThreadPool* shard = getShard(handler);
+        closeNow = shard->finish(handler, closeNow);
+        shard->_load.fetch_sub(1);
+        return closeNow;
+    }
+
     Lock sync(*this);
     assert(!_destroyed);
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
@@ -563,6 +720,12 @@ IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 void
 IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation op, bool value)
 {
+    if(!_shards.empty())
+    {
+        getShard(handler)->ready(handler, op, value);
+        return;
+    }
+
     Lock sync(*this);
     if(_destroyed)
     {
@@ -621,12 +784,82 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
+    if(!_shards.empty())
+    {
+        //
+        // Dispatch the work item with the shard of its connection if it has one,
+        // otherwise pick the next shard.
+        //
+        ThreadPool* shard = 0;
+        EventHandler* handler = dynamic_cast<EventHandler*>(workItem->getConnection().get());
+        if(handler && handler->_shard)
+        {
+            shard = handler->_shard;
+        }
+        else
+        {
+            int sz = static_cast<int>(_shards.size());
+            shard = _shards[(_nextShard.fetch_add(1) & 0x7FFFFFFF) % sz].get();
+        }
+        shard->dispatch(workItem);
+        return;
+    }
+
     Lock sync(*this);
     if(_destroyed)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
     }
-    _workQueue->queue(workItem);
+    if(_dispatchWorkers)
+    {
+        _dispatchWorkers->queue(this, workItem, 0, SocketOperationNone);
+    }
+    else
+    {
+        _workQueue->queue(workItem);
+    }
+}
+
+void
+IceInternal::ThreadPool::dispatch(ThreadPoolCurrent& current, const DispatchWorkItemPtr& workItem)
+{
+    if(!_dispatchWorkers)
+    {
+        dispatchFromThisThread(workItem);
+        return;
+    }
+
+    EventHandlerPtr handler;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(_serialize && current._handler.get() != _workQueue.get())
+    {
+        //
+        // The handler is disabled until the dispatch worker is done with the work item. This
+        // ensures that messages from the same connection are dispatched in order even if they
+        // are dispatched by different workers.
+        //
+        Lock sync(*this);
+        if(!_destroyed)
+        {
+            _selector.disable(current._handler.get(), current.operation);
+            handler = current._handler;
+            current._dispatched = true;
+        }
+    }
+#endif
+    _dispatchWorkers->queue(this, workItem, handler, current.operation);
+}
+
+void
+IceInternal::ThreadPool::dispatchCompleted(const EventHandlerPtr& handler, SocketOperation operation)
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    Lock sync(*this);
+    _selector.enable(handler.get(), operation);
+#else
+    UNREFERENCED_PARAMETER(handler);
+    UNREFERENCED_PARAMETER(operation);
+#endif
 }
 
 void
@@ -644,6 +877,30 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+    for(vector<ThreadPoolPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        assert((*p)->_destroyed);
+        for(set<EventHandlerThreadPtr>::iterator q = (*p)->_threads.begin(); q != (*p)->_threads.end(); ++q)
+        {
+            (*q)->getThreadControl().join();
+        }
+    }
+
+    //
+    // The dispatch workers are destroyed once all the IO threads are joined since no more
+    // work items can be queued at this point. They might still re-enable handlers so the
+    // selectors are destroyed last.
+    //
+    if(_dispatchWorkers && !_parent)
+    {
+        _dispatchWorkers->destroy();
+        _dispatchWorkers->joinWithAllThreads();
+    }
+
+    for(vector<ThreadPoolPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        (*p)->_selector.destroy();
+    }
     _selector.destroy();
 }
 
@@ -653,6 +910,26 @@ IceInternal::ThreadPool::prefix() const
     return _prefix;
 }
 
+int
+IceInternal::ThreadPool::dispatchThreads() const
+{
+    //
+    // The number of requests which can be dispatched concurrently by this thread pool
+    // while one of its threads keeps reading messages.
+    //
+    if(_dispatchWorkers)
+    {
+        return _dispatchWorkers->size();
+    }
+    return max(1, _sizeMax - 1);
+}
+
+bool
+IceInternal::ThreadPool::serialize() const
+{
+    return _serialize;
+}
+
 #ifdef ICE_SWIFT
 
 dispatch_queue_t
@@ -704,6 +981,16 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             }
             catch(const SelectorTimeoutException&)
             {
+                if(_parent)
+                {
+                    {
+                        Lock sync(*this);
+                        _idle = _inUse == 0;
+                    }
+                    _parent->shardIdle(); // The parent checks if all the shards are idle.
+                    continue;
+                }
+
                 Lock sync(*this);
                 if(!_destroyed && _inUse == 0)
                 {
@@ -721,6 +1008,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                 {
                     _selector.finishSelect(_handlers);
                     _nextHandler = _handlers.begin();
+                    _idle = false;
                     select = false;
                 }
                 else if(!current._leader && followerWait(current))
@@ -744,7 +1032,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     // If the handler called ioCompleted(), we re-enable the handler in
                     // case it was disabled and we decrease the number of thread in use.
                     //
-                    if(_serialize && current._handler.get() != _workQueue.get())
+                    if(_serialize && current._handler.get() != _workQueue.get() && !current._dispatched)
                     {
                         _selector.enable(current._handler.get(), current.operation);
                     }
@@ -769,6 +1057,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             if(_nextHandler != _handlers.end())
             {
                 current._ioCompleted = false;
+                current._dispatched = false;
                 current._handler = ICE_GET_SHARED_FROM_THIS(_nextHandler->first);
                 current.operation = _nextHandler->second;
                 ++_nextHandler;
@@ -1193,11 +1482,48 @@ IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current)
 }
 #endif
 
+ThreadPool*
+IceInternal::ThreadPool::getShard(const EventHandlerPtr& handler) const
+{
+    assert(handler->_shard); // The handler must have been initialized with this thread pool.
+    return handler->_shard;
+}
+
+void
+IceInternal::ThreadPool::shardIdle()
+{
+    //
+    // Called by a shard when its select times out. Shutdown is only initiated once all
+    // the shards are idle.
+    //
+    for(vector<ThreadPoolPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        Lock sync(**p);
+        if((*p)->_destroyed || !(*p)->_idle)
+        {
+            return;
+        }
+    }
+
+    ThreadPool* shard = _shards.front().get();
+    Lock sync(*shard);
+    if(!shard->_destroyed)
+    {
+        shard->_idle = false;
+        shard->_workQueue->queue(new ShutdownWorkItem(_instance)); // All the shards timed-out.
+    }
+}
+
 string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if(_shard >= 0)
+    {
+        os << _shard << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
@@ -1316,9 +1642,255 @@ ThreadPoolCurrent::ThreadPoolCurrent(const InstancePtr& instance,
     stream(instance.get(), Ice::currentProtocolEncoding),
     _threadPool(threadPool.get()),
     _thread(thread),
-    _ioCompleted(false)
+    _ioCompleted(false),
+    _dispatched(false)
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     , _leader(false)
 #endif
 {
 }
+
+IceInternal::DispatchWorkerPool::DispatchWorkerPool(const InstancePtr& instance, const string& prefix, int size,
+                                                   size_t stackSize, bool hasPriority, int priority) :
+    _instance(instance),
+    _prefix(prefix),
+    _nextWorker(0),
+    _pending(0),
+    _waiting(0),
+    _destroyed(false)
+{
+    __setNoDelete(true);
+    size_t started = 0;
+    try
+    {
+        //
+        // Create all the workers before starting them, the workers access the queues of
+        // the other workers to steal work items.
+        //
+        for(int i = 0; i < size; ++i)
+        {
+            ostringstream os;
+            os << _prefix << "-dispatch-" << i;
+            _workers.push_back(new Worker(this, os.str(), static_cast<size_t>(i)));
+        }
+
+        for(; started < _workers.size(); ++started)
+        {
+            if(hasPriority)
+            {
+                _workers[started]->start(stackSize, priority);
+            }
+            else
+            {
+                _workers[started]->start(stackSize);
+            }
+        }
+    }
+    catch(const IceUtil::Exception& ex)
+    {
+        {
+            Error out(_instance->initializationData().logger);
+            out << "cannot create dispatch worker for `" << _prefix << "':\n" << ex;
+        }
+
+        destroy();
+        for(size_t i = 0; i < started; ++i)
+        {
+            _workers[i]->getThreadControl().join();
+        }
+        _workers.clear();
+        __setNoDelete(false);
+        throw;
+    }
+    catch(...)
+    {
+        __setNoDelete(false);
+        throw;
+    }
+    __setNoDelete(false);
+}
+
+void
+IceInternal::DispatchWorkerPool::queue(ThreadPool* threadPool, const DispatchWorkItemPtr& workItem,
+                                       const EventHandlerPtr& handler, SocketOperation operation)
+{
+    Task task;
+    task.threadPool = threadPool;
+    task.workItem = workItem;
+    task.handler = handler;
+    task.operation = operation;
+
+    Worker* worker = _workers[static_cast<unsigned int>(_nextWorker.fetch_add(1)) % _workers.size()].get();
+    {
+        IceUtil::Mutex::Lock sync(worker->_mutex);
+        worker->_tasks.push_back(task);
+    }
+
+    //
+    // The pending count is increased once the task is queued and a waiting worker is only
+    // notified if there's one. Workers increase the waiting count before checking the
+    // pending count so a worker is either notified or sees the new task.
+    //
+    _pending.fetch_add(1);
+    if(_waiting.load() > 0)
+    {
+        Lock sync(*this);
+        notify();
+    }
+}
+
+void
+IceInternal::DispatchWorkerPool::destroy()
+{
+    Lock sync(*this);
+    _destroyed = true;
+    notifyAll();
+}
+
+void
+IceInternal::DispatchWorkerPool::joinWithAllThreads()
+{
+    assert(_destroyed);
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+    _workers.clear(); // Break cyclic reference count.
+}
+
+int
+IceInternal::DispatchWorkerPool::size() const
+{
+    return static_cast<int>(_workers.size());
+}
+
+void
+IceInternal::DispatchWorkerPool::run(size_t index)
+{
+    Task task;
+    while(nextTask(index, task))
+    {
+        try
+        {
+            task.threadPool->dispatchFromThisThread(task.workItem);
+        }
+        catch(const exception& ex)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "exception in `" << _prefix << "' dispatch worker:\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "unknown exception in `" << _prefix << "' dispatch worker";
+        }
+
+        if(task.handler)
+        {
+            task.threadPool->dispatchCompleted(task.handler, task.operation);
+        }
+        task = Task(); // Release the work item before waiting for the next one.
+    }
+}
+
+bool
+IceInternal::DispatchWorkerPool::nextTask(size_t index, Task& task)
+{
+    while(true)
+    {
+        //
+        // Get the next task from this worker's queue or steal it from the queue of another
+        // worker if this worker's queue is empty.
+        //
+        for(size_t i = 0; i < _workers.size(); ++i)
+        {
+            Worker* worker = _workers[(index + i) % _workers.size()].get();
+            IceUtil::Mutex::Lock sync(worker->_mutex);
+            if(!worker->_tasks.empty())
+            {
+                task = worker->_tasks.front();
+                worker->_tasks.pop_front();
+                _pending.fetch_sub(1);
+                return true;
+            }
+        }
+
+        Lock sync(*this);
+        _waiting.fetch_add(1);
+        while(_pending.load() <= 0 && !_destroyed)
+        {
+            wait();
+        }
+        _waiting.fetch_sub(1);
+        if(_destroyed && _pending.load() <= 0)
+        {
+            return false;
+        }
+    }
+}
+
+IceInternal::DispatchWorkerPool::Worker::Worker(const DispatchWorkerPoolPtr& pool, const string& name, size_t index) :
+    IceUtil::Thread(name),
+    _pool(pool),
+    _index(index)
+{
+}
+
+void
+IceInternal::DispatchWorkerPool::Worker::run()
+{
+    const InitializationData& initData = _pool->_instance->initializationData();
+#ifdef ICE_CPP11_MAPPING
+    if(initData.threadStart)
+#else
+    if(initData.threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            initData.threadStart();
+#else
+            initData.threadHook->start();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _pool->_prefix << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _pool->_prefix << "'";
+        }
+    }
+
+    _pool->run(_index);
+
+#ifdef ICE_CPP11_MAPPING
+    if(initData.threadStop)
+#else
+    if(initData.threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            initData.threadStop();
+#else
+            initData.threadHook->stop();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _pool->_prefix << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _pool->_prefix << "'";
+        }
+    }
+}
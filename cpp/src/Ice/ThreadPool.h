@@ -9,6 +9,7 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/Atomic.h>
 
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
@@ -23,6 +24,7 @@
 
 #include <set>
 #include <list>
+#include <deque>
 
 namespace IceInternal
 {
@@ -61,6 +63,9 @@ private:
 };
 typedef IceUtil::Handle<DispatchWorkItem> DispatchWorkItemPtr;
 
+class DispatchWorkerPool;
+typedef IceUtil::Handle<DispatchWorkerPool> DispatchWorkerPoolPtr;
+
 class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
 {
     class EventHandlerThread : public IceUtil::Thread
@@ -83,7 +88,7 @@ class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mut
 
 public:
 
-    ThreadPool(const InstancePtr&, const std::string&, int);
+    ThreadPool(const InstancePtr&, const std::string&, int, ThreadPool* = 0, int = -1);
     virtual ~ThreadPool();
 
     void destroy();
@@ -105,10 +110,14 @@ public:
 
     void dispatchFromThisThread(const DispatchWorkItemPtr&);
     void dispatch(const DispatchWorkItemPtr&);
+    void dispatch(ThreadPoolCurrent&, const DispatchWorkItemPtr&);
+    void dispatchCompleted(const EventHandlerPtr&, SocketOperation);
 
     void joinWithAllThreads();
 
     std::string prefix() const;
+    int dispatchThreads() const;
+    bool serialize() const;
 
 #ifdef ICE_SWIFT
     dispatch_queue_t getDispatchQueue() const ICE_NOEXCEPT;
@@ -118,6 +127,9 @@ private:
 
     void run(const EventHandlerThreadPtr&);
 
+    ThreadPool* getShard(const EventHandlerPtr&) const;
+    void shardIdle();
+
     bool ioCompleted(ThreadPoolCurrent&);
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -161,6 +173,24 @@ private:
     const int _threadIdleTime;
     const size_t _stackSize;
 
+    //
+    // If the thread pool is sharded, each shard is a thread pool with its own selector
+    // and threads. Event handlers are assigned to the least loaded shard on initialize
+    // and the parent thread pool forwards all the calls for the handler to this shard.
+    //
+    ThreadPool* const _parent; // The parent thread pool if this thread pool is a shard.
+    const int _shard;
+    std::vector<ThreadPoolPtr> _shards;
+    IceUtilInternal::Atomic _load; // Number of event handlers assigned to this shard.
+    IceUtilInternal::Atomic _nextShard;
+    bool _idle; // True if the shard select timed out (only used with the server idle time).
+
+    //
+    // If set, messages read by the IO threads are dispatched by the dispatch workers. The
+    // shards of a thread pool share the dispatch workers of their parent.
+    //
+    DispatchWorkerPoolPtr _dispatchWorkers;
+
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
@@ -208,12 +238,27 @@ public:
         _threadPool->dispatchFromThisThread(workItem);
     }
 
+    //
+    // Dispatch the work item with the dispatch workers if the thread pool has dispatch
+    // workers, from this thread otherwise.
+    //
+    void dispatch(const DispatchWorkItemPtr& workItem)
+    {
+        _threadPool->dispatch(*this, workItem);
+    }
+
+    bool hasDispatchWorkers() const
+    {
+        return _threadPool->_dispatchWorkers;
+    }
+
 private:
 
     ThreadPool* _threadPool;
     ThreadPool::EventHandlerThreadPtr _thread;
     EventHandlerPtr _handler;
     bool _ioCompleted;
+    bool _dispatched; // True if the message was handed over to a dispatch worker.
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     bool _leader;
 #else
@@ -223,6 +268,63 @@ private:
     friend class ThreadPool;
 };
 
+//
+// The dispatch worker pool dispatches the work items handed over by the IO threads of
+// a thread pool. Each worker has its own queue and idle workers steal work items from
+// the queues of the other workers.
+//
+class DispatchWorkerPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    DispatchWorkerPool(const InstancePtr&, const std::string&, int, size_t, bool, int);
+
+    void queue(ThreadPool*, const DispatchWorkItemPtr&, const EventHandlerPtr&, SocketOperation);
+    void destroy();
+    void joinWithAllThreads();
+
+    int size() const;
+
+private:
+
+    struct Task
+    {
+        ThreadPool* threadPool;
+        DispatchWorkItemPtr workItem;
+        EventHandlerPtr handler; // Set if the handler needs to be re-enabled once the work item is dispatched.
+        SocketOperation operation;
+    };
+
+    class Worker : public IceUtil::Thread
+    {
+    public:
+
+        Worker(const DispatchWorkerPoolPtr&, const std::string&, size_t);
+        virtual void run();
+
+    private:
+
+        friend class DispatchWorkerPool;
+
+        const DispatchWorkerPoolPtr _pool;
+        const size_t _index;
+        IceUtil::Mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+    typedef IceUtil::Handle<Worker> WorkerPtr;
+
+    void run(size_t);
+    bool nextTask(size_t, Task&);
+
+    const InstancePtr _instance;
+    const std::string _prefix;
+    std::vector<WorkerPtr> _workers;
+    IceUtilInternal::Atomic _nextWorker;
+    IceUtilInternal::Atomic _pending; // Number of queued tasks.
+    IceUtilInternal::Atomic _waiting; // Number of workers waiting for tasks.
+    bool _destroyed;
+};
+
 class ThreadPoolWorkQueue : public EventHandler
 {
 public:
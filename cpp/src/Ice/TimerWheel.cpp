@@ -0,0 +1,679 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/TimerWheel.h>
+#include <IceUtil/Exception.h>
+#include <Ice/ConsoleUtil.h>
+
+using namespace std;
+using namespace IceUtil;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Each timer shard keeps its tasks in a hierarchical timing wheel with a resolution
+// of one millisecond. The wheel has 4 levels of 256 slots, the slots of level L
+// cover 256^L milliseconds. A task is placed in the level whose range covers its
+// expiry time and moves down one level each time the wheel reaches the slot where
+// the task is. Tasks further than the range of the wheel (about 49 days) are kept
+// in the last slot of the highest level and re-inserted when it's reached.
+//
+const int wheelLevels = 4;
+const int wheelBits = 8;
+const int wheelSlots = 1 << wheelBits;
+const Int64 wheelRange = static_cast<Int64>(1) << (wheelLevels * wheelBits);
+
+const size_t minHashSize = 64; // Must be a power of 2.
+
+}
+
+class TimerWheel::Shard : public IceUtil::Thread
+{
+public:
+
+    Shard(const TimerWheelPtr&);
+    virtual ~Shard();
+
+    bool destroy();
+    void schedule(const TimerTaskPtr&, const IceUtil::Time&, bool);
+    bool cancel(const TimerTaskPtr&);
+
+    virtual void run();
+
+private:
+
+    struct Entry
+    {
+        Entry(const TimerTaskPtr& t, const IceUtil::Time& d) :
+            task(t), delay(d), expiry(0), slot(0), prev(0), next(0), hashNext(0), inWheel(false), canceled(false)
+        {
+        }
+
+        TimerTaskPtr task;
+        IceUtil::Time delay; // Zero for non-repeated tasks.
+        Int64 expiry; // In milliseconds.
+
+        Entry** slot; // The wheel slot and the previous and next entries in the slot.
+        Entry* prev;
+        Entry* next;
+        Entry* hashNext; // The next entry in the hash bucket.
+
+        bool inWheel;
+        bool canceled; // Set if the task is canceled while it's expired and waiting to run.
+    };
+
+    static Int64 currentTick();
+    static size_t hash(const TimerTask*);
+
+    void insert(Entry*);
+    void unlink(Entry*);
+    void expire(Int64);
+    Int64 nextTick() const;
+
+    Entry* find(const TimerTask*) const;
+    void addToHash(Entry*);
+    void removeFromHash(Entry*);
+
+    TimerWheelPtr _timer;
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    bool _destroyed;
+
+    Int64 _tick; // The current time of the wheel.
+    Entry* _wheel[wheelLevels][wheelSlots];
+    size_t _size; // The number of entries in the wheel.
+    vector<Entry*> _expired;
+    Int64 _wakeUpTick;
+
+    //
+    // Hash table of the scheduled tasks, used to cancel tasks and check whether a
+    // task is already scheduled.
+    //
+    vector<Entry*> _hash;
+    size_t _hashCount;
+};
+
+TimerWheel::Shard::Shard(const TimerWheelPtr& timer) :
+    Thread("IceUtil timer thread"),
+    _timer(timer),
+    _destroyed(false),
+    _tick(currentTick()),
+    _size(0),
+    _wakeUpTick(0),
+    _hash(minHashSize, static_cast<Entry*>(0)),
+    _hashCount(0)
+{
+    for(int l = 0; l < wheelLevels; ++l)
+    {
+        for(int s = 0; s < wheelSlots; ++s)
+        {
+            _wheel[l][s] = 0;
+        }
+    }
+}
+
+TimerWheel::Shard::~Shard()
+{
+    assert(_hashCount == 0);
+}
+
+bool
+TimerWheel::Shard::destroy()
+{
+    vector<Entry*> entries;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _destroyed = true;
+        _monitor.notify();
+
+        for(vector<Entry*>::iterator p = _hash.begin(); p != _hash.end(); ++p)
+        {
+            for(Entry* e = *p; e; e = e->hashNext)
+            {
+                if(e->inWheel)
+                {
+                    entries.push_back(e);
+                }
+                else
+                {
+                    e->canceled = true; // Deleted by the shard thread.
+                }
+            }
+            *p = 0;
+        }
+        _hashCount = 0;
+        for(int l = 0; l < wheelLevels; ++l)
+        {
+            for(int s = 0; s < wheelSlots; ++s)
+            {
+                _wheel[l][s] = 0;
+            }
+        }
+        _size = 0;
+    }
+
+    for(vector<Entry*>::const_iterator p = entries.begin(); p != entries.end(); ++p)
+    {
+        delete *p;
+    }
+
+    if(getThreadControl() == ThreadControl())
+    {
+        getThreadControl().detach();
+        return false;
+    }
+    return true;
+}
+
+void
+TimerWheel::Shard::schedule(const TimerTaskPtr& task, const IceUtil::Time& delay, bool repeated)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+    if(_destroyed)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Time time = now + delay;
+    if(delay > IceUtil::Time() && time < now)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
+    }
+
+    if(find(task.get()))
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+    }
+
+    Entry* entry = new Entry(task, repeated ? delay : IceUtil::Time());
+
+    //
+    // Round up the expiry time to the next millisecond, the task must not run before
+    // the scheduled time.
+    //
+    entry->expiry = (time.toMicroSeconds() + 999) / 1000;
+    addToHash(entry);
+    insert(entry);
+
+    if(_wakeUpTick == 0 || entry->expiry < _wakeUpTick)
+    {
+        _monitor.notify();
+    }
+}
+
+bool
+TimerWheel::Shard::cancel(const TimerTaskPtr& task)
+{
+    Entry* entry;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        if(_destroyed)
+        {
+            return false;
+        }
+
+        entry = find(task.get());
+        if(!entry)
+        {
+            return false;
+        }
+
+        removeFromHash(entry);
+        if(!entry->inWheel)
+        {
+            //
+            // The task expired and is waiting to run, or it's a repeated task which is
+            // running. The shard thread deletes the entry.
+            //
+            entry->canceled = true;
+            return true;
+        }
+        unlink(entry);
+    }
+
+    //
+    // Release the task outside the synchronization, this might call user code.
+    //
+    delete entry;
+    return true;
+}
+
+void
+TimerWheel::Shard::run()
+{
+    vector<Entry*> expired;
+    while(true)
+    {
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            while(!_destroyed)
+            {
+                expire(currentTick());
+                if(!_expired.empty())
+                {
+                    break;
+                }
+
+                if(_size == 0)
+                {
+                    _wakeUpTick = 0;
+                    _monitor.wait();
+                    continue;
+                }
+
+                _wakeUpTick = nextTick();
+                IceUtil::Time timeout = IceUtil::Time::milliSeconds(_wakeUpTick) -
+                    IceUtil::Time::now(IceUtil::Time::Monotonic);
+                try
+                {
+                    if(timeout > IceUtil::Time())
+                    {
+                        _monitor.timedWait(timeout);
+                    }
+                }
+                catch(const IceUtil::InvalidTimeoutException&)
+                {
+                    timeout = timeout / 2;
+                    while(timeout > IceUtil::Time())
+                    {
+                        try
+                        {
+                            _monitor.timedWait(timeout);
+                            break;
+                        }
+                        catch(const IceUtil::InvalidTimeoutException&)
+                        {
+                            timeout = timeout / 2;
+                        }
+                    }
+                }
+            }
+
+            if(_destroyed)
+            {
+                break;
+            }
+
+            //
+            // Run all the expired tasks, in the order of their expiry time.
+            //
+            expired.swap(_expired);
+        }
+
+        for(vector<Entry*>::const_iterator p = expired.begin(); p != expired.end(); ++p)
+        {
+            Entry* entry = *p;
+            {
+                IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+                if(entry->canceled)
+                {
+                    sync.release();
+                    delete entry;
+                    continue;
+                }
+                if(entry->delay == IceUtil::Time())
+                {
+                    removeFromHash(entry); // The task can no longer be canceled.
+                }
+            }
+
+            try
+            {
+                _timer->runTimerTask(entry->task);
+            }
+            catch(const IceUtil::Exception& e)
+            {
+                consoleErr << "IceInternal::TimerWheel::run(): uncaught exception:\n" << e.what();
+#ifdef __GNUC__
+                consoleErr << "\n" << e.ice_stackTrace();
+#endif
+                consoleErr << endl;
+            }
+            catch(const std::exception& e)
+            {
+                consoleErr << "IceInternal::TimerWheel::run(): uncaught exception:\n" << e.what() << endl;
+            }
+            catch(...)
+            {
+                consoleErr << "IceInternal::TimerWheel::run(): uncaught exception" << endl;
+            }
+
+            if(entry->delay != IceUtil::Time())
+            {
+                //
+                // If the task is a repeated task, schedule it again for execution if it
+                // wasn't canceled.
+                //
+                IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+                if(!entry->canceled)
+                {
+                    IceUtil::Time time = IceUtil::Time::now(IceUtil::Time::Monotonic) + entry->delay;
+                    entry->expiry = (time.toMicroSeconds() + 999) / 1000;
+                    insert(entry);
+                    continue;
+                }
+            }
+
+            //
+            // Clear the task reference outside the synchronization. Clearing the task
+            // reference might end up calling user code which could trigger a deadlock.
+            // See also issue #352.
+            //
+            delete entry;
+        }
+        expired.clear();
+    }
+
+    //
+    // Delete the entries which were expired when the shard was destroyed.
+    //
+    for(vector<Entry*>::const_iterator p = _expired.begin(); p != _expired.end(); ++p)
+    {
+        delete *p;
+    }
+    _expired.clear();
+    for(vector<Entry*>::const_iterator p = expired.begin(); p != expired.end(); ++p)
+    {
+        delete *p;
+    }
+
+    //
+    // Release the timer last, this might destroy it.
+    //
+    _timer = 0;
+}
+
+Int64
+TimerWheel::Shard::currentTick()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+}
+
+size_t
+TimerWheel::Shard::hash(const TimerTask* task)
+{
+    size_t h = reinterpret_cast<size_t>(task);
+    return h ^ (h >> 4) ^ (h >> 12);
+}
+
+void
+TimerWheel::Shard::insert(Entry* entry)
+{
+    Int64 delta = entry->expiry - _tick;
+    if(delta <= 0)
+    {
+        entry->inWheel = false;
+        _expired.push_back(entry);
+        return;
+    }
+
+    //
+    // Find the lowest level where the entry's slot is one of the next 255 slots.
+    //
+    Int64 expiry = entry->expiry;
+    int level = 0;
+    while(level < wheelLevels - 1 && (expiry >> (level * wheelBits)) - (_tick >> (level * wheelBits)) >= wheelSlots)
+    {
+        ++level;
+    }
+    if((expiry >> (level * wheelBits)) - (_tick >> (level * wheelBits)) >= wheelSlots)
+    {
+        //
+        // Beyond the range of the wheel, use the last slot of the highest level.
+        //
+        expiry = ((_tick >> (level * wheelBits)) + wheelSlots - 1) << (level * wheelBits);
+    }
+
+    Entry*& slot = _wheel[level][(expiry >> (level * wheelBits)) & (wheelSlots - 1)];
+    entry->slot = &slot;
+    entry->prev = 0;
+    entry->next = slot;
+    if(slot)
+    {
+        slot->prev = entry;
+    }
+    slot = entry;
+    entry->inWheel = true;
+    ++_size;
+}
+
+void
+TimerWheel::Shard::unlink(Entry* entry)
+{
+    assert(entry->inWheel);
+    if(entry->prev)
+    {
+        entry->prev->next = entry->next;
+    }
+    else
+    {
+        *entry->slot = entry->next;
+    }
+    if(entry->next)
+    {
+        entry->next->prev = entry->prev;
+    }
+    entry->slot = 0;
+    entry->prev = 0;
+    entry->next = 0;
+    entry->inWheel = false;
+    --_size;
+}
+
+void
+TimerWheel::Shard::expire(Int64 now)
+{
+    //
+    // Advance the wheel to the given time. The wheel jumps from one slot with entries
+    // to the next, the entries of the slots of the higher levels move down to the
+    // lower levels and the entries of the level 0 slots are expired.
+    //
+    while(_tick < now)
+    {
+        Int64 tick = _size > 0 ? nextTick() : now;
+        if(tick > now)
+        {
+            _tick = now;
+            break;
+        }
+        _tick = tick;
+
+        for(int l = wheelLevels - 1; l >= 0; --l)
+        {
+            if(_tick & ((static_cast<Int64>(1) << (l * wheelBits)) - 1))
+            {
+                continue; // Not at the start of a slot of this level.
+            }
+
+            Entry*& slot = _wheel[l][(_tick >> (l * wheelBits)) & (wheelSlots - 1)];
+            Entry* e = slot;
+            slot = 0;
+            while(e)
+            {
+                Entry* next = e->next;
+                --_size;
+                insert(e); // Expired if it's a level 0 entry.
+                e = next;
+            }
+        }
+    }
+}
+
+Int64
+TimerWheel::Shard::nextTick() const
+{
+    //
+    // Return the time of the next slot with entries. Entries of a level L slot are
+    // in one of the next 255 slots of the level, from the current time.
+    //
+    Int64 next = _tick + wheelRange;
+    for(int l = 0; l < wheelLevels; ++l)
+    {
+        Int64 base = _tick >> (l * wheelBits);
+        for(int k = 1; k < wheelSlots; ++k)
+        {
+            Int64 tick = (base + k) << (l * wheelBits);
+            if(tick >= next)
+            {
+                break;
+            }
+            if(_wheel[l][(base + k) & (wheelSlots - 1)])
+            {
+                next = tick;
+                break;
+            }
+        }
+    }
+    return next;
+}
+
+TimerWheel::Shard::Entry*
+TimerWheel::Shard::find(const TimerTask* task) const
+{
+    for(Entry* e = _hash[hash(task) & (_hash.size() - 1)]; e; e = e->hashNext)
+    {
+        if(e->task.get() == task)
+        {
+            return e;
+        }
+    }
+    return 0;
+}
+
+void
+TimerWheel::Shard::addToHash(Entry* entry)
+{
+    if(_hashCount >= _hash.size())
+    {
+        vector<Entry*> hashTable(_hash.size() * 2, static_cast<Entry*>(0));
+        for(vector<Entry*>::const_iterator p = _hash.begin(); p != _hash.end(); ++p)
+        {
+            Entry* e = *p;
+            while(e)
+            {
+                Entry* next = e->hashNext;
+                Entry*& bucket = hashTable[hash(e->task.get()) & (hashTable.size() - 1)];
+                e->hashNext = bucket;
+                bucket = e;
+                e = next;
+            }
+        }
+        _hash.swap(hashTable);
+    }
+
+    Entry*& bucket = _hash[hash(entry->task.get()) & (_hash.size() - 1)];
+    entry->hashNext = bucket;
+    bucket = entry;
+    ++_hashCount;
+}
+
+void
+TimerWheel::Shard::removeFromHash(Entry* entry)
+{
+    Entry** p = &_hash[hash(entry->task.get()) & (_hash.size() - 1)];
+    while(*p != entry)
+    {
+        assert(*p);
+        p = &(*p)->hashNext;
+    }
+    *p = entry->hashNext;
+    entry->hashNext = 0;
+    --_hashCount;
+}
+
+TimerWheel::TimerWheel(int shards, bool hasPriority, int priority) :
+    _destroyed(false)
+{
+    __setNoDelete(true);
+    try
+    {
+        for(int i = 0; i < max(shards, 1); ++i)
+        {
+            ShardPtr shard = new Shard(this);
+            if(hasPriority)
+            {
+                shard->start(0, priority);
+            }
+            else
+            {
+                shard->start();
+            }
+            _shards.push_back(shard);
+        }
+    }
+    catch(...)
+    {
+        destroy();
+        __setNoDelete(false);
+        throw;
+    }
+    __setNoDelete(false);
+}
+
+TimerWheel::~TimerWheel()
+{
+}
+
+void
+TimerWheel::destroy()
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_destroyed)
+        {
+            return;
+        }
+        _destroyed = true;
+    }
+
+    vector<ShardPtr> join;
+    for(vector<ShardPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        if((*p)->destroy())
+        {
+            join.push_back(*p);
+        }
+    }
+    for(vector<ShardPtr>::const_iterator p = join.begin(); p != join.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+void
+TimerWheel::schedule(const TimerTaskPtr& task, const IceUtil::Time& delay)
+{
+    getShard(task)->schedule(task, delay, false);
+}
+
+void
+TimerWheel::scheduleRepeated(const TimerTaskPtr& task, const IceUtil::Time& delay)
+{
+    getShard(task)->schedule(task, delay, true);
+}
+
+bool
+TimerWheel::cancel(const TimerTaskPtr& task)
+{
+    return getShard(task)->cancel(task);
+}
+
+void
+TimerWheel::runTimerTask(const TimerTaskPtr& task)
+{
+    task->runTimerTask();
+}
+
+TimerWheel::Shard*
+TimerWheel::getShard(const TimerTaskPtr& task) const
+{
+    if(_shards.size() == 1)
+    {
+        return _shards[0].get();
+    }
+    size_t h = reinterpret_cast<size_t>(task.get());
+    return _shards[(h ^ (h >> 7)) % _shards.size()].get();
+}
@@ -0,0 +1,82 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_TIMER_WHEEL_H
+#define ICE_TIMER_WHEEL_H
+
+#include <Ice/Config.h>
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The timer of the communicator, it has the same interface as IceUtil::Timer.
+//
+// The tasks are kept in hierarchical timing wheels, scheduling and canceling a
+// task is O(1). The timer can be split into several shards, each with its own
+// wheel, lock and thread. The tasks are spread over the shards, tasks of
+// different shards can execute concurrently.
+//
+class ICE_API TimerWheel : public virtual IceUtil::Shared
+{
+public:
+
+    //
+    // Construct a timer with the given number of shards and start their
+    // execution threads, with the priority if hasPriority is true.
+    //
+    TimerWheel(int shards, bool hasPriority, int priority);
+    virtual ~TimerWheel();
+
+    //
+    // Destroy the timer and detach the execution threads if the calling thread
+    // is a timer thread, join the timer execution threads otherwise.
+    //
+    void destroy();
+
+    //
+    // Schedule a task for execution after a given delay.
+    //
+    void schedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+
+    //
+    // Schedule a task for repeated execution with the given delay
+    // between each execution.
+    //
+    void scheduleRepeated(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+
+    //
+    // Cancel a task. Returns true if the task has not yet run or if
+    // it's a task scheduled for repeated execution. Returns false if
+    // the task has already run, was already cancelled or was never
+    // schedulded.
+    //
+    bool cancel(const IceUtil::TimerTaskPtr&);
+
+protected:
+
+    virtual void runTimerTask(const IceUtil::TimerTaskPtr&);
+
+private:
+
+    class Shard;
+    friend class Shard;
+    typedef IceUtil::Handle<Shard> ShardPtr;
+
+    Shard* getShard(const IceUtil::TimerTaskPtr&) const;
+
+    IceUtil::Mutex _mutex;
+    bool _destroyed;
+    std::vector<ShardPtr> _shards;
+};
+typedef IceUtil::Handle<TimerWheel> TimerWheelPtr;
+
+}
+
+#endif
@@ -62,6 +62,8 @@ getMessageTypeAsString(Byte type)
             return "close connection";
         case validateConnectionMsg:
             return "validate connection";
+        case fragmentMsg:
+            return "fragment";
         default:
             return "unknown";
     }
@@ -176,7 +178,21 @@ printHeader(ostream& s, InputStream& stream)
 
         default:
         {
-            s << "(unknown)";
+            //
+            // Codecs other than bzip2 use the status 2 * codec + 1 and 2 * codec + 2.
+            //
+            if(type == validateConnectionMsg)
+            {
+                s << "(compression codecs mask)";
+            }
+            else if(compress % 2)
+            {
+                s << "(not compressed; compress response with codec " << (compress - 1) / 2 << ", if any)";
+            }
+            else
+            {
+                s << "(compressed with codec " << (compress - 2) / 2 << "; compress response, if any)";
+            }
             break;
         }
     }
@@ -312,6 +328,18 @@ printReply(ostream& s, InputStream& stream)
         break;
     }
 
+    case replyChunk:
+    {
+        s << "(chunk)";
+        break;
+    }
+
+    case replyServerBusy:
+    {
+        s << "(server busy)";
+        break;
+    }
+
     default:
     {
         s << "(unknown)";
@@ -319,7 +347,7 @@ printReply(ostream& s, InputStream& stream)
     }
     }
 
-    if(replyStatus == replyOK || replyStatus == replyUserException)
+    if(replyStatus == replyOK || replyStatus == replyUserException || replyStatus == replyChunk)
     {
         Ice::EncodingVersion v = stream.skipEncapsulation();
         if(v > Ice::Encoding_1_0)
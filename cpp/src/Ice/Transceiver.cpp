@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Transceiver.h>
+#include <Ice/Buffer.h>
 
 using namespace std;
 using namespace Ice;
@@ -16,3 +17,27 @@ IceInternal::Transceiver::bind()
     assert(false);
     return 0;
 }
+
+SocketOperation
+IceInternal::Transceiver::writev(Buffer& buf, const vector<Buffer*>&)
+{
+    return write(buf);
+}
+
+bool
+IceInternal::Transceiver::enableZeroCopy()
+{
+    return false;
+}
+
+Long
+IceInternal::Transceiver::zeroCopySent() const
+{
+    return 0;
+}
+
+Long
+IceInternal::Transceiver::zeroCopyCompleted()
+{
+    return 0;
+}
@@ -11,6 +11,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/Network.h>
 
+#include <vector>
+
 namespace IceInternal
 {
 
@@ -29,6 +31,23 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
     virtual SocketOperation read(Buffer&) = 0;
+
+    //
+    // Write the given buffer followed by as much as possible of the additional buffers.
+    // Transceivers which support scatter-gather output write all the buffers with a single
+    // system call. The default implementation only writes the first buffer.
+    //
+    virtual SocketOperation writev(Buffer&, const std::vector<Buffer*>&);
+
+    //
+    // Once enabled, zero-copy sends might be used to write large buffers. The data of a
+    // buffer written with zero-copy sends must not be modified or released until the
+    // number of completed sends reaches the number of sends issued when the buffer was
+    // written. enableZeroCopy returns false if zero-copy sends are not supported.
+    //
+    virtual bool enableZeroCopy();
+    virtual Ice::Long zeroCopySent() const;
+    virtual Ice::Long zeroCopyCompleted();
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&) = 0;
     virtual void finishWrite(Buffer&) = 0;
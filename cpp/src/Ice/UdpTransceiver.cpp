@@ -29,6 +29,25 @@ using namespace Windows::Networking::Sockets;
 
 IceUtil::Shared* IceInternal::upCast(UdpTransceiver* p) { return p; }
 
+namespace
+{
+
+size_t
+getBatchSize(const ProtocolInstancePtr& instance)
+{
+#if defined(ICE_USE_EPOLL)
+    //
+    // The number of datagrams sent with sendmmsg is limited to UIO_MAXIOV (1024).
+    //
+    Int size = instance->properties()->getPropertyAsIntWithDefault("Ice.UDP.BatchSize", 1);
+    return static_cast<size_t>(size < 1 ? 1 : (size > 1024 ? 1024 : size));
+#else
+    return 1;
+#endif
+}
+
+}
+
 NativeInfoPtr
 IceInternal::UdpTransceiver::getNativeInfo()
 {
@@ -264,6 +283,13 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
 #else
     const size_t packetSize = static_cast<size_t>(min(_maxPacketSize, _rcvSize - _udpOverhead));
 #endif
+#if defined(ICE_USE_EPOLL)
+    if(_batchSize > 1 && _state != StateNeedConnect)
+    {
+        return readBatch(buf, packetSize);
+    }
+#endif
+
     buf.b.resize(packetSize);
     buf.i = buf.b.begin();
 
@@ -355,6 +381,64 @@ repeat:
 #endif
 }
 
+SocketOperation
+IceInternal::UdpTransceiver::writev(Buffer& buf, const vector<Buffer*>& buffers)
+{
+#if defined(ICE_USE_EPOLL)
+    if(_batchSize == 1 || buffers.empty() || buf.i == buf.b.end() || _state != StateConnected)
+    {
+        return write(buf);
+    }
+
+    //
+    // Send the datagrams with a single system call. Each buffer is sent as a separate
+    // datagram.
+    //
+    size_t count = min(buffers.size() + 1, _batchSize);
+    _writeMsgs.resize(count);
+    _writeIovs.resize(count);
+    memset(&_writeMsgs[0], 0, sizeof(struct mmsghdr) * count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        Buffer* b = i == 0 ? &buf : buffers[i - 1];
+        assert(b->i == b->b.begin());
+        _writeIovs[i].iov_base = &b->b[0];
+        _writeIovs[i].iov_len = b->b.size();
+        _writeMsgs[i].msg_hdr.msg_iov = &_writeIovs[i];
+        _writeMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+repeat:
+
+    int ret = ::sendmmsg(_fd, &_writeMsgs[0], static_cast<unsigned int>(count), 0);
+    if(ret == SOCKET_ERROR)
+    {
+        if(interrupted())
+        {
+            goto repeat;
+        }
+
+        if(wouldBlock())
+        {
+            return SocketOperationWrite;
+        }
+
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    assert(ret > 0);
+    for(int i = 0; i < ret; ++i)
+    {
+        Buffer* b = i == 0 ? &buf : buffers[static_cast<size_t>(i - 1)];
+        assert(_writeMsgs[static_cast<size_t>(i)].msg_len == b->b.size());
+        b->i = b->b.end();
+    }
+    return SocketOperationNone;
+#else
+    return write(buf);
+#endif
+}
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -889,7 +973,13 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
     _incoming(false),
     _bound(false),
     _addr(addr),
-    _state(StateNeedConnect)
+    _state(StateNeedConnect),
+    _batchSize(getBatchSize(instance))
+#if defined(ICE_USE_EPOLL)
+    , _readPacketSize(0),
+    _readPos(0),
+    _readCount(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -970,7 +1060,13 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
     _addr(getAddressForServer(host, port, instance->protocolSupport(), instance->preferIPv6(), true)),
     _mcastInterface(mcastInterface),
     _port(port),
-    _state(connect ? StateNeedConnect : StateNotConnected)
+    _state(connect ? StateNeedConnect : StateNotConnected),
+    _batchSize(getBatchSize(instance))
+#if defined(ICE_USE_EPOLL)
+    , _readPacketSize(0),
+    _readPos(0),
+    _readCount(0)
+#endif
 #ifdef ICE_OS_UWP
     , _readPending(false)
 #elif defined(ICE_USE_IOCP)
@@ -1119,6 +1215,91 @@ IceInternal::UdpTransceiver::setBufSize(int rcvSize, int sndSize)
     }
 }
 
+#if defined(ICE_USE_EPOLL)
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(Buffer& buf, size_t packetSize)
+{
+    if(_readPos == _readCount)
+    {
+        //
+        // Receive as many datagrams as possible with a single system call.
+        //
+        if(_readPacketSize != packetSize || _readMsgs.empty())
+        {
+            _readPacketSize = packetSize;
+            _readBuffer.resize(_batchSize * packetSize);
+            _readAddrs.resize(_batchSize);
+            _readMsgs.resize(_batchSize);
+            _readIovs.resize(_batchSize);
+        }
+
+        memset(&_readMsgs[0], 0, sizeof(struct mmsghdr) * _batchSize);
+        for(size_t i = 0; i < _batchSize; ++i)
+        {
+            _readIovs[i].iov_base = &_readBuffer[i * packetSize];
+            _readIovs[i].iov_len = packetSize;
+            _readMsgs[i].msg_hdr.msg_iov = &_readIovs[i];
+            _readMsgs[i].msg_hdr.msg_iovlen = 1;
+            if(_state != StateConnected)
+            {
+                _readMsgs[i].msg_hdr.msg_name = &_readAddrs[i].saStorage;
+                _readMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+            }
+        }
+
+    repeat:
+
+        int ret = ::recvmmsg(_fd, &_readMsgs[0], static_cast<unsigned int>(_batchSize), 0, 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                goto repeat;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationRead;
+            }
+
+            if(connectionLost())
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+        _readPos = 0;
+        _readCount = static_cast<size_t>(ret);
+    }
+
+    size_t i = _readPos++;
+    size_t length = _readMsgs[i].msg_len;
+    buf.b.resize(length);
+    if(length > 0)
+    {
+        memcpy(&buf.b[0], &_readBuffer[i * _readPacketSize], length);
+    }
+    buf.i = buf.b.end();
+    if(_state != StateConnected)
+    {
+        _peerAddr = _readAddrs[i];
+    }
+
+    //
+    // If datagrams are left from the batch, notify the thread pool that the transceiver is
+    // ready for reading, it will read them without waiting for the selector.
+    //
+    if(_readyCallback)
+    {
+        ready(SocketOperationRead, _readPos < _readCount);
+    }
+    return SocketOperationNone;
+}
+#endif
+
 #ifdef ICE_OS_UWP
 void
 IceInternal::UdpTransceiver::appendMessage(DatagramSocketMessageReceivedEventArgs^ args)
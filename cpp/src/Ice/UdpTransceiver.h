@@ -15,6 +15,10 @@
 #   include <deque>
 #endif
 
+#if defined(ICE_USE_EPOLL)
+#   include <sys/uio.h>
+#endif
+
 namespace IceInternal
 {
 
@@ -43,6 +47,7 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+    virtual SocketOperation writev(Buffer&, const std::vector<Buffer*>&);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -67,6 +72,9 @@ private:
     virtual ~UdpTransceiver();
 
     void setBufSize(int, int);
+#if defined(ICE_USE_EPOLL)
+    SocketOperation readBatch(Buffer&, size_t);
+#endif
 
 #ifdef ICE_OS_UWP
     void appendMessage(Windows::Networking::Sockets::DatagramSocketMessageReceivedEventArgs^);
@@ -99,6 +107,23 @@ private:
     static const int _udpOverhead;
     static const int _maxPacketSize;
 
+    //
+    // With batching enabled, up to _batchSize datagrams are received or sent with a single
+    // system call. The received datagrams are stored in _readBuffer until they are read.
+    //
+    const size_t _batchSize;
+#if defined(ICE_USE_EPOLL)
+    std::vector<Ice::Byte> _readBuffer;
+    std::vector<Address> _readAddrs;
+    std::vector<struct mmsghdr> _readMsgs;
+    std::vector<struct iovec> _readIovs;
+    size_t _readPacketSize;
+    size_t _readPos;
+    size_t _readCount;
+    std::vector<struct mmsghdr> _writeMsgs;
+    std::vector<struct iovec> _writeIovs;
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
     AsyncInfo _write;
@@ -208,6 +208,12 @@ IceInternal::WSEndpoint::compress(bool compress) const
     }
 }
 
+std::string
+IceInternal::WSEndpoint::compressionCodec() const
+{
+    return _delegate->compressionCodec();
+}
+
 bool
 IceInternal::WSEndpoint::datagram() const
 {
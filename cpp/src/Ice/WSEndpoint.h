@@ -38,6 +38,7 @@ public:
     virtual EndpointIPtr connectionId(const ::std::string&) const;
     virtual bool compress() const;
     virtual EndpointIPtr compress(bool) const;
+    virtual std::string compressionCodec() const;
     virtual bool datagram() const;
     virtual bool secure() const;
 
@@ -131,6 +131,12 @@ IceSSL::EndpointI::compress(bool compress) const
     }
 }
 
+std::string
+IceSSL::EndpointI::compressionCodec() const
+{
+    return _delegate->compressionCodec();
+}
+
 bool
 IceSSL::EndpointI::datagram() const
 {
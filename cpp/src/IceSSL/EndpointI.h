@@ -37,6 +37,7 @@ public:
     virtual IceInternal::EndpointIPtr connectionId(const ::std::string&) const;
     virtual bool compress() const;
     virtual IceInternal::EndpointIPtr compress(bool) const;
+    virtual std::string compressionCodec() const;
     virtual bool datagram() const;
     virtual bool secure() const;
 
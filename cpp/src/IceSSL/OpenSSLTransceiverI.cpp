@@ -908,6 +908,17 @@ OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
     _maxSendPacketSize(0),
     _maxRecvPacketSize(0)
 {
+#if defined(ICE_USE_IO_URING)
+    //
+    // OpenSSL reads the socket directly, its data can't be received by the io_uring selector
+    // backend.
+    //
+    IceInternal::NativeInfoPtr nativeInfo = _delegate->getNativeInfo();
+    if(nativeInfo)
+    {
+        nativeInfo->disableReceive();
+    }
+#endif
 }
 
 OpenSSL::TransceiverI::~TransceiverI()
@@ -902,6 +902,10 @@ Slice::Gen::generate(const UnitPtr& p)
         {
             H << "\n#include <Ice/IncomingAsync.h>";
         }
+        if(p->hasContentsWithMetaData("cpp:coroutine"))
+        {
+            H << "\n#include <Ice/Coroutine.h>";
+        }
         C << "\n#include <Ice/LocalException.h>";
         C << "\n#include <Ice/ValueFactory.h>";
         C << "\n#include <Ice/OutgoingAsync.h>";
@@ -2432,24 +2436,33 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     const string cookieDoc = "@param " + cookieParam + " User-defined data to associate with the invocation.";
     const string cookieDecl = "const ::Ice::LocalObjectPtr& " + cookieParam + " = 0";
 
+    //
+    // The result of an operation with the cpp:stream metadata is only available
+    // with the asynchronous mapping, the chunks are read with next_.
+    //
+    const bool stream = p->hasMetaData("cpp:stream");
+
     const string deprecateSymbol = getDeprecateSymbol(p, cl);
-    H << sp;
-    if(comment)
-    {
-        StringList postParams;
-        postParams.push_back(contextDoc);
-        writeOpDocSummary(H, p, comment, OpDocAllParams, true, StringList(), postParams, comment->returns());
-    }
-    H << nl << deprecateSymbol << _dllMemberExport << retS << ' ' << fixKwd(name) << spar << paramsDecl
-      << contextDecl << epar;
-    H << sb << nl;
-    if(ret)
+    if(!stream)
     {
-        H << "return ";
+        H << sp;
+        if(comment)
+        {
+            StringList postParams;
+            postParams.push_back(contextDoc);
+            writeOpDocSummary(H, p, comment, OpDocAllParams, true, StringList(), postParams, comment->returns());
+        }
+        H << nl << deprecateSymbol << _dllMemberExport << retS << ' ' << fixKwd(name) << spar << paramsDecl
+          << contextDecl << epar;
+        H << sb << nl;
+        if(ret)
+        {
+            H << "return ";
+        }
+        H << "end_" << name << spar << outParamNamesAMI << "_iceI_begin_" + name << spar << argsAMI;
+        H << contextParam << "::IceInternal::dummyCallback" << "0" << "true" << epar << epar << ';';
+        H << eb;
     }
-    H << "end_" << name << spar << outParamNamesAMI << "_iceI_begin_" + name << spar << argsAMI;
-    H << contextParam << "::IceInternal::dummyCallback" << "0" << "true" << epar << epar << ';';
-    H << eb;
 
     H << sp;
     if(comment)
@@ -2566,6 +2579,24 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
         H << "const ::Ice::AsyncResultPtr&" << epar << ';';
         H << nl << "/// \\endcond";
     }
+    if(stream)
+    {
+        H << sp;
+        if(comment)
+        {
+            H << nl << "/**";
+            H << nl << " * Reads the next chunk of the result of begin_" << name << ", waiting for it to be received.";
+            H << nl << " * @param chunk The chunk.";
+            H << nl << " * @param " << resultParam << " " << resultDoc;
+            H << nl << " * @return False if there are no more chunks, end_" << name
+              << " must then be called to obtain the last part of the result.";
+            H << nl << " */";
+        }
+        H << nl << _dllMemberExport << "bool next_" << name << spar << outputTypeToString(ret, false, "",
+                                                                                        p->getMetaData(),
+                                                                                        _useWstring) + " chunk"
+          << "const ::Ice::AsyncResultPtr& " + resultParam << epar << ';';
+    }
 
     H.dec();
     H << nl;
@@ -2592,6 +2623,10 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     }
     C << nl << "::IceInternal::OutgoingAsyncPtr result = new ::IceInternal::CallbackOutgoing(this, " << flatName
         << ", del, cookie, sync);";
+    if(stream)
+    {
+        C << nl << "result->requestChunks();";
+    }
     C << nl << "try";
     C << sb;
     C << nl << "result->prepare(" << flatName << ", " << operationModeToString(p->sendMode()) << ", context);";
@@ -2686,6 +2721,26 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     }
     C << eb;
 
+    if(stream)
+    {
+        C << sp << nl << "bool" << nl << "IceProxy" << scope << "next_" << name << spar
+          << outputTypeToString(ret, false, "", p->getMetaData(), _useWstring) + " chunk"
+          << "const ::Ice::AsyncResultPtr& result" << epar;
+        C << sb;
+        C << nl << "::Ice::AsyncResult::_check(result, this, " << flatName << ");";
+        C << nl << "::IceInternal::OutgoingAsyncBase* outAsync = "
+          << "static_cast< ::IceInternal::OutgoingAsyncBase*>(result.get());";
+        C << nl << "::Ice::InputStream* istr = outAsync->_startReadChunk();";
+        C << nl << "if(!istr)";
+        C << sb;
+        C << nl << "return false;";
+        C << eb;
+        C << nl << "istr->read(chunk);";
+        C << nl << "outAsync->_endReadChunk();";
+        C << nl << "return true;";
+        C << eb;
+    }
+
     if(generatePrivateEnd)
     {
         assert(p->returnsData());
@@ -5028,6 +5083,20 @@ Slice::Gen::AsyncVisitor::visitOperation(const OperationPtr& p)
     }
     H << nl << " */";
     H << nl << "virtual void ice_response" << spar << paramsAMD << epar << " = 0;";
+    if(p->hasMetaData("cpp:stream"))
+    {
+        H << sp;
+        H << nl << "/**";
+        H << nl << " * Call ice_chunk to send a chunk of the result before calling ice_response. This doesn't";
+        H << nl << " * wait, the chunk is queued and the next chunk should only be sent once ready is called";
+        H << nl << " * if too many chunks are queued for sending.";
+        H << nl << " * @param chunk The chunk.";
+        H << nl << " * @param ready The callback called once the next chunk can be sent if this method returns";
+        H << nl << " * false, it might be called before this method returns.";
+        H << nl << " * @return True if the next chunk can be sent right away, false otherwise.";
+        H << nl << " */";
+        H << nl << "virtual bool ice_chunk(" << retS << " chunk, const ::Ice::ChunkReadyCallbackPtr& ready) = 0;";
+    }
     H << eb << ';';
     H << sp << nl << "typedef ::IceUtil::Handle< " << classScopedAMD << '_' << name << "> "
       << classNameAMD << '_' << name  << "Ptr;";
@@ -5178,6 +5247,10 @@ Slice::Gen::AsyncImplVisitor::visitOperation(const OperationPtr& p)
 
     H << sp;
     H << nl << "virtual void ice_response(" << params << ");";
+    if(p->hasMetaData("cpp:stream"))
+    {
+        H << nl << "virtual bool ice_chunk(" << params << ", const ::Ice::ChunkReadyCallbackPtr&);";
+    }
     H << eb << ';';
 
     H.zeroIndent();
@@ -5216,6 +5289,18 @@ Slice::Gen::AsyncImplVisitor::visitOperation(const OperationPtr& p)
     }
     C << nl << "completed();";
     C << eb;
+
+    if(p->hasMetaData("cpp:stream"))
+    {
+        C << sp << nl << "bool";
+        C << nl << "IceAsync" << classScopedAMD << '_' << name << "::ice_chunk(" << paramsDecl
+          << ", const ::Ice::ChunkReadyCallbackPtr& ready)";
+        C << sb;
+        C << nl << "::Ice::OutputStream* ostr = startWriteChunk();";
+        writeMarshalCode(C, ParamDeclList(), p, false, TypeContextInParam);
+        C << nl << "return endWriteChunk(ready);";
+        C << eb;
+    }
     C << nl << "/// \\endcond";
 }
 
@@ -5551,6 +5636,82 @@ Slice::Gen::MetaDataVisitor::visitOperation(const OperationPtr& p)
         metaData = validate(returnType, metaData, p->file(), p->line(), true);
     }
 
+    if(find(metaData.begin(), metaData.end(), "cpp:stream") != metaData.end())
+    {
+        //
+        // The chunks of a streamed result are sequences of the return type, which are
+        // sent with AMD before the response.
+        //
+        string reason;
+        if(cl->isLocal())
+        {
+            reason = "local operation";
+        }
+        else if(!SequencePtr::dynamicCast(returnType) || p->returnIsOptional())
+        {
+            reason = "operation which doesn't return a sequence";
+        }
+        else if(!p->outParameters().empty())
+        {
+            reason = "operation with out parameters";
+        }
+        else if(p->hasMarshaledResult() || p->returnsClasses(false))
+        {
+            reason = "operation with marshaled result or returning classes";
+        }
+        else
+        {
+            for(StringList::const_iterator q = metaData.begin(); q != metaData.end(); ++q)
+            {
+                if(*q == "cpp:array" || q->find("cpp:range") == 0 || q->find("cpp:view-type:") == 0)
+                {
+                    reason = "operation with `" + *q + "' return type";
+                }
+            }
+        }
+
+        if(!reason.empty())
+        {
+            dc->warning(InvalidMetaData, p->file(), p->line(), "ignoring metadata `cpp:stream' for " + reason);
+            metaData.remove("cpp:stream");
+        }
+        else if(!cl->hasMetaData("amd") && find(metaData.begin(), metaData.end(), "amd") == metaData.end())
+        {
+            metaData.push_back("amd");
+        }
+    }
+
+    if(find(metaData.begin(), metaData.end(), "cpp:coroutine") != metaData.end())
+    {
+        //
+        // Servants implement an operation with the cpp:coroutine metadata with a
+        // coroutine, it's dispatched with AMD.
+        //
+        string reason;
+        if(cl->isLocal())
+        {
+            reason = "local operation";
+        }
+        else if(find(metaData.begin(), metaData.end(), "cpp:stream") != metaData.end())
+        {
+            reason = "operation with streamed result";
+        }
+        else if(p->hasMarshaledResult())
+        {
+            reason = "operation with marshaled result";
+        }
+
+        if(!reason.empty())
+        {
+            dc->warning(InvalidMetaData, p->file(), p->line(), "ignoring metadata `cpp:coroutine' for " + reason);
+            metaData.remove("cpp:coroutine");
+        }
+        else if(!cl->hasMetaData("amd") && find(metaData.begin(), metaData.end(), "amd") == metaData.end())
+        {
+            metaData.push_back("amd");
+        }
+    }
+
     p->setMetaData(metaData);
 
     ParamDeclList params = p->parameters();
@@ -5631,7 +5792,7 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
             cpp11 = true;
         }
 
-        if(operation && (s == "cpp:const" || s == "cpp:noexcept"))
+        if(operation && (s == "cpp:const" || s == "cpp:noexcept" || s == "cpp:stream" || s == "cpp:coroutine"))
         {
             continue;
         }
@@ -6959,89 +7120,132 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     const string futureDoc = "The future object for the invocation.";
 
     //
-    // Synchronous operation
+    // The result of an operation with the cpp:stream metadata is only available
+    // with the lambda based asynchronous mapping, the chunks are passed to the
+    // chunk callback.
     //
-    H << sp;
-    if(comment)
-    {
-        StringList postParams;
-        postParams.push_back(contextDoc);
-        writeOpDocSummary(H, p, comment, OpDocAllParams, true, StringList(), postParams, comment->returns());
-    }
-    H << nl << deprecateSymbol << retS << ' ' << fixKwd(name) << spar << paramsDecl << contextDecl << epar;
-    H << sb;
-    H << nl;
-    if(futureOutParams.size() == 1)
+    const bool stream = p->hasMetaData("cpp:stream");
+
+    if(!stream)
     {
-        if(ret)
+        //
+        // Synchronous operation
+        //
+        H << sp;
+        if(comment)
         {
-            H << "return ";
+            StringList postParams;
+            postParams.push_back(contextDoc);
+            writeOpDocSummary(H, p, comment, OpDocAllParams, true, StringList(), postParams, comment->returns());
         }
-        else
+        H << nl << deprecateSymbol << retS << ' ' << fixKwd(name) << spar << paramsDecl << contextDecl << epar;
+        H << sb;
+        H << nl;
+        if(futureOutParams.size() == 1)
+        {
+            if(ret)
+            {
+                H << "return ";
+            }
+            else
+            {
+                H << fixKwd((*outParams.begin())->name()) << " = ";
+            }
+        }
+        else if(futureOutParams.size() > 1)
         {
-            H << fixKwd((*outParams.begin())->name()) << " = ";
+            H << "auto _result = ";
         }
-    }
-    else if(futureOutParams.size() > 1)
-    {
-        H << "auto _result = ";
-    }
 
-    H << "_makePromiseOutgoing<" << futureT << ">";
+        H << "_makePromiseOutgoing<" << futureT << ">";
 
-    H << spar << "true, this" << "&" + cl->name() + "Prx::_iceI_" + name;
-    for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
-    {
-        H << fixKwd((*q)->name());
-    }
-    H << contextParam << epar << ".get();";
-    if(futureOutParams.size() > 1)
-    {
-        for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
+        H << spar << "true, this" << "&" + cl->name() + "Prx::_iceI_" + name;
+        for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
         {
-            H << nl << fixKwd((*q)->name()) << " = ";
-            H << condMove(isMovable((*q)->type()), "_result." + fixKwd((*q)->name())) + ";";
+            H << fixKwd((*q)->name());
         }
-        if(ret)
+        H << contextParam << epar << ".get();";
+        if(futureOutParams.size() > 1)
         {
-            H << nl << "return " + condMove(isMovable(ret), "_result." + returnValueS) + ";";
+            for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
+            {
+                H << nl << fixKwd((*q)->name()) << " = ";
+                H << condMove(isMovable((*q)->type()), "_result." + fixKwd((*q)->name())) + ";";
+            }
+            if(ret)
+            {
+                H << nl << "return " + condMove(isMovable(ret), "_result." + returnValueS) + ";";
+            }
         }
-    }
-    H << eb;
+        H << eb;
 
-    //
-    // Promise based asynchronous operation
-    //
-    H << sp;
-    if(comment)
-    {
-        StringList postParams, returns;
-        postParams.push_back(contextDoc);
-        returns.push_back(futureDoc);
-        writeOpDocSummary(H, p, comment, OpDocInParams, false, StringList(), postParams, returns);
-    }
-    H << nl << "template<template<typename> class P = ::std::promise>";
-    H << nl << deprecateSymbol << "auto " << name << "Async" << spar << inParamsDecl << contextDecl << epar;
-    H.inc();
-    H << nl << "-> decltype(::std::declval<P<" << futureT << ">>().get_future())";
-    H.dec();
-    H << sb;
+        //
+        // Promise based asynchronous operation
+        //
+        H << sp;
+        if(comment)
+        {
+            StringList postParams, returns;
+            postParams.push_back(contextDoc);
+            returns.push_back(futureDoc);
+            writeOpDocSummary(H, p, comment, OpDocInParams, false, StringList(), postParams, returns);
+        }
+        H << nl << "template<template<typename> class P = ::std::promise>";
+        H << nl << deprecateSymbol << "auto " << name << "Async" << spar << inParamsDecl << contextDecl << epar;
+        H.inc();
+        H << nl << "-> decltype(::std::declval<P<" << futureT << ">>().get_future())";
+        H.dec();
+        H << sb;
 
-    H << nl << "return _makePromiseOutgoing<" << futureT << ", P>" << spar;
+        H << nl << "return _makePromiseOutgoing<" << futureT << ", P>" << spar;
 
-    H << "false, this" << string("&" + cl->name() + "Prx::_iceI_" + name);
-    for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
+        H << "false, this" << string("&" + cl->name() + "Prx::_iceI_" + name);
+        for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
+        {
+            H << fixKwd((*q)->name());
+        }
+        H << contextParam << epar << ";";
+        H << eb;
+    }
+
+    if(p->hasMetaData("cpp:coroutine"))
     {
-        H << fixKwd((*q)->name());
+        //
+        // Coroutine based asynchronous operation
+        //
+        H << sp;
+        H.zeroIndent();
+        H << nl << "#ifdef ICE_HAS_COROUTINES";
+        H.restoreIndent();
+        if(comment)
+        {
+            StringList postParams, returns;
+            postParams.push_back(contextDoc);
+            returns.push_back("The awaitable for the invocation, co_await returns the result of the invocation.");
+            writeOpDocSummary(H, p, comment, OpDocInParams, false, StringList(), postParams, returns);
+        }
+        H << nl << deprecateSymbol << "::Ice::Awaitable<" << futureT << "> " << name << "Coro" << spar << inParamsDecl
+          << contextDecl << epar;
+        H << sb;
+        H << nl << "return ::IceInternal::makeAwaitable<" << futureT << ">" << spar;
+        H << "this" << string("&" + cl->name() + "Prx::_iceI_" + name);
+        for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
+        {
+            H << fixKwd((*q)->name());
+        }
+        H << contextParam << epar << ";";
+        H << eb;
+        H.zeroIndent();
+        H << nl << "#endif";
+        H.restoreIndent();
     }
-    H << contextParam << epar << ";";
-    H << eb;
 
     //
     // Lambda based asynchronous operation
     //
     bool lambdaCustomOut = (lambdaOutParams != futureOutParams);
 
+    const string chunkParam = escapeParam(inParams, "chunk");
     const string responseParam = escapeParam(inParams, "response");
     const string exParam = escapeParam(inParams, "ex");
     const string sentParam = escapeParam(inParams, "sent");
@@ -7050,6 +7254,11 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     if(comment)
     {
         StringList postParams, returns;
+        if(stream)
+        {
+            postParams.push_back("@param " + chunkParam + " The callback for the chunks of the result, which are "
+                                 "received before the response.");
+        }
         postParams.push_back("@param " + responseParam + " The response callback.");
         postParams.push_back("@param " + exParam + " The exception callback.");
         postParams.push_back("@param " + sentParam + " The sent callback.");
@@ -7079,6 +7288,11 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
         H << nl;
     }
 
+    if(stream)
+    {
+        H << "::std::function<void" << spar << lambdaOutParams << epar << "> " << chunkParam << ",";
+        H << nl;
+    }
     H << "::std::function<void" << spar << lambdaOutParams << epar << "> " << responseParam << ",";
     H << nl << "::std::function<void(::std::exception_ptr)> " << exParam << " = nullptr,";
     H << nl << "::std::function<void(bool)> " << sentParam << " = nullptr,";
@@ -7192,7 +7406,15 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
             H << epar << ";" << eb << ";";
         }
 
-        H << nl << "return _makeLamdaOutgoing<" << futureT << ">" << spar;
+        if(stream)
+        {
+            H << nl << "return _makeLamdaStreamOutgoing<" << futureT << ">" << spar;
+            H << "std::move(" + chunkParam + ")";
+        }
+        else
+        {
+            H << nl << "return _makeLamdaOutgoing<" << futureT << ">" << spar;
+        }
 
         H << "std::move(" + (futureOutParams.size() > 1 ? "_responseCb" : responseParam) + ")"
           << "std::move(" + exParam + ")"
@@ -8123,6 +8345,9 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     vector<string> params;
     vector<string> args;
 
+    vector<string> coroutineParams;
+    vector<string> coroutineArgs;
+
     vector<string> responseParams;
     vector<string> responseParamsDecl;
     vector<string> responseParamsImplDecl;
@@ -8140,8 +8365,11 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     ParamDeclList paramList = p->parameters();
 
     const bool amd = (cl->hasMetaData("amd") || p->hasMetaData("amd"));
+    const bool stream = p->hasMetaData("cpp:stream");
+    const bool coroutine = p->hasMetaData("cpp:coroutine");
 
     const string returnValueParam = escapeParam(outParams, "returnValue");
+    const string chunkcbParam = escapeParam(inParams, "chunk");
     const string responsecbParam = escapeParam(inParams, "response");
     const string excbParam = escapeParam(inParams, "exception");
     const string currentParam = escapeParam(amd ? inParams : paramList, "current");
@@ -8150,10 +8378,12 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
 
     CommentPtr comment = p->parseComment(false);
 
+    string retInS;
     if(ret)
     {
         string typeS = inputTypeToString(ret, p->returnIsOptional(), classScope, p->getMetaData(),
                                          _useWstring | TypeContextCpp11);
+        retInS = typeS;
         responseParams.push_back(typeS + " " + returnValueParam);
         responseParamsDecl.push_back(typeS + " ret");
         responseParamsImplDecl.push_back(typeS + " ret");
@@ -8187,6 +8417,8 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
             params.push_back(typeToString(type, (*q)->optional(), classScope, (*q)->getMetaData(),
                                           typeCtx | TypeContextInParam) + " " + paramName);
             args.push_back(condMove(isMovable(type) && !isOutParam, paramPrefix + (*q)->name()));
+            coroutineParams.push_back(params.back());
+            coroutineArgs.push_back(args.back());
         }
         else
         {
@@ -8215,6 +8447,11 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
         }
         else
         {
+            if(stream)
+            {
+                params.push_back("::std::function<bool(" + retInS + ", ::Ice::ChunkReadyCallback)> " + chunkcbParam);
+                args.push_back("chunkCB");
+            }
             params.push_back("::std::function<void(" + joinString(responseParams, ", ") + ")> " + responsecbParam);
             args.push_back(ret || !outParams.empty() ? "responseCB" : "inA->response()");
         }
@@ -8224,6 +8461,37 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     params.push_back(currentDecl);
     args.push_back("current");
 
+    //
+    // The coroutine takes the Current object by value, it must remain valid once
+    // the coroutine is suspended.
+    //
+    coroutineParams.push_back(getUnqualified("::Ice::Current", classScope) + " " + currentParam);
+    coroutineArgs.push_back("current");
+
+    string taskT;
+    if(coroutine)
+    {
+        if(!ret && outParams.empty())
+        {
+            taskT = "void";
+        }
+        else if(ret && outParams.empty())
+        {
+            taskT = typeToString(ret, p->returnIsOptional(), classScope, p->getMetaData(),
+                                 _useWstring | TypeContextCpp11);
+        }
+        else if(!ret && outParams.size() == 1)
+        {
+            ParamDeclPtr param = outParams.front();
+            taskT = typeToString(param->type(), param->optional(), classScope, param->getMetaData(),
+                                 _useWstring | TypeContextCpp11);
+        }
+        else
+        {
+            taskT = resultStructName(name, fixKwd(cl->name()));
+        }
+    }
+
     if(cl->isInterface())
     {
         emitOpNameResult(H, p, _useWstring);
@@ -8288,12 +8556,37 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     string deprecateSymbol = getDeprecateSymbol(p, cl);
 
     H << sp;
+    if(coroutine)
+    {
+        H.zeroIndent();
+        H << nl << "#ifdef ICE_HAS_COROUTINES";
+        H.restoreIndent();
+        if(comment)
+        {
+            StringList postParams, returns;
+            postParams.push_back("@param " + currentParam + " The Current object for the invocation.");
+            returns.push_back("The task of the coroutine, the response is sent once the coroutine returns.");
+            writeOpDocSummary(H, p, comment, OpDocInParams, true, StringList(), postParams, returns);
+        }
+        H << nl << deprecateSymbol << "virtual " << getUnqualified("::Ice::Task", classScope) << "<" << taskT << "> "
+          << opName << spar << coroutineParams << epar << isConst << " = 0;";
+        H.zeroIndent();
+        H << nl << "#else";
+        H.restoreIndent();
+    }
     if(comment)
     {
         OpDocParamType pt = (amd || p->hasMarshaledResult()) ? OpDocInParams : OpDocAllParams;
         StringList postParams, returns;
         if(amd)
         {
+            if(stream)
+            {
+                postParams.push_back("@param " + chunkcbParam + " The callback to send a chunk of the result before "
+                                     "the response. It doesn't wait, it returns false if too many chunks are "
+                                     "queued for sending and the next chunk should only be sent once the ready "
+                                     "callback is called.");
+            }
             postParams.push_back("@param " + responsecbParam + " The response callback.");
             postParams.push_back("@param " + excbParam + " The exception callback.");
         }
@@ -8309,6 +8602,12 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
         writeOpDocSummary(H, p, comment, pt, true, StringList(), postParams, returns);
     }
     H << nl << deprecateSymbol << "virtual " << retS << ' ' << opName << spar << params << epar << isConst << " = 0;";
+    if(coroutine)
+    {
+        H.zeroIndent();
+        H << nl << "#endif";
+        H.restoreIndent();
+    }
     H << nl << "/// \\cond INTERNAL";
     H << nl << "bool _iceD_" << name << "(::IceInternal::Incoming&, const "
       << getUnqualified("::Ice::Current&", classScope) << ")" << isConst << ';';
@@ -8405,7 +8704,68 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
             C << nl << "inA->completed();";
             C << eb << ';';
         }
+        if(stream)
+        {
+            C << nl << "auto chunkCB = [inA]" << spar << responseParamsDecl << "::Ice::ChunkReadyCallback ready" << epar;
+            C << sb;
+            C << nl << "auto ostr = inA->startWriteChunk();";
+            writeMarshalCode(C, outParams, p, true, TypeContextCpp11);
+            C << nl << "return inA->endWriteChunk(ready);";
+            C << eb << ';';
+        }
+        if(coroutine)
+        {
+            C.zeroIndent();
+            C << nl << "#ifdef ICE_HAS_COROUTINES";
+            C.restoreIndent();
+            string taskResponse;
+            if(!ret && outParams.empty())
+            {
+                taskResponse = "inA->response()";
+            }
+            else if(outParams.size() + (ret ? 1 : 0) == 1)
+            {
+                taskResponse = "responseCB";
+            }
+            else
+            {
+                string returnValueS = "returnValue";
+                for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
+                {
+                    if((*q)->name() == "returnValue")
+                    {
+                        returnValueS = "_returnValue";
+                    }
+                }
+
+                taskResponse = "taskResponseCB";
+                C << nl << "auto taskResponseCB = [responseCB](" << taskT << "&& result)";
+                C << sb;
+                C << nl << "responseCB" << spar;
+                if(ret)
+                {
+                    C << "result." + returnValueS;
+                }
+                for(ParamDeclList::const_iterator q = outParams.begin(); q != outParams.end(); ++q)
+                {
+                    C << "result." + fixKwd((*q)->name());
+                }
+                C << epar << ";";
+                C << eb << ';';
+            }
+            C << nl << "this->" << opName << spar << coroutineArgs << epar << "._start(" << taskResponse
+              << ", inA->exception());";
+            C.zeroIndent();
+            C << nl << "#else";
+            C.restoreIndent();
+        }
         C << nl << "this->" << opName << spar << args << epar << ';';
+        if(coroutine)
+        {
+            C.zeroIndent();
+            C << nl << "#endif";
+            C.restoreIndent();
+        }
         C << nl << "return false;";
     }
     C << eb;
@@ -9218,6 +9578,10 @@ Slice::Gen::Cpp11ImplVisitor::visitClassDefStart(const ClassDefPtr& p)
 
             string isConst = ((op->mode() == Operation::Nonmutating) || op->hasMetaData("cpp:const")) ? " const" : "";
 
+            if(op->hasMetaData("cpp:stream"))
+            {
+                H << "std::function<bool(" << responseParams << ", Ice::ChunkReadyCallback)>," << nl;
+            }
             H << "std::function<void(" << responseParams << ")>,";
             H << nl << "std::function<void(std::exception_ptr)>,";
             H << nl << "const Ice::Current&)" << isConst << " override;";
@@ -9232,6 +9596,10 @@ Slice::Gen::Cpp11ImplVisitor::visitClassDefStart(const ClassDefPtr& p)
                 C << ' ' << fixKwd((*q)->name()) << "," << nl;
             }
 
+            if(op->hasMetaData("cpp:stream"))
+            {
+                C << "std::function<bool(" << responseParams << ", Ice::ChunkReadyCallback)>," << nl;
+            }
             C << "std::function<void(" << responseParams << ")> " << opName << "_response,";
             C << nl << "std::function<void(std::exception_ptr)>,";
             C << nl << "const Ice::Current& current)" << isConst;
@@ -7,6 +7,11 @@
 #include <TestHelper.h>
 #include <Test.h>
 
+#ifdef ICE_CPP11_MAPPING
+#   include <atomic>
+#   include <thread>
+#endif
+
 using namespace std;
 
 namespace
@@ -915,6 +920,81 @@ private:
 typedef IceUtil::Handle<Thrower> ThrowerPtr;
 #endif
 
+#ifdef ICE_HAS_COROUTINES
+//
+// Coroutine started by the test, it runs until its first co_await and is then resumed
+// by the threads completing the invocations.
+//
+struct DetachedCoroutine
+{
+    struct promise_type
+    {
+        DetachedCoroutine get_return_object()
+        {
+            return DetachedCoroutine();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+
+DetachedCoroutine
+fanOut(Test::TestIntfPrxPtr p, int count, promise<int>& result)
+{
+    try
+    {
+        //
+        // All the invocations are sent before the coroutine suspends.
+        //
+        vector<Ice::Awaitable<Test::TestIntf::OpWithCoroutineResult>> calls;
+        for(int i = 0; i < count; ++i)
+        {
+            calls.push_back(p->opWithCoroutineCoro(i));
+        }
+
+        int sum = 0;
+        for(int i = 0; i < count; ++i)
+        {
+            auto r = co_await calls[i];
+            test(r.returnValue == i && r.j == i * 2);
+            sum += r.returnValue;
+        }
+
+        try
+        {
+            co_await p->opWithCoroutineCoro(-1);
+            test(false);
+        }
+        catch(const Test::TestIntfException&)
+        {
+        }
+
+        result.set_value(sum);
+    }
+    catch(...)
+    {
+        result.set_exception(current_exception());
+    }
+}
+#endif
+
 }
 
 void
@@ -2236,6 +2316,167 @@ allTests(Test::TestHelper* helper, bool collocated)
         }
         cout << "ok" << endl;
 
+        cout << "testing many outstanding requests... " << flush;
+        {
+            if(p->ice_getConnection())
+            {
+                testController->holdAdapter();
+                vector<future<int>> results;
+                vector<function<void()>> cancels;
+                for(int i = 0; i < 1000; ++i)
+                {
+                    auto r = make_shared<promise<int>>();
+                    results.push_back(r->get_future());
+                    cancels.push_back(p->opWithResultAsync(
+                        [r](int v)
+                        {
+                            r->set_value(v);
+                        },
+                        [r](exception_ptr ex)
+                        {
+                            r->set_exception(ex);
+                        }));
+                }
+                for(int i = 0; i < 1000; i += 3)
+                {
+                    cancels[i]();
+                }
+                testController->resumeAdapter();
+
+                for(int i = 0; i < 1000; ++i)
+                {
+                    try
+                    {
+                        test(results[i].get() == 15);
+                        test(i % 3 != 0);
+                    }
+                    catch(const Ice::InvocationCanceledException&)
+                    {
+                        test(i % 3 == 0);
+                    }
+                }
+            }
+        }
+        cout << "ok" << endl;
+
+        if(p->ice_getConnection() && protocol != "bt")
+        {
+            cout << "testing send queue limits... " << flush;
+            {
+                //
+                // The server doesn't read the connection while the adapter is on hold, the requests
+                // are queued by the client once the socket buffers are full.
+                //
+                Ice::ByteSeq seq(512 * 1024);
+
+                Ice::InitializationData initData;
+                initData.properties = communicator->getProperties()->clone();
+                initData.properties->setProperty("Ice.SendQueueLengthMax", "5");
+                initData.properties->setProperty("Ice.SendQueueWait", "0");
+                Ice::CommunicatorHolder ich(initData);
+                auto q = Ice::uncheckedCast<Test::TestIntfPrx>(ich->stringToProxy(p->ice_toString()));
+                q->ice_ping();
+
+                testController->holdAdapter();
+                vector<future<void>> results;
+                for(int i = 0; i < 50; ++i)
+                {
+                    results.push_back(q->opWithPayloadAsync(seq));
+                }
+                testController->resumeAdapter();
+
+                int succeeded = 0;
+                int failed = 0;
+                for(auto& r : results)
+                {
+                    try
+                    {
+                        r.get();
+                        ++succeeded;
+                    }
+                    catch(const Ice::SendQueueFullException&)
+                    {
+                        ++failed;
+                    }
+                }
+                test(succeeded >= 5 && failed > 0);
+
+                //
+                // With Ice.SendQueueWait, the invocations wait for the send queue to drain instead
+                // of failing. The connection keeps them, the calling thread doesn't wait.
+                //
+                initData.properties->setProperty("Ice.SendQueueWait", "1");
+                Ice::CommunicatorHolder ich2(initData);
+                q = Ice::uncheckedCast<Test::TestIntfPrx>(ich2->stringToProxy(p->ice_toString()));
+                q->ice_ping();
+
+                testController->holdAdapter();
+                results.clear();
+                for(int i = 0; i < 50; ++i)
+                {
+                    results.push_back(q->opWithPayloadAsync(seq));
+                }
+                test(results.back().wait_for(chrono::milliseconds(200)) == future_status::timeout);
+                testController->resumeAdapter();
+                for(auto& r : results)
+                {
+                    r.get();
+                }
+
+                //
+                // A waiting invocation is removed from the connection once its invocation timeout
+                // expires.
+                //
+                testController->holdAdapter();
+                results.clear();
+                auto t = q->ice_invocationTimeout(500);
+                for(int i = 0; i < 50; ++i)
+                {
+                    results.push_back(t->opWithPayloadAsync(seq));
+                }
+                for(auto& r : results)
+                {
+                    try
+                    {
+                        r.get();
+                        test(false);
+                    }
+                    catch(const Ice::InvocationTimeoutException&)
+                    {
+                    }
+                }
+                testController->resumeAdapter();
+                q->ice_ping();
+
+                //
+                // Requests are compressed without holding the connection lock, the send queue can
+                // drain in the meantime. The compressed requests must still be sent.
+                //
+                Ice::ByteSeq compressible(512 * 1024);
+                for(Ice::ByteSeq::iterator b = compressible.begin(); b != compressible.end(); ++b)
+                {
+                    *b = static_cast<Ice::Byte>(IceUtilInternal::random(16));
+                }
+                initData.properties->setProperty("Ice.SendQueueLengthMax", "0");
+                initData.properties->setProperty("Ice.SendQueueSizeMax", "64");
+                Ice::CommunicatorHolder ich3(initData);
+                q = Ice::uncheckedCast<Test::TestIntfPrx>(ich3->stringToProxy(p->ice_toString()))->ice_compress(true);
+                q->ice_ping();
+
+                results.clear();
+                for(int i = 0; i < 50; ++i)
+                {
+                    results.push_back(q->opWithPayloadAsync(compressible));
+                }
+                for(auto& r : results)
+                {
+                    test(r.wait_for(chrono::seconds(30)) == future_status::ready);
+                    r.get();
+                }
+            }
+            cout << "ok" << endl;
+        }
+
         if(p->ice_getConnection() && protocol != "bt" && p->supportsAMD())
         {
             cout << "testing graceful close connection with wait... " << flush;
@@ -2475,6 +2716,109 @@ allTests(Test::TestHelper* helper, bool collocated)
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing streamed results... " << flush;
+
+        Ice::IntSeq result;
+        int chunks = 0;
+        promise<void> promise;
+        p->opWithStreamAsync(50, 1000,
+                [&result, &chunks](const Ice::IntSeq& chunk)
+                {
+                    test(chunk.size() == 1000);
+                    result.insert(result.end(), chunk.begin(), chunk.end());
+                    ++chunks;
+                },
+                [&result, &promise](const Ice::IntSeq& last)
+                {
+                    result.insert(result.end(), last.begin(), last.end());
+                    promise.set_value();
+                },
+                [&promise](exception_ptr ex)
+                {
+                    promise.set_exception(ex);
+                });
+        promise.get_future().get();
+        test(chunks == 50);
+        test(result.size() == 51 * 1000);
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            test(result[i] == static_cast<int>(i));
+        }
+
+        //
+        // A slow consumer suspends reading the connection until it consumed the chunks.
+        //
+        chunks = 0;
+        std::promise<void> slowPromise;
+        p->opWithStreamAsync(100, 10000,
+                [&chunks](const Ice::IntSeq& chunk)
+                {
+                    test(chunk.size() == 10000 && chunk[0] == chunks * 10000);
+                    ++chunks;
+                    if(chunks % 20 == 0)
+                    {
+                        this_thread::sleep_for(chrono::milliseconds(50));
+                    }
+                },
+                [&chunks, &slowPromise](const Ice::IntSeq& last)
+                {
+                    test(chunks == 100);
+                    test(last.size() == 10000 && last[0] == 100 * 10000);
+                    slowPromise.set_value();
+                },
+                [&slowPromise](exception_ptr ex)
+                {
+                    slowPromise.set_exception(ex);
+                });
+        slowPromise.get_future().get();
+
+        //
+        // A dynamic invocation doesn't request the chunks, the complete result is sent with the response.
+        //
+        Ice::OutputStream out(communicator);
+        out.startEncapsulation();
+        out.write(10);
+        out.write(100);
+        out.endEncapsulation();
+        vector<Ice::Byte> inEncaps;
+        out.finished(inEncaps);
+        vector<Ice::Byte> outEncaps;
+        test(p->ice_invoke("opWithStream", Ice::OperationMode::Normal, inEncaps, outEncaps));
+        Ice::InputStream in(communicator, outEncaps);
+        in.startEncapsulation();
+        in.read(result);
+        in.endEncapsulation();
+        test(result.size() == 11 * 100);
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            test(result[i] == static_cast<int>(i));
+        }
+
+        test(p->opWithResult() == 15);
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing coroutines... " << flush;
+        int j;
+        test(p->opWithCoroutine(5, j) == 5 && j == 10);
+        try
+        {
+            p->opWithCoroutine(-1, j);
+            test(false);
+        }
+        catch(const Test::TestIntfException&)
+        {
+        }
+#ifdef ICE_HAS_COROUTINES
+        promise<int> sum;
+        fanOut(p, 100, sum);
+        test(sum.get_future().get() == 99 * 100 / 2);
+#endif
+        cout << "ok" << endl;
+    }
+
     if(p->ice_getConnection())
     {
         cout << "testing bidir... " << flush;
@@ -3983,6 +4327,83 @@ allTests(Test::TestHelper* helper, bool collocated)
     }
     cout << "ok" << endl;
 
+    cout << "testing many outstanding requests... " << flush;
+    {
+        if(p->ice_getConnection())
+        {
+            testController->holdAdapter();
+            vector<Ice::AsyncResultPtr> results;
+            for(int i = 0; i < 1000; ++i)
+            {
+                results.push_back(p->begin_opWithResult());
+            }
+            for(int i = 0; i < 1000; i += 3)
+            {
+                results[i]->cancel();
+            }
+            testController->resumeAdapter();
+
+            for(int i = 0; i < 1000; ++i)
+            {
+                try
+                {
+                    test(p->end_opWithResult(results[i]) == 15);
+                    test(i % 3 != 0);
+                }
+                catch(const Ice::InvocationCanceledException&)
+                {
+                    test(i % 3 == 0);
+                }
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    if(p->ice_getConnection() && protocol != "bt")
+    {
+        cout << "testing send queue limits... " << flush;
+        {
+            //
+            // The server doesn't read the connection while the adapter is on hold, the requests
+            // are queued by the client once the socket buffers are full.
+            //
+            Ice::ByteSeq seq(512 * 1024);
+
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.SendQueueLengthMax", "5");
+            initData.properties->setProperty("Ice.SendQueueWait", "0");
+            Ice::CommunicatorHolder ich(initData);
+            Test::TestIntfPrx q = Test::TestIntfPrx::uncheckedCast(ich->stringToProxy(p->ice_toString()));
+            q->ice_ping();
+
+            testController->holdAdapter();
+            vector<Ice::AsyncResultPtr> results;
+            for(int i = 0; i < 50; ++i)
+            {
+                results.push_back(q->begin_opWithPayload(seq));
+            }
+            testController->resumeAdapter();
+
+            int succeeded = 0;
+            int failed = 0;
+            for(vector<Ice::AsyncResultPtr>::const_iterator r = results.begin(); r != results.end(); ++r)
+            {
+                try
+                {
+                    q->end_opWithPayload(*r);
+                    ++succeeded;
+                }
+                catch(const Ice::SendQueueFullException&)
+                {
+                    ++failed;
+                }
+            }
+            test(succeeded >= 5 && failed > 0);
+        }
+        cout << "ok" << endl;
+    }
+
     if(p->ice_getConnection() && protocol != "bt")
     {
         cout << "testing graceful close connection with wait... " << flush;
@@ -4158,6 +4579,100 @@ allTests(Test::TestHelper* helper, bool collocated)
         cout << "ok" << endl;
     }
 
+    cout << "testing streamed results... " << flush;
+    {
+        Ice::AsyncResultPtr r = p->begin_opWithStream(50, 1000);
+        Ice::IntSeq result;
+        Ice::IntSeq chunk;
+        int chunks = 0;
+        while(p->next_opWithStream(chunk, r))
+        {
+            test(chunk.size() == 1000);
+            result.insert(result.end(), chunk.begin(), chunk.end());
+            ++chunks;
+        }
+        test(chunks == 50);
+        chunk = p->end_opWithStream(r);
+        result.insert(result.end(), chunk.begin(), chunk.end());
+        test(result.size() == 51 * 1000);
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            test(result[i] == static_cast<int>(i));
+        }
+
+        //
+        // A slow consumer suspends reading the connection until it consumed the chunks.
+        //
+        r = p->begin_opWithStream(100, 10000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        chunks = 0;
+        while(p->next_opWithStream(chunk, r))
+        {
+            test(chunk.size() == 10000 && chunk[0] == chunks * 10000);
+            ++chunks;
+        }
+        test(chunks == 100);
+        chunk = p->end_opWithStream(r);
+        test(chunk.size() == 10000 && chunk[0] == 100 * 10000);
+
+        //
+        // The chunks which aren't read are discarded by the end_ method.
+        //
+        r = p->begin_opWithStream(100, 10000);
+        test(p->next_opWithStream(chunk, r));
+        test(chunk.size() == 10000 && chunk[0] == 0);
+        chunk = p->end_opWithStream(r);
+        test(chunk.size() == 10000 && chunk[0] == 100 * 10000);
+        try
+        {
+            p->next_opWithStream(chunk, r);
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+        }
+
+        //
+        // A dynamic invocation doesn't request the chunks, the complete result is sent with the response.
+        //
+        Ice::OutputStream out(communicator);
+        out.startEncapsulation();
+        out.write(10);
+        out.write(100);
+        out.endEncapsulation();
+        vector<Ice::Byte> inEncaps;
+        out.finished(inEncaps);
+        vector<Ice::Byte> outEncaps;
+        test(p->ice_invoke("opWithStream", Ice::Normal, inEncaps, outEncaps));
+        Ice::InputStream in(communicator, outEncaps);
+        in.startEncapsulation();
+        in.read(result);
+        in.endEncapsulation();
+        test(result.size() == 11 * 100);
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            test(result[i] == static_cast<int>(i));
+        }
+
+        test(p->opWithResult() == 15);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coroutines... " << flush;
+    {
+        Ice::Int j;
+        test(p->opWithCoroutine(5, j) == 5 && j == 10);
+        try
+        {
+            p->opWithCoroutine(-1, j);
+            test(false);
+        }
+        catch(const Test::TestIntfException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
     if(p->ice_getConnection())
     {
         cout << "testing bidir... " << flush;
@@ -8,6 +8,107 @@
 using namespace std;
 using namespace Ice;
 
+namespace
+{
+
+Ice::IntSeq
+makeChunk(int i, int size)
+{
+    Ice::IntSeq chunk;
+    for(int j = 0; j < size; ++j)
+    {
+        chunk.push_back(i * size + j);
+    }
+    return chunk;
+}
+
+//
+// Sends the chunks of opWithStream, the chunks are sent from the dispatch thread and once the send
+// queue drains from the thread pool, the producer never waits.
+//
+#ifdef ICE_CPP11_MAPPING
+class StreamProducer : public enable_shared_from_this<StreamProducer>
+{
+public:
+
+    StreamProducer(int count, int size, function<bool(const Ice::IntSeq&, Ice::ChunkReadyCallback)> chunk,
+                   function<void(const Ice::IntSeq&)> response, function<void(exception_ptr)> exception) :
+        _count(count), _size(size), _next(0), _chunk(move(chunk)), _response(move(response)),
+        _exception(move(exception))
+    {
+    }
+
+    void
+    ready()
+    {
+        try
+        {
+            auto self = shared_from_this();
+            while(_next < _count)
+            {
+                if(!_chunk(makeChunk(_next++, _size), [self]() { self->ready(); }))
+                {
+                    return; // Called again once the next chunk can be sent.
+                }
+            }
+            _response(makeChunk(_count, _size));
+        }
+        catch(...)
+        {
+            _exception(current_exception());
+        }
+    }
+
+private:
+
+    const int _count;
+    const int _size;
+    int _next;
+    const function<bool(const Ice::IntSeq&, Ice::ChunkReadyCallback)> _chunk;
+    const function<void(const Ice::IntSeq&)> _response;
+    const function<void(exception_ptr)> _exception;
+};
+#else
+class StreamProducer : public Ice::ChunkReadyCallback
+{
+public:
+
+    StreamProducer(const Test::AMD_TestIntf_opWithStreamPtr& cb, int count, int size) :
+        _cb(cb), _count(count), _size(size), _next(0)
+    {
+    }
+
+    virtual void
+    ready()
+    {
+        try
+        {
+            while(_next < _count)
+            {
+                if(!_cb->ice_chunk(makeChunk(_next++, _size), this))
+                {
+                    return; // Called again once the next chunk can be sent.
+                }
+            }
+            _cb->ice_response(makeChunk(_count, _size));
+        }
+        catch(const std::exception& ex)
+        {
+            _cb->ice_exception(ex);
+        }
+    }
+
+private:
+
+    const Test::AMD_TestIntf_opWithStreamPtr _cb;
+    const int _count;
+    const int _size;
+    int _next;
+};
+#endif
+
+}
+
 TestIntfI::TestIntfI() :
     _batchCount(0), _shutdown(false)
 {
@@ -100,6 +201,29 @@ TestIntfI::sleep(Ice::Int ms, const Ice::Current&)
     timedWait(IceUtil::Time::milliSeconds(ms));
 }
 
+//
+// The chunks are sent from a separate thread, sending a chunk waits if the client
+// doesn't consume the chunks fast enough.
+//
+#ifdef ICE_CPP11_MAPPING
+void
+TestIntfI::opWithStreamAsync(Ice::Int count, Ice::Int size,
+                             function<bool(const Ice::IntSeq&, Ice::ChunkReadyCallback)> chunk,
+                             function<void(const Ice::IntSeq&)> response, function<void(exception_ptr)> exception,
+                             const Ice::Current&)
+{
+    make_shared<StreamProducer>(count, size, move(chunk), move(response), move(exception))->ready();
+}
+#else
+void
+TestIntfI::opWithStream_async(const Test::AMD_TestIntf_opWithStreamPtr& cb, Ice::Int count, Ice::Int size,
+                              const Ice::Current&)
+{
+    Ice::ChunkReadyCallbackPtr producer = new StreamProducer(cb, count, size);
+    producer->ready();
+}
+#endif
+
 #ifdef ICE_CPP11_MAPPING
 void
 TestIntfI::startDispatchAsync(std::function<void()> response, std::function<void(std::exception_ptr)>,
@@ -137,6 +261,41 @@ TestIntfI::startDispatch_async(const Test::AMD_TestIntf_startDispatchPtr& cb, co
 }
 #endif
 
+#if defined(ICE_HAS_COROUTINES)
+Ice::Task<Test::TestIntf::OpWithCoroutineResult>
+TestIntfI::opWithCoroutineAsync(Ice::Int i, Ice::Current)
+{
+    if(i < 0)
+    {
+        throw Test::TestIntfException();
+    }
+    co_return Test::TestIntf::OpWithCoroutineResult { i, i * 2 };
+}
+#elif defined(ICE_CPP11_MAPPING)
+void
+TestIntfI::opWithCoroutineAsync(Ice::Int i, function<void(int, int)> response, function<void(exception_ptr)> exception,
+                                const Ice::Current&)
+{
+    if(i < 0)
+    {
+        exception(make_exception_ptr(Test::TestIntfException()));
+        return;
+    }
+    response(i, i * 2);
+}
+#else
+void
+TestIntfI::opWithCoroutine_async(const Test::AMD_TestIntf_opWithCoroutinePtr& cb, Ice::Int i, const Ice::Current&)
+{
+    if(i < 0)
+    {
+        cb->ice_exception(Test::TestIntfException());
+        return;
+    }
+    cb->ice_response(i, i * 2);
+}
+#endif
+
 void
 TestIntfI::finishDispatch(const Ice::Current&)
 {
@@ -30,10 +30,24 @@ public:
     virtual void close(Test::CloseMode, const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
 #ifdef ICE_CPP11_MAPPING
+    virtual void opWithStreamAsync(Ice::Int, Ice::Int,
+                                   std::function<bool(const Ice::IntSeq&, Ice::ChunkReadyCallback)>,
+                                   std::function<void(const Ice::IntSeq&)>, std::function<void(std::exception_ptr)>,
+                                   const Ice::Current&);
     virtual void startDispatchAsync(std::function<void()>, std::function<void(std::exception_ptr)>,
                                     const Ice::Current&);
 #else
+    virtual void opWithStream_async(const Test::AMD_TestIntf_opWithStreamPtr&, Ice::Int, Ice::Int,
+                                    const Ice::Current&);
     virtual void startDispatch_async(const Test::AMD_TestIntf_startDispatchPtr&, const Ice::Current&);
+#endif
+#if defined(ICE_HAS_COROUTINES)
+    virtual Ice::Task<Test::TestIntf::OpWithCoroutineResult> opWithCoroutineAsync(Ice::Int, Ice::Current);
+#elif defined(ICE_CPP11_MAPPING)
+    virtual void opWithCoroutineAsync(Ice::Int, std::function<void(int, int)>, std::function<void(std::exception_ptr)>,
+                                      const Ice::Current&);
+#else
+    virtual void opWithCoroutine_async(const Test::AMD_TestIntf_opWithCoroutinePtr&, Ice::Int, const Ice::Current&);
 #endif
     virtual void finishDispatch(const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
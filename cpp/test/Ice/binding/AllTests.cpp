@@ -566,6 +566,46 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection pool... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("AdapterPool", "default");
+        string proxy = communicator->proxyToString(adapter->getTestIntf());
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Default.ConnectionPoolSize", "3");
+        Ice::CommunicatorHolder ich(initData);
+
+        //
+        // Each proxy gets its own connection until the pool is full.
+        //
+        set<Ice::ConnectionPtr> connections;
+        for(int i = 0; i < 3; ++i)
+        {
+            Ice::ObjectPrxPtr prx = ich->stringToProxy(proxy);
+            prx->ice_ping();
+            connections.insert(prx->ice_getConnection());
+        }
+        test(connections.size() == 3);
+        test(connections.find(ich->stringToProxy(proxy)->ice_getConnection()) != connections.end());
+
+        //
+        // Per request binding spreads the requests over the pool connections.
+        //
+        TestIntfPrxPtr test1 = ICE_UNCHECKED_CAST(TestIntfPrx, ich->stringToProxy(proxy)->ice_connectionCached(false));
+        set<Ice::ConnectionPtr> perRequest;
+        for(int i = 0; i < 100 && perRequest.size() < 3; ++i)
+        {
+            Ice::ConnectionPtr connection = test1->ice_getConnection();
+            test(connections.find(connection) != connections.end());
+            perRequest.insert(connection);
+        }
+        test(perRequest.size() == 3);
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     cout << "testing per request binding with multiple endpoints... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
@@ -801,6 +841,49 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing per request binding and least latency endpoint selection... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter71", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter72", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter73", "default"));
+
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, createTestIntfPrx(adapters)->ice_connectionCached(false));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                  test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, LeastLatency)));
+        test(test->ice_getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, LeastLatency));
+        test(communicator->proxyToProperty(test, "Test")["Test.EndpointSelection"] == "LeastLatency");
+
+        //
+        // The endpoints without completed requests are selected first.
+        //
+        set<string> names;
+        names.insert("Adapter71");
+        names.insert("Adapter72");
+        names.insert("Adapter73");
+        while(!names.empty())
+        {
+            names.erase(test->getAdapterName());
+        }
+        for(int i = 0; i < 10; ++i)
+        {
+            string name = getAdapterNameWithAMI(test);
+            test(name == "Adapter71" || name == "Adapter72" || name == "Adapter73");
+        }
+
+        com->deactivateObjectAdapter(adapters[0]);
+
+        names.clear();
+        for(int i = 0; i < 10; ++i)
+        {
+            names.insert(test->getAdapterName());
+        }
+        test(names.find("Adapter71") == names.end());
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
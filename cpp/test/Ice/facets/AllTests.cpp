@@ -114,6 +114,38 @@ allTests(Test::TestHelper* helper)
         test(fm[""] == obj3);
         cout << "ok" << endl;
 
+        cout << "testing many servants... " << flush;
+        for(int i = 0; i < 1000; ++i)
+        {
+            ostringstream os;
+            os << "cat" << (i % 10) << "/id" << i;
+            adapter->add(obj1, Ice::stringToIdentity(os.str()));
+            adapter->addFacet(obj2, Ice::stringToIdentity(os.str()), "f");
+        }
+        for(int i = 0; i < 1000; ++i)
+        {
+            ostringstream os;
+            os << "cat" << (i % 10) << "/id" << i;
+            test(adapter->find(Ice::stringToIdentity(os.str())) == obj1);
+            test(adapter->findFacet(Ice::stringToIdentity(os.str()), "f") == obj2);
+            if(i % 2 == 0)
+            {
+                test(adapter->removeAllFacets(Ice::stringToIdentity(os.str())).size() == 2);
+            }
+            else
+            {
+                test(adapter->remove(Ice::stringToIdentity(os.str())) == obj1);
+            }
+        }
+        for(int i = 0; i < 1000; ++i)
+        {
+            ostringstream os;
+            os << "cat" << (i % 10) << "/id" << i;
+            test(!adapter->find(Ice::stringToIdentity(os.str())));
+            test(adapter->findAllFacets(Ice::stringToIdentity(os.str())).size() == (i % 2 == 0 ? 0 : 1));
+        }
+        cout << "ok" << endl;
+
         adapter->deactivate();
     }
 
@@ -327,6 +327,127 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing dispatch lanes... " << flush;
+    {
+        //
+        // The adapter dispatches a single request at a time, the requests of the Control
+        // lane are dispatched before the requests waiting in the Default lane.
+        //
+        HoldPrxPtr holdLanes = ICE_UNCHECKED_CAST(HoldPrx,
+                                                  communicator->stringToProxy("hold:" + helper->getTestEndpoint(2)));
+        holdLanes->ice_ping();
+        Ice::Context ctx;
+        ctx["lane"] = "Control";
+#ifdef ICE_CPP11_MAPPING
+        vector<future<int>> results;
+        for(int i = 0; i < 20; ++i)
+        {
+            results.push_back(holdLanes->setAsync(i, 50));
+        }
+        holdLanes->ice_ping();
+        test(results.back().wait_for(chrono::seconds(0)) != future_status::ready);
+        holdLanes->set(20, 0, ctx);
+        test(results.back().wait_for(chrono::seconds(0)) != future_status::ready);
+        for(vector<future<int>>::iterator p = results.begin(); p != results.end(); ++p)
+        {
+            p->get();
+        }
+#else
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 20; ++i)
+        {
+            results.push_back(holdLanes->begin_set(i, 50));
+        }
+        holdLanes->ice_ping();
+        test(!results.back()->isCompleted());
+        holdLanes->set(20, 0, ctx);
+        test(!results.back()->isCompleted());
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            holdLanes->end_set(*p);
+        }
+#endif
+    }
+    cout << "ok" << endl;
+
+    cout << "testing deadline propagation... " << flush;
+    {
+        //
+        // The request is queued behind a slow request and expires before it's
+        // dispatched, it's dropped by the server without being dispatched.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.PropagateDeadline", "1");
+        Ice::CommunicatorHolder ich = Ice::initialize(initData);
+        HoldPrxPtr holdLanes = ICE_UNCHECKED_CAST(HoldPrx,
+                                                  communicator->stringToProxy("hold:" + helper->getTestEndpoint(2)));
+        HoldPrxPtr holdDeadline = ICE_UNCHECKED_CAST(HoldPrx,
+            ich->stringToProxy("hold:" + helper->getTestEndpoint(2))->ice_invocationTimeout(100));
+        holdDeadline->ice_ping();
+#ifdef ICE_CPP11_MAPPING
+        future<int> result = holdLanes->setAsync(1, 500);
+#else
+        Ice::AsyncResultPtr result = holdLanes->begin_set(1, 500);
+#endif
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100)); // Wait for the slow request to be dispatched.
+        try
+        {
+            holdDeadline->set(2, 0);
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+#ifdef ICE_CPP11_MAPPING
+        result.get();
+#else
+        holdLanes->end_set(result);
+#endif
+        test(holdLanes->set(3, 0) == 1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing concurrency limit... " << flush;
+    {
+        //
+        // The adapter admits a single request at a time, the other requests are
+        // rejected while the slow request is dispatched.
+        //
+        HoldPrxPtr holdLimit = ICE_UNCHECKED_CAST(HoldPrx,
+                                                  communicator->stringToProxy("hold:" + helper->getTestEndpoint(3)));
+        holdLimit->ice_ping();
+#ifdef ICE_CPP11_MAPPING
+        future<int> result = holdLimit->setAsync(1, 500);
+#else
+        Ice::AsyncResultPtr result = holdLimit->begin_set(1, 500);
+#endif
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100)); // Wait for the slow request to be dispatched.
+        try
+        {
+            holdLimit->set(2, 0);
+            test(false);
+        }
+        catch(const Ice::ServerBusyException&)
+        {
+        }
+        try
+        {
+            holdLimit->ice_ping();
+            test(false);
+        }
+        catch(const Ice::ServerBusyException&)
+        {
+        }
+#ifdef ICE_CPP11_MAPPING
+        result.get();
+#else
+        holdLimit->end_set(result);
+#endif
+        test(holdLimit->set(3, 0) == 1);
+    }
+    cout << "ok" << endl;
+
     cout << "changing state to hold and shutting down server... " << flush;
     hold->shutdown();
     cout << "ok" << endl;
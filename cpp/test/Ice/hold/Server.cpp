@@ -37,8 +37,27 @@ Server::run(int argc, char** argv)
     Ice::ObjectAdapterPtr adapter2 = communicator->createObjectAdapter("TestAdapter2");
     adapter2->add(ICE_MAKE_SHARED(HoldI, timer, adapter2), Ice::stringToIdentity("hold"));
 
+    communicator->getProperties()->setProperty("TestAdapter3.Endpoints", getTestEndpoint(2));
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.Size", "2");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.SizeMax", "2");
+    communicator->getProperties()->setProperty("TestAdapter3.Lane.Control.Operations", "ice_ping");
+    communicator->getProperties()->setProperty("TestAdapter3.Lane.Control.Weight", "10");
+    communicator->getProperties()->setProperty("TestAdapter3.LaneContext", "lane");
+    Ice::ObjectAdapterPtr adapter3 = communicator->createObjectAdapter("TestAdapter3");
+    adapter3->add(ICE_MAKE_SHARED(HoldI, timer, adapter3), Ice::stringToIdentity("hold"));
+
+    communicator->getProperties()->setProperty("TestAdapter4.Endpoints", getTestEndpoint(3));
+    communicator->getProperties()->setProperty("TestAdapter4.ThreadPool.Size", "2");
+    communicator->getProperties()->setProperty("TestAdapter4.ThreadPool.SizeMax", "2");
+    communicator->getProperties()->setProperty("TestAdapter4.ConcurrencyLimit", "1");
+    communicator->getProperties()->setProperty("TestAdapter4.ConcurrencyLimit.Max", "1");
+    Ice::ObjectAdapterPtr adapter4 = communicator->createObjectAdapter("TestAdapter4");
+    adapter4->add(ICE_MAKE_SHARED(HoldI, timer, adapter4), Ice::stringToIdentity("hold"));
+
     adapter1->activate();
     adapter2->activate();
+    adapter3->activate();
+    adapter4->activate();
 
     serverReady();
 
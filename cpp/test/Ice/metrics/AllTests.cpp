@@ -720,6 +720,39 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         waitForCurrent(clientMetrics, "View", "Connection", 0);
         waitForCurrent(serverMetrics, "View", "Connection", 0);
 
+#if !defined(ICE_OS_UWP)
+        //
+        // Zeros compress well, the compression of random bytes is skipped by the
+        // adaptive compression policy.
+        //
+        props["IceMX.Metrics.View.Map.Connection.GroupBy"] = "connectionId";
+        updateProps(clientProps, serverProps, update.get(), props, "Connection");
+
+        MetricsPrxPtr compressPrx = metrics->ice_compress(true)->ice_connectionId("Compress");
+        compressPrx->opByteS(Test::ByteSeq(1024, 0));
+
+        map = toMap(clientMetrics->getMetricsView("View", timestamp)["Connection"]);
+        cm1 = ICE_DYNAMIC_CAST(IceMX::ConnectionMetrics, map["Compress"]);
+        test(cm1->compressedMessages == Ice::Long(1) && cm1->compressionSkipped == Ice::Long(0));
+
+        Test::ByteSeq random(1024);
+        unsigned int seed = 1;
+        for(Test::ByteSeq::iterator p = random.begin(); p != random.end(); ++p)
+        {
+            seed = seed * 1103515245 + 12345;
+            *p = static_cast<Ice::Byte>(seed >> 16);
+        }
+        compressPrx->opByteS(random);
+
+        map = toMap(clientMetrics->getMetricsView("View", timestamp)["Connection"]);
+        cm1 = ICE_DYNAMIC_CAST(IceMX::ConnectionMetrics, map["Compress"]);
+        test(cm1->compressedMessages == Ice::Long(1) && cm1->compressionSkipped == Ice::Long(1));
+
+        compressPrx->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        waitForCurrent(clientMetrics, "View", "Connection", 0);
+        waitForCurrent(serverMetrics, "View", "Connection", 0);
+#endif
+
         cout << "ok" << endl;
 
         cout << "testing connection establishment metrics... " << flush;
@@ -796,6 +829,25 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         m1 = clientMetrics->getMetricsView("View", timestamp)["EndpointLookup"][0];
         test(m1->current <= 1 && (m1->total == 1 || m1->total == 2));
 
+        //
+        // The host was resolved by the first lookup, the lookup for the new connection
+        // uses the cached addresses.
+        //
+        IceMX::EndpointLookupMetricsPtr lm = ICE_DYNAMIC_CAST(IceMX::EndpointLookupMetrics, m1);
+        test(lm && lm->cacheHits == lm->total - 1 && lm->negativeCacheHits == 0 && lm->coalesced == 0);
+        try
+        {
+            prx->ice_ping();
+            prx->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        Ice::Long total = lm->total;
+        lm = ICE_DYNAMIC_CAST(IceMX::EndpointLookupMetrics,
+                              clientMetrics->getMetricsView("View", timestamp)["EndpointLookup"][0]);
+        test(lm->total == total + 1 && lm->cacheHits == total);
+
         bool dnsException = false;
         try
         {
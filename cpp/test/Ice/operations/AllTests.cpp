@@ -7,8 +7,232 @@
 #include <TestHelper.h>
 #include <Test.h>
 
+#ifndef ICE_OS_UWP
+#   ifdef _WIN32
+#      include <winsock2.h>
+#      include <ws2tcpip.h>
+#   else
+#      include <sys/socket.h>
+#      include <sys/time.h>
+#      include <netdb.h>
+#      include <unistd.h>
+#      include <errno.h>
+#   endif
+#endif
+
 using namespace std;
 
+#ifndef ICE_OS_UWP
+namespace
+{
+
+#ifdef _WIN32
+typedef SOCKET SocketFd;
+#else
+typedef int SocketFd;
+const SocketFd INVALID_SOCKET = -1;
+#endif
+
+const Ice::Byte fragmentationSupported = 0x80;
+
+//
+// A connection established with a plain socket, used to send messages which Ice doesn't send.
+//
+class RawConnection
+{
+public:
+
+    RawConnection(const string& host, int port) :
+        _fd(INVALID_SOCKET)
+    {
+        addrinfo hints = addrinfo();
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addrs = 0;
+        ostringstream os;
+        os << port;
+        test(getaddrinfo(host.c_str(), os.str().c_str(), &hints, &addrs) == 0);
+        _fd = socket(addrs->ai_family, SOCK_STREAM, 0);
+        test(_fd != INVALID_SOCKET);
+        test(connect(_fd, addrs->ai_addr, static_cast<int>(addrs->ai_addrlen)) == 0);
+        freeaddrinfo(addrs);
+
+#ifdef _WIN32
+        DWORD timeout = 2000;
+#else
+        timeval timeout;
+        timeout.tv_sec = 2;
+        timeout.tv_usec = 0;
+#endif
+        setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+    }
+
+    ~RawConnection()
+    {
+#ifdef _WIN32
+        closesocket(_fd);
+#else
+        close(_fd);
+#endif
+    }
+
+    //
+    // Read the validate connection message of the server and return its compression status.
+    //
+    Ice::Byte
+    readValidateConnection()
+    {
+        char header[14];
+        size_t pos = 0;
+        while(pos < sizeof(header))
+        {
+            int n = static_cast<int>(recv(_fd, header + pos, static_cast<int>(sizeof(header) - pos), 0));
+            test(n > 0);
+            pos += static_cast<size_t>(n);
+        }
+        test(header[8] == 3); // Validate connection message.
+        return static_cast<Ice::Byte>(header[9]);
+    }
+
+    void
+    write(const Ice::ByteSeq& data)
+    {
+        //
+        // Errors are ignored, the server might already have closed the connection.
+        //
+        size_t pos = 0;
+        while(pos < data.size())
+        {
+            int n = static_cast<int>(send(_fd, reinterpret_cast<const char*>(&data[0]) + pos,
+                                          static_cast<int>(data.size() - pos), 0));
+            if(n <= 0)
+            {
+                return;
+            }
+            pos += static_cast<size_t>(n);
+        }
+    }
+
+    //
+    // Return true if the server closes the connection, false if it's still open after 2s.
+    //
+    bool
+    closed()
+    {
+        char buf[1024];
+        while(true)
+        {
+            int n = static_cast<int>(recv(_fd, buf, static_cast<int>(sizeof(buf)), 0));
+            if(n == 0)
+            {
+                return true;
+            }
+            else if(n < 0)
+            {
+#ifdef _WIN32
+                return WSAGetLastError() != WSAETIMEDOUT;
+#else
+                return errno != EAGAIN && errno != EWOULDBLOCK;
+#endif
+            }
+        }
+    }
+
+private:
+
+    SocketFd _fd;
+};
+
+//
+// Create a fragment of a request message with the given size, the first fragment starts with
+// the header of the request message.
+//
+Ice::ByteSeq
+createFragment(const Ice::CommunicatorPtr& communicator, Ice::Int fragmentId, Ice::Int messageSize, bool first,
+               bool last, size_t dataSize)
+{
+    Ice::OutputStream os(communicator);
+    const Ice::Byte header[] = { 'I', 'c', 'e', 'P', 1, 0, 1, 0 };
+    size_t sz = dataSize + (first ? sizeof(header) + 6 : 0);
+    os.writeBlob(header, sizeof(header));
+    os.write(static_cast<Ice::Byte>(5)); // Fragment message.
+    os.write(static_cast<Ice::Byte>(0));
+    os.write(static_cast<Ice::Int>(14 + 5 + sz));
+    os.write(fragmentId);
+    os.write(static_cast<Ice::Byte>(last ? 1 : 0));
+    if(first)
+    {
+        os.writeBlob(header, sizeof(header));
+        os.write(static_cast<Ice::Byte>(0)); // Request message.
+        os.write(static_cast<Ice::Byte>(0));
+        os.write(messageSize);
+    }
+    Ice::ByteSeq data(dataSize);
+    os.writeBlob(data);
+    Ice::ByteSeq bytes;
+    os.finished(bytes);
+    return bytes;
+}
+
+void
+fragmentLimits(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrxPtr& cl)
+{
+    Ice::TCPConnectionInfoPtr info = ICE_DYNAMIC_CAST(Ice::TCPConnectionInfo,
+                                                         cl->ice_connectionId("fragments")->ice_getConnection()->getInfo());
+    test(info);
+
+    bool fragments;
+    {
+        RawConnection connection(info->remoteAddress, info->remotePort);
+        fragments = (connection.readValidateConnection() & fragmentationSupported) != 0;
+        if(!fragments)
+        {
+            //
+            // The server closes the connection if it receives fragments although it didn't
+            // advertise that it reassembles fragmented messages.
+            //
+            connection.write(createFragment(communicator, 1, 14 + 100, true, true, 100));
+            test(connection.closed());
+            return;
+        }
+
+        //
+        // The server closes the connection if too many messages are reassembled at once.
+        //
+        for(Ice::Int i = 1; i <= 9; ++i)
+        {
+            connection.write(createFragment(communicator, i, 64 * 1024, true, false, 1024));
+        }
+        test(connection.closed());
+    }
+
+    {
+        //
+        // The server closes the connection if the messages reassembled at once exceed
+        // Ice.MessageSizeMax, the buffers of the messages grow as the fragments are received.
+        //
+        RawConnection connection(info->remoteAddress, info->remotePort);
+        connection.readValidateConnection();
+        for(Ice::Int i = 1; i <= 4; ++i)
+        {
+            connection.write(createFragment(communicator, i, 1000 * 1024, true, false, 300 * 1024));
+        }
+        test(connection.closed());
+    }
+
+    {
+        //
+        // The connection remains open for a message reassembled within the limits.
+        //
+        RawConnection connection(info->remoteAddress, info->remotePort);
+        connection.readValidateConnection();
+        connection.write(createFragment(communicator, 1, 64 * 1024, true, false, 1024));
+        test(!connection.closed());
+    }
+}
+
+}
+#endif
+
 Test::MyClassPrxPtr
 allTests(Test::TestHelper* helper)
 {
@@ -53,5 +277,14 @@ allTests(Test::TestHelper* helper)
     batchOnewaysAMI(derived);
     cout << "ok" << endl;
 
+#ifndef ICE_OS_UWP
+    if(cl->ice_getConnection() && helper->getTestProtocol() == "tcp")
+    {
+        cout << "testing fragmented message limits... " << flush;
+        fragmentLimits(communicator, cl);
+        cout << "ok" << endl;
+    }
+#endif
+
     return cl;
 }
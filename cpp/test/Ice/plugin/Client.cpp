@@ -10,6 +10,19 @@ using namespace std;
 namespace
 {
 
+class Echo : public Ice::Blobject
+{
+
+public:
+
+    virtual bool
+    ice_invoke(ICE_IN(vector<Ice::Byte>) inEncaps, vector<Ice::Byte>& outEncaps, const Ice::Current&)
+    {
+        outEncaps = inEncaps;
+        return true;
+    }
+};
+
 class MyPlugin : public Ice::Plugin
 {
 
@@ -281,6 +294,35 @@ Client::run(int argc, char** argv)
     }
     cout << "ok" << endl;
 
+    cout << "testing compression codec plug-in... " << flush;
+    {
+        Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+        properties->setProperty("Ice.Plugin.CompressionCodec", pluginDir + "TestPlugin:createCompressionCodecPlugin");
+        properties->setProperty("Ice.Compression.Codec", "xor");
+        properties->setProperty("Ice.Compression.Adaptive", "0"); // The xor codec doesn't shrink the messages.
+        properties->setProperty("TestAdapter.Endpoints", "tcp -h 127.0.0.1");
+        Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+        Ice::ObjectPrxPtr obj = adapter->add(ICE_MAKE_SHARED(Echo), Ice::stringToIdentity("echo"));
+        adapter->activate();
+        obj = obj->ice_compress(true)->ice_collocationOptimized(false);
+
+        Ice::ByteSeq inEncaps;
+        Ice::OutputStream out(communicator.communicator());
+        out.startEncapsulation();
+        out.write(string(10000, 'a'));
+        out.endEncapsulation();
+        out.finished(inEncaps);
+
+        Ice::ByteSeq outEncaps;
+        test(obj->ice_invoke("echo", Ice::ICE_ENUM(OperationMode, Normal), inEncaps, outEncaps));
+        test(outEncaps == inEncaps);
+        test(communicator->getProperties()->getPropertyAsInt("XorCompressionCodec.Compressed") > 0);
+        test(communicator->getProperties()->getPropertyAsInt("XorCompressionCodec.Uncompressed") > 0);
+    }
+    cout << "ok" << endl;
+
     cout << "testing destroy when a plug-in fails to initialize... " << flush;
     try
     {
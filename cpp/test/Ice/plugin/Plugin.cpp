@@ -345,6 +345,104 @@ public:
     }
 };
 
+//
+// A codec which xors the message bytes, it records its use with the communicator properties.
+//
+class XorCompressionCodec : public Ice::CompressionCodec
+{
+
+public:
+
+    XorCompressionCodec(const Ice::CommunicatorPtr& communicator, Ice::Byte id) :
+        _communicator(communicator.get()),
+        _id(id)
+    {
+    }
+
+    virtual Ice::Byte
+    id() const
+    {
+        return _id;
+    }
+
+    virtual string
+    name() const
+    {
+        return "xor";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return sz;
+    }
+
+    virtual size_t
+    compress(const Ice::Byte* src, size_t srcLen, Ice::Byte* dst, size_t dstLen, int) const
+    {
+        test(dstLen >= srcLen);
+        for(size_t i = 0; i < srcLen; ++i)
+        {
+            dst[i] = static_cast<Ice::Byte>(src[i] ^ 0x5a);
+        }
+        _communicator->getProperties()->setProperty("XorCompressionCodec.Compressed", "1");
+        return srcLen;
+    }
+
+    virtual void
+    uncompress(const Ice::Byte* src, size_t srcLen, Ice::Byte* dst, size_t dstLen) const
+    {
+        test(dstLen == srcLen);
+        for(size_t i = 0; i < srcLen; ++i)
+        {
+            dst[i] = static_cast<Ice::Byte>(src[i] ^ 0x5a);
+        }
+        _communicator->getProperties()->setProperty("XorCompressionCodec.Uncompressed", "1");
+    }
+
+private:
+
+    //
+    // The communicator is held by the plug-in, the codec is registered with the communicator.
+    //
+    Ice::Communicator* _communicator;
+    const Ice::Byte _id;
+};
+
+class CompressionCodecPlugin : public Ice::Plugin
+{
+
+public:
+
+    CompressionCodecPlugin(const Ice::CommunicatorPtr& communicator) :
+         _communicator(communicator)
+    {
+    }
+
+    void
+    initialize()
+    {
+        try
+        {
+            Ice::registerCompressionCodec(_communicator, ICE_MAKE_SHARED(XorCompressionCodec, _communicator, 6));
+            test(false);
+        }
+        catch(const Ice::InitializationException&)
+        {
+        }
+        Ice::registerCompressionCodec(_communicator, ICE_MAKE_SHARED(XorCompressionCodec, _communicator, 3));
+    }
+
+    void
+    destroy()
+    {
+    }
+
+private:
+
+    const Ice::CommunicatorPtr _communicator;
+};
+
 }
 
 extern "C" ICE_DECLSPEC_EXPORT ::Ice::Plugin*
@@ -404,3 +502,9 @@ createPluginThreeFail(const Ice::CommunicatorPtr& communicator, const string&, c
 {
     return new PluginThreeFail(communicator);
 }
+
+extern "C" ICE_DECLSPEC_EXPORT ::Ice::Plugin*
+createCompressionCodecPlugin(const Ice::CommunicatorPtr& communicator, const string&, const Ice::StringSeq&)
+{
+    return new CompressionCodecPlugin(communicator);
+}
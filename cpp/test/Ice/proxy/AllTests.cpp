@@ -682,6 +682,46 @@ allTests(Test::TestHelper* helper)
     {
     }
 
+    try
+    {
+        test(base->ice_hedging(0, 1)->ice_getHedgingMaxAttempts() == 1);
+        test(base->ice_hedging(10, 3)->ice_getHedgingDelay() == 10);
+    }
+#ifdef ICE_CPP11_MAPPING
+    catch(const invalid_argument&)
+#else
+    catch(const IceUtil::IllegalArgumentException&)
+#endif
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_hedging(-1, 2);
+        test(false);
+    }
+#ifdef ICE_CPP11_MAPPING
+    catch(const invalid_argument&)
+#else
+    catch(const IceUtil::IllegalArgumentException&)
+#endif
+    {
+    }
+
+    try
+    {
+        base->ice_hedging(10, 0);
+        test(false);
+    }
+#ifdef ICE_CPP11_MAPPING
+    catch(const invalid_argument&)
+#else
+    catch(const IceUtil::IllegalArgumentException&)
+#endif
+    {
+    }
+
     try
     {
         base->ice_locatorCacheTimeout(0);
@@ -854,6 +894,11 @@ allTests(Test::TestHelper* helper)
     test(Ice::targetLess(compObj1->ice_invocationTimeout(10), compObj1->ice_invocationTimeout(20)));
     test(Ice::targetGreaterEqual(compObj1->ice_invocationTimeout(20), compObj1->ice_invocationTimeout(10)));
 
+    test(Ice::targetEqualTo(compObj1->ice_hedging(20, 2), compObj1->ice_hedging(20, 2)));
+    test(Ice::targetNotEqualTo(compObj1->ice_hedging(10, 2), compObj1->ice_hedging(20, 2)));
+    test(Ice::targetLess(compObj1->ice_hedging(10, 2), compObj1->ice_hedging(20, 2)));
+    test(Ice::targetLess(compObj1->ice_hedging(10, 2), compObj1->ice_hedging(10, 3)));
+
     compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 1000");
     compObj2 = communicator->stringToProxy("foo@MyAdapter1");
     test(Ice::targetNotEqualTo(compObj1, compObj2));
@@ -1043,6 +1088,11 @@ allTests(Test::TestHelper* helper)
     test(compObj1->ice_invocationTimeout(10) < compObj1->ice_invocationTimeout(20));
     test(!(compObj1->ice_invocationTimeout(20) < compObj1->ice_invocationTimeout(10)));
 
+    test(compObj1->ice_hedging(20, 2) == compObj1->ice_hedging(20, 2));
+    test(compObj1->ice_hedging(10, 2) != compObj1->ice_hedging(20, 2));
+    test(compObj1->ice_hedging(10, 2) < compObj1->ice_hedging(20, 2));
+    test(compObj1->ice_hedging(10, 2) < compObj1->ice_hedging(10, 3));
+
     compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 1000");
     compObj2 = communicator->stringToProxy("foo@MyAdapter1");
     test(compObj1 != compObj2);
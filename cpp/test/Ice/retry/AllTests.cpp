@@ -353,5 +353,47 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
         cout << "ok" << endl;
     }
 
+    if(retry1->ice_getConnection())
+    {
+        cout << "testing hedging... " << flush;
+        RetryPrxPtr hedged = retry1->ice_hedging(100, 2);
+        test(hedged->ice_getHedgingDelay() == 100 && hedged->ice_getHedgingMaxAttempts() == 2);
+        testFailureCount(-1);
+        testRemoteFailureCount(-1);
+
+        //
+        // The first request is slow, the invocation completes with the reply of the
+        // second attempt.
+        //
+        hedged->opHedging(-1);
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(hedged->opHedging(2000) == 2);
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+
+        hedged->opHedging(-1);
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+#ifdef ICE_CPP11_MAPPING
+        test(hedged->opHedgingAsync(2000).get() == 2);
+#else
+        test(hedged->end_opHedging(hedged->begin_opHedging(2000)) == 2);
+#endif
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+
+        //
+        // The invocation completed with the reply of the second attempt isn't reported
+        // as failed although its request is canceled.
+        //
+        testFailureCount(0);
+        testRemoteFailureCount(0);
+
+        //
+        // A fast reply completes the invocation before another attempt is sent.
+        //
+        hedged->opHedging(-1);
+        test(hedged->opHedging(0) == 1);
+        test(hedged->opHedging(0) == 2);
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
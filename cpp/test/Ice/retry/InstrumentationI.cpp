@@ -11,6 +11,7 @@ namespace
 int nRetry = 0;
 int nFailure = 0;
 int nInvocation = 0;
+int nRemoteFailure = 0;
 IceUtil::Mutex* staticMutex = 0;
 
 class Init
@@ -30,6 +31,35 @@ public:
 };
 Init init;
 
+class RemoteObserverI : public Ice::Instrumentation::RemoteObserver
+{
+public:
+
+    virtual void
+    attach()
+    {
+    }
+
+    virtual void
+    detach()
+    {
+    }
+
+    virtual void
+    failed(const ::std::string&)
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(staticMutex);
+        ++nRemoteFailure;
+    }
+
+    virtual void
+    reply(::Ice::Int)
+    {
+    }
+};
+
+Ice::Instrumentation::RemoteObserverPtr remoteObserver = ICE_MAKE_SHARED(RemoteObserverI);
+
 class InvocationObserverI : public Ice::Instrumentation::InvocationObserver
 {
 public:
@@ -68,7 +98,7 @@ public:
     virtual ::Ice::Instrumentation::RemoteObserverPtr
     getRemoteObserver(const ::Ice::ConnectionInfoPtr&, const ::Ice::EndpointPtr&, ::Ice::Int, ::Ice::Int)
     {
-        return ICE_NULLPTR;
+        return remoteObserver;
     }
 
     virtual ::Ice::Instrumentation::CollocatedObserverPtr
@@ -171,6 +201,7 @@ void initCounts()
     nRetry = 0;
     nFailure = 0;
     nInvocation = 0;
+    nRemoteFailure = 0;
 }
 
 Ice::Instrumentation::CommunicatorObserverPtr
@@ -196,3 +227,9 @@ testInvocationCount(int expected)
 {
     testEqual(nInvocation, expected);
 }
+
+void
+testRemoteFailureCount(int expected)
+{
+    testEqual(nRemoteFailure, expected);
+}
@@ -8,6 +8,7 @@
 void testRetryCount(int);
 void testFailureCount(int);
 void testInvocationCount(int);
+void testRemoteFailureCount(int);
 
 void initCounts();
 Ice::Instrumentation::CommunicatorObserverPtr getObserver();
@@ -22,6 +22,7 @@ Server::run(int argc, char** argv)
     properties->setProperty("Ice.Warn.Dispatch", "0");
     properties->setProperty("Ice.Warn.Connections", "0");
     properties->setProperty("Ice.PrintStackTraces", "0");
+    properties->setProperty("Ice.ThreadPool.Server.Size", "3"); // For the hedged requests.
     Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
 
     communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
@@ -6,7 +6,7 @@
 #include <TestI.h>
 #include <SystemFailure.h>
 
-RetryI::RetryI() : _counter(0)
+RetryI::RetryI() : _counter(0), _hedgingCounter(0)
 {
 }
 
@@ -63,6 +63,30 @@ RetryI::sleep(int delay, const Ice::Current&)
     IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
 }
 
+int
+RetryI::opHedging(int delay, const Ice::Current&)
+{
+    //
+    // The first call after the counter is reset with a negative delay is slow, the
+    // other calls return right away.
+    //
+    int counter;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(delay < 0)
+        {
+            _hedgingCounter = 0;
+            return 0;
+        }
+        counter = ++_hedgingCounter;
+    }
+    if(counter == 1)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+    }
+    return counter;
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
@@ -7,7 +7,7 @@
 
 #include <Test.h>
 
-class RetryI : public Test::Retry
+class RetryI : public Test::Retry, private IceUtil::Mutex
 {
 public:
 
@@ -18,11 +18,13 @@ public:
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void opSystemException(const Ice::Current&);
     virtual void sleep(int, const Ice::Current&);
+    virtual int opHedging(int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
 
     int _counter;
+    int _hedgingCounter;
 };
 
 #endif
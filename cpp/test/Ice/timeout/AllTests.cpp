@@ -153,6 +153,33 @@ allTestsWithController(Test::TestHelper* helper, const ControllerPrxPtr& control
     }
     cout << "ok" << endl;
 
+    cout << "testing connect attempt delay... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectAttemptDelay", "100");
+        Ice::CommunicatorHolder ich(initData);
+
+        //
+        // The first endpoint doesn't validate connections, the connection to the second
+        // endpoint is established without waiting for the connect timeout of the first.
+        //
+        Ice::EndpointSeq endpoints = ich->stringToProxy(sref)->ice_getEndpoints();
+        Ice::EndpointSeq endpoints2 = ich->stringToProxy("controller:" + helper->getTestEndpoint(1))->ice_getEndpoints();
+        endpoints.insert(endpoints.end(), endpoints2.begin(), endpoints2.end());
+        Ice::ObjectPrxPtr prx = ich->stringToProxy(sref)->ice_endpoints(endpoints)->ice_timeout(2000);
+        prx = prx->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered));
+
+        controller->holdAdapter(-1);
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        Ice::ConnectionPtr connection = prx->ice_getConnection();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+        test(connection->getEndpoint()->toString() == prx->ice_getEndpoints()[1]->toString());
+        controller->resumeAdapter();
+        timeout->op(); // Ensure adapter is active.
+    }
+    cout << "ok" << endl;
+
     // The sequence needs to be large enough to fill the write/recv buffers
     ByteSeq seq(2000000);
 
@@ -0,0 +1,325 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/TimerWheel.h>
+#include <IceUtil/Random.h>
+#include <TestHelper.h>
+
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+
+class TestTask : public IceUtil::TimerTask, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    TestTask(const IceUtil::Time& delay = IceUtil::Time()) : _delay(delay), _count(0)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        Lock sync(*this);
+        if(_count++ == 0)
+        {
+            _run = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+        notifyAll();
+    }
+
+    bool
+    hasRun() const
+    {
+        Lock sync(*this);
+        return _count > 0;
+    }
+
+    int
+    getCount() const
+    {
+        Lock sync(*this);
+        return _count;
+    }
+
+    IceUtil::Time
+    getRunTime() const
+    {
+        Lock sync(*this);
+        return _run;
+    }
+
+    IceUtil::Time
+    getDelay() const
+    {
+        return _delay;
+    }
+
+    void
+    waitForRun(const IceUtil::Time& timeout)
+    {
+        Lock sync(*this);
+        while(_count == 0)
+        {
+            if(!timedWait(timeout))
+            {
+                test(false); // Timeout.
+            }
+        }
+    }
+
+private:
+
+    const IceUtil::Time _delay;
+    IceUtil::Time _run;
+    int _count;
+};
+ICE_DEFINE_PTR(TestTaskPtr, TestTask);
+
+class DestroyTask : public IceUtil::TimerTask, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    DestroyTask(const IceInternal::TimerWheelPtr& timer) : _timer(timer), _run(false)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        Lock sync(*this);
+        _timer->destroy();
+        _timer = 0;
+        _run = true;
+        notify();
+    }
+
+    void
+    waitForRun()
+    {
+        Lock sync(*this);
+        while(!_run)
+        {
+            if(!timedWait(IceUtil::Time::seconds(10)))
+            {
+                test(false); // Timeout.
+            }
+        }
+    }
+
+private:
+
+    IceInternal::TimerWheelPtr _timer;
+    bool _run;
+};
+ICE_DEFINE_PTR(DestroyTaskPtr, DestroyTask);
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+};
+
+void
+Client::run(int, char**)
+{
+    //
+    // The wheel has a resolution of one millisecond and levels of 256 slots. A task is
+    // scheduled first with a delay beyond 65536 ticks, it moves down from the third level
+    // while the other tests run and it's checked last.
+    //
+    IceInternal::TimerWheelPtr timer = new IceInternal::TimerWheel(1, false, 0);
+    TestTaskPtr longTask = ICE_MAKE_SHARED(TestTask, IceUtil::Time::milliSeconds(65536 + 1000));
+    IceUtil::Time longStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    timer->schedule(longTask, longTask->getDelay());
+
+    cout << "testing schedule... " << flush;
+    {
+        TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
+        timer->schedule(task, IceUtil::Time());
+        task->waitForRun(IceUtil::Time::seconds(10));
+
+        //
+        // The same task can't be scheduled more than once.
+        //
+        task = ICE_MAKE_SHARED(TestTask);
+        timer->schedule(task, IceUtil::Time::milliSeconds(100));
+        try
+        {
+            timer->schedule(task, IceUtil::Time());
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Expected.
+        }
+        task->waitForRun(IceUtil::Time::seconds(10));
+        test(task->getCount() == 1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing cancel... " << flush;
+    {
+        TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
+        test(!timer->cancel(task));
+        timer->schedule(task, IceUtil::Time::milliSeconds(200));
+        test(timer->cancel(task));
+        test(!timer->cancel(task));
+
+        //
+        // Tasks in the higher levels of the wheel and beyond its range.
+        //
+        TestTaskPtr secondTask = ICE_MAKE_SHARED(TestTask);
+        TestTaskPtr hourTask = ICE_MAKE_SHARED(TestTask);
+        TestTaskPtr monthTask = ICE_MAKE_SHARED(TestTask);
+        timer->schedule(secondTask, IceUtil::Time::seconds(1));
+        timer->schedule(hourTask, IceUtil::Time::seconds(3600));
+        timer->schedule(monthTask, IceUtil::Time::seconds(90 * 24 * 3600));
+        test(timer->cancel(secondTask) && timer->cancel(hourTask) && timer->cancel(monthTask));
+        test(!timer->cancel(secondTask) && !timer->cancel(hourTask) && !timer->cancel(monthTask));
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1200));
+        test(!task->hasRun() && !secondTask->hasRun());
+
+        //
+        // A canceled task can be scheduled again.
+        //
+        timer->schedule(task, IceUtil::Time::milliSeconds(10));
+        task->waitForRun(IceUtil::Time::seconds(10));
+        test(!timer->cancel(task));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing repeated tasks... " << flush;
+    {
+        TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
+        timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(20));
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        test(task->getCount() > 1);
+        test(task->getCount() < 26);
+        test(timer->cancel(task));
+        int count = task->getCount();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        test(count == task->getCount() || count + 1 == task->getCount());
+        test(!timer->cancel(task));
+
+        //
+        // A repeated task with a delay beyond 256 ticks is moved down the wheel each time
+        // it's scheduled again.
+        //
+        task = ICE_MAKE_SHARED(TestTask);
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(300));
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1000));
+        test(task->getRunTime() >= start + IceUtil::Time::milliSeconds(300));
+        test(task->getCount() >= 2 && task->getCount() <= 3);
+        test(timer->cancel(task));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing delays beyond 256 ticks... " << flush;
+    {
+        //
+        // Tasks around and beyond the range of the first level, they run in the order
+        // of their delay and not before it.
+        //
+        const int delays[] = { 50, 255, 256, 257, 300, 511, 512, 700, 1000, 1500, 2000 };
+        vector<TestTaskPtr> tasks;
+        for(size_t i = 0; i < sizeof(delays) / sizeof(delays[0]); ++i)
+        {
+            tasks.push_back(ICE_MAKE_SHARED(TestTask, IceUtil::Time::milliSeconds(delays[i])));
+        }
+
+        vector<TestTaskPtr> shuffled = tasks;
+        IceUtilInternal::shuffle(shuffled.begin(), shuffled.end());
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(vector<TestTaskPtr>::const_iterator p = shuffled.begin(); p != shuffled.end(); ++p)
+        {
+            timer->schedule(*p, (*p)->getDelay());
+        }
+
+        for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun(IceUtil::Time::seconds(10));
+            test((*p)->getRunTime() >= start + (*p)->getDelay());
+            if(p != tasks.begin())
+            {
+                test((*p)->getRunTime() >= (*(p - 1))->getRunTime());
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing delays beyond 65536 ticks... " << flush;
+    {
+        longTask->waitForRun(longTask->getDelay() + IceUtil::Time::seconds(10));
+        test(longTask->getRunTime() >= longStart + longTask->getDelay());
+        test(longTask->getCount() == 1);
+    }
+    cout << "ok" << endl;
+
+    timer->destroy();
+
+    cout << "testing destroy with pending tasks... " << flush;
+    {
+        timer = new IceInternal::TimerWheel(4, false, 0);
+        vector<TestTaskPtr> tasks;
+        for(int i = 0; i < 50; ++i)
+        {
+            tasks.push_back(ICE_MAKE_SHARED(TestTask, IceUtil::Time::milliSeconds(100 + i * 100)));
+            timer->schedule(tasks.back(), tasks.back()->getDelay());
+        }
+        TestTaskPtr repeatedTask = ICE_MAKE_SHARED(TestTask);
+        timer->scheduleRepeated(repeatedTask, IceUtil::Time::milliSeconds(300));
+        TestTaskPtr hourTask = ICE_MAKE_SHARED(TestTask);
+        timer->schedule(hourTask, IceUtil::Time::seconds(3600));
+
+        //
+        // The timer threads are joined without waiting for the pending tasks.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        timer->destroy();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::seconds(5));
+        timer->destroy(); // Destroying twice is fine.
+
+        try
+        {
+            timer->schedule(ICE_MAKE_SHARED(TestTask), IceUtil::Time());
+            test(false);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // Expected.
+        }
+        test(!timer->cancel(hourTask));
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            test(!(*p)->hasRun());
+        }
+        test(!repeatedTask->hasRun() && !hourTask->hasRun());
+
+        //
+        // A timer task can destroy the timer, the timer threads are detached.
+        //
+        timer = new IceInternal::TimerWheel(1, false, 0);
+        TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
+        timer->schedule(task, IceUtil::Time::seconds(3600));
+        DestroyTaskPtr destroyTask = ICE_MAKE_SHARED(DestroyTask, timer);
+        timer->schedule(destroyTask, IceUtil::Time());
+        destroyTask->waitForRun();
+        test(!timer->cancel(task) && !task->hasRun());
+        timer = 0;
+    }
+    cout << "ok" << endl;
+}
+
+DEFINE_TEST(Client)
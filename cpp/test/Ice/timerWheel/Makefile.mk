@@ -0,0 +1,8 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+$(test)_client_sources  = Client.cpp
+$(test)_cppflags        := -I$(srcdir)
+
+tests += $(test)
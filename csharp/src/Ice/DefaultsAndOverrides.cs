@@ -143,10 +143,14 @@ namespace IceInternal
             {
                 defaultEndpointSelection = Ice.EndpointSelectionType.Ordered;
             }
+            else if(val.Equals("LeastLatency"))
+            {
+                defaultEndpointSelection = Ice.EndpointSelectionType.LeastLatency;
+            }
             else
             {
                 Ice.EndpointSelectionTypeParseException ex = new Ice.EndpointSelectionTypeParseException();
-                ex.str = "illegal value `" + val + "'; expected `Random' or `Ordered'";
+                ex.str = "illegal value `" + val + "'; expected `Random', `Ordered' or `LeastLatency'";
                 throw ex;
             }
 
@@ -835,7 +835,7 @@ namespace IceInternal
                     }
                 }
 
-                if(selType == Ice.EndpointSelectionType.Random)
+                if(selType != Ice.EndpointSelectionType.Ordered)
                 {
                     IceUtilInternal.Collections.Shuffle(ref addresses);
                 }
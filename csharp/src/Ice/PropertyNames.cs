@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Sep  6 18:11:04 2019
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 09:14:43 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -61,7 +61,17 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Shards$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Backend$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
+             new Property(@"^Ice\.Admin\.Lane\.[^\s]+$", false, null),
+             new Property(@"^Ice\.Admin\.LaneContext$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
              new Property(@"^Ice\.Admin\.Facets$", false, null),
@@ -73,14 +83,21 @@ namespace IceInternal
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", true, null),
              new Property(@"^Ice\.BatchAutoFlushSize$", false, null),
+             new Property(@"^Ice\.BufferPoolSize$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
              new Property(@"^Ice\.ClassGraphDepthMax$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
+             new Property(@"^Ice\.Compression\.Adaptive$", false, null),
+             new Property(@"^Ice\.Compression\.Codec$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
+             new Property(@"^Ice\.Compression\.MaxRatio$", false, null),
+             new Property(@"^Ice\.Compression\.ProbeInterval$", false, null),
              new Property(@"^Ice\.CollectObjects$", false, null),
              new Property(@"^Ice\.Config$", false, null),
+             new Property(@"^Ice\.ConnectAttemptDelay$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
@@ -116,6 +133,9 @@ namespace IceInternal
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
              new Property(@"^Ice\.HTTPProxyPort$", false, null),
+             new Property(@"^Ice\.HostResolver\.CacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.NegativeCacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.Size$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
@@ -123,6 +143,7 @@ namespace IceInternal
              new Property(@"^Ice\.LogFile$", false, null),
              new Property(@"^Ice\.LogFile\.SizeMax$", false, null),
              new Property(@"^Ice\.LogStdErr\.Convert$", false, null),
+             new Property(@"^Ice\.MessageFragmentSize$", false, null),
              new Property(@"^Ice\.MessageSizeMax$", false, null),
              new Property(@"^Ice\.Nohup$", false, null),
              new Property(@"^Ice\.NullHandleAbort$", false, null),
@@ -139,13 +160,18 @@ namespace IceInternal
              new Property(@"^Ice\.PrintAdapterReady$", false, null),
              new Property(@"^Ice\.PrintProcessId$", false, null),
              new Property(@"^Ice\.PrintStackTraces$", false, null),
+             new Property(@"^Ice\.PropagateDeadline$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
+             new Property(@"^Ice\.SendQueueLengthMax$", false, null),
+             new Property(@"^Ice\.SendQueueSizeMax$", false, null),
+             new Property(@"^Ice\.SendQueueWait$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
              new Property(@"^Ice\.SOCKSProxyPort$", false, null),
              new Property(@"^Ice\.StdErr$", false, null),
              new Property(@"^Ice\.StdOut$", false, null),
+             new Property(@"^Ice\.StreamChunkWindow$", false, null),
              new Property(@"^Ice\.SyslogFacility$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.SizeMax$", false, null),
@@ -154,6 +180,10 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Shards$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchWorkers$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Backend$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.BackendQueueSize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -161,7 +191,12 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Shards$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchWorkers$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Backend$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.BackendQueueSize$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Timer\.Shards$", false, null),
              new Property(@"^Ice\.ToStringMode$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Logger$", false, null),
@@ -171,11 +206,13 @@ namespace IceInternal
              new Property(@"^Ice\.Trace\.Retry$", false, null),
              new Property(@"^Ice\.Trace\.Slicing$", false, null),
              new Property(@"^Ice\.Trace\.ThreadPool$", false, null),
+             new Property(@"^Ice\.UDP\.BatchSize$", false, null),
              new Property(@"^Ice\.UDP\.RcvSize$", false, null),
              new Property(@"^Ice\.UDP\.SndSize$", false, null),
              new Property(@"^Ice\.TCP\.Backlog$", false, null),
              new Property(@"^Ice\.TCP\.RcvSize$", false, null),
              new Property(@"^Ice\.TCP\.SndSize$", false, null),
+             new Property(@"^Ice\.TCP\.ZeroCopySize$", false, null),
              new Property(@"^Ice\.UseApplicationClassLoader$", false, null),
              new Property(@"^Ice\.UseOSLog$", false, null),
              new Property(@"^Ice\.UseSyslog$", false, null),
@@ -187,6 +224,7 @@ namespace IceInternal
              new Property(@"^Ice\.Warn\.Endpoints$", false, null),
              new Property(@"^Ice\.Warn\.UnknownProperties$", false, null),
              new Property(@"^Ice\.Warn\.UnusedProperties$", false, null),
+             new Property(@"^Ice\.WriteCoalesceSize$", false, null),
              new Property(@"^Ice\.CacheMessageBuffers$", false, null),
              new Property(@"^Ice\.ThreadInterruptSafe$", false, null),
              new Property(@"^Ice\.Voip$", true, null),
@@ -242,7 +280,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.LaneContext$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
@@ -279,7 +327,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.LaneContext$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -316,7 +374,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.LaneContext$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.RetryCount$", false, null),
@@ -366,7 +434,17 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.LaneContext$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -403,7 +481,17 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.LaneContext$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceLocatorDiscovery\.Lookup$", false, null),
              new Property(@"^IceLocatorDiscovery\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.RetryCount$", false, null),
@@ -491,7 +579,17 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceBridge\.Source\.MessageSizeMax$", false, null),
+             new Property(@"^IceBridge\.Source\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceBridge\.Source\.LaneContext$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceBridge\.Target\.Endpoints$", false, null),
              new Property(@"^IceBridge\.InstanceName$", false, null),
              null
@@ -543,7 +641,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGridAdmin\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.LaneContext$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Address$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Interface$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Lookup$", false, null),
@@ -583,7 +691,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.LaneContext$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Close$", false, null),
@@ -620,7 +738,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.LaneContext$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
              null
@@ -664,7 +792,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
@@ -702,7 +840,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Node\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
@@ -780,7 +928,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
@@ -827,7 +985,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Timeout$", false, null),
@@ -866,7 +1034,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Port$", false, null),
@@ -908,7 +1086,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
@@ -962,7 +1150,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
@@ -1000,7 +1198,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.LaneContext$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
@@ -1068,7 +1276,17 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Shards$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Backend$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
+             new Property(@"^IcePatch2\.Lane\.[^\s]+$", false, null),
+             new Property(@"^IcePatch2\.LaneContext$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
              null
@@ -1186,7 +1404,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Shards$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Backend$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Client\.Lane\.[^\s]+$", false, null),
+             new Property(@"^Glacier2\.Client\.LaneContext$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
              new Property(@"^Glacier2\.Client\.ForwardContext$", false, null),
@@ -1261,7 +1489,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Shards$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchWorkers$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Backend$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.BackendQueueSize$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Server\.Lane\.[^\s]+$", false, null),
+             new Property(@"^Glacier2\.Server\.LaneContext$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Latency$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
              new Property(@"^Glacier2\.Server\.ForwardContext$", false, null),
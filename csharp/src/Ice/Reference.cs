@@ -1150,8 +1150,24 @@ namespace IceInternal
             properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
             properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
             properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-            properties[prefix + ".EndpointSelection"] =
-                       _endpointSelection == Ice.EndpointSelectionType.Random ? "Random" : "Ordered";
+            switch(_endpointSelection)
+            {
+                case Ice.EndpointSelectionType.Random:
+                {
+                    properties[prefix + ".EndpointSelection"] = "Random";
+                    break;
+                }
+                case Ice.EndpointSelectionType.Ordered:
+                {
+                    properties[prefix + ".EndpointSelection"] = "Ordered";
+                    break;
+                }
+                case Ice.EndpointSelectionType.LeastLatency:
+                {
+                    properties[prefix + ".EndpointSelection"] = "LeastLatency";
+                    break;
+                }
+            }
             properties[prefix + ".LocatorCacheTimeout"] = _locatorCacheTimeout.ToString(CultureInfo.InvariantCulture);
             properties[prefix + ".InvocationTimeout"] = getInvocationTimeout().ToString(CultureInfo.InvariantCulture);
 
@@ -1541,7 +1557,12 @@ namespace IceInternal
             //
             switch(getEndpointSelection())
             {
+                //
+                // LeastLatency is only implemented by the C++ run time, the endpoints are
+                // shuffled as with Random.
+                //
                 case Ice.EndpointSelectionType.Random:
+                case Ice.EndpointSelectionType.LeastLatency:
                 {
                     lock(rand_)
                     {
@@ -836,10 +836,15 @@ namespace IceInternal
                     {
                         endpointSelection = Ice.EndpointSelectionType.Ordered;
                     }
+                    else if(type.Equals("LeastLatency"))
+                    {
+                        endpointSelection = Ice.EndpointSelectionType.LeastLatency;
+                    }
                     else
                     {
                         throw new Ice.EndpointSelectionTypeParseException("illegal value `" + type +
-                                                                          "'; expected `Random' or `Ordered'");
+                                                                          "'; expected `Random', `Ordered' " +
+                                                                          "or `LeastLatency'");
                     }
                 }
 
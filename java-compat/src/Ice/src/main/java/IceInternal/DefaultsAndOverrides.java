@@ -152,10 +152,14 @@ public final class DefaultsAndOverrides
         {
             defaultEndpointSelection = Ice.EndpointSelectionType.Ordered;
         }
+        else if(value.equals("LeastLatency"))
+        {
+            defaultEndpointSelection = Ice.EndpointSelectionType.LeastLatency;
+        }
         else
         {
             Ice.EndpointSelectionTypeParseException ex = new Ice.EndpointSelectionTypeParseException();
-            ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+            ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `LeastLatency'";
             throw ex;
         }
 
@@ -940,7 +940,7 @@ public final class Network
                 }
             }
 
-            if(selType == Ice.EndpointSelectionType.Random)
+            if(selType != Ice.EndpointSelectionType.Ordered)
             {
                 java.util.Collections.shuffle(addresses);
             }
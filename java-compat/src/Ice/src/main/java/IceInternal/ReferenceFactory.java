@@ -829,10 +829,15 @@ public final class ReferenceFactory
                 {
                     endpointSelection = Ice.EndpointSelectionType.Ordered;
                 }
+                else if(type.equals("LeastLatency"))
+                {
+                    endpointSelection = Ice.EndpointSelectionType.LeastLatency;
+                }
                 else
                 {
                     throw new Ice.EndpointSelectionTypeParseException("illegal value `" + type +
-                                                                      "'; expected `Random' or `Ordered'");
+                                                                      "'; expected `Random', `Ordered' " +
+                                                                      "or `LeastLatency'");
                 }
             }
 
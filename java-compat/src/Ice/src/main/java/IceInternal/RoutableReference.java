@@ -397,8 +397,24 @@ public class RoutableReference extends Reference
         properties.put(prefix + ".CollocationOptimized", _collocationOptimized ? "1" : "0");
         properties.put(prefix + ".ConnectionCached", _cacheConnection ? "1" : "0");
         properties.put(prefix + ".PreferSecure", _preferSecure ? "1" : "0");
-        properties.put(prefix + ".EndpointSelection",
-                       _endpointSelection == Ice.EndpointSelectionType.Random ? "Random" : "Ordered");
+        switch(_endpointSelection)
+        {
+            case Random:
+            {
+                properties.put(prefix + ".EndpointSelection", "Random");
+                break;
+            }
+            case Ordered:
+            {
+                properties.put(prefix + ".EndpointSelection", "Ordered");
+                break;
+            }
+            case LeastLatency:
+            {
+                properties.put(prefix + ".EndpointSelection", "LeastLatency");
+                break;
+            }
+        }
 
         {
             StringBuffer s = new StringBuffer();
@@ -780,7 +796,12 @@ public class RoutableReference extends Reference
         //
         switch(getEndpointSelection())
         {
+            //
+            // LeastLatency is only implemented by the C++ run time, the endpoints are
+            // shuffled as with Random.
+            //
             case Random:
+            case LeastLatency:
             {
                 java.util.Collections.shuffle(endpoints);
                 break;
@@ -152,11 +152,15 @@ public final class DefaultsAndOverrides
         {
             defaultEndpointSelection = com.zeroc.Ice.EndpointSelectionType.Ordered;
         }
+        else if(value.equals("LeastLatency"))
+        {
+            defaultEndpointSelection = com.zeroc.Ice.EndpointSelectionType.LeastLatency;
+        }
         else
         {
             com.zeroc.Ice.EndpointSelectionTypeParseException ex =
                 new com.zeroc.Ice.EndpointSelectionTypeParseException();
-            ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+            ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `LeastLatency'";
             throw ex;
         }
 
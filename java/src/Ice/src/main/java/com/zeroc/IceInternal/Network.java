@@ -945,7 +945,7 @@ public final class Network
                 }
             }
 
-            if(selType == EndpointSelectionType.Random)
+            if(selType != EndpointSelectionType.Ordered)
             {
                 java.util.Collections.shuffle(addresses);
             }
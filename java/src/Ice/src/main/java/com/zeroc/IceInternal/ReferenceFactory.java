@@ -831,10 +831,15 @@ public final class ReferenceFactory
                 {
                     endpointSelection = com.zeroc.Ice.EndpointSelectionType.Ordered;
                 }
+                else if(type.equals("LeastLatency"))
+                {
+                    endpointSelection = com.zeroc.Ice.EndpointSelectionType.LeastLatency;
+                }
                 else
                 {
                     throw new com.zeroc.Ice.EndpointSelectionTypeParseException("illegal value `" + type +
-                                                                      "'; expected `Random' or `Ordered'");
+                                                                      "'; expected `Random', `Ordered' " +
+                                                                      "or `LeastLatency'");
                 }
             }
 
@@ -93,10 +93,14 @@ class DefaultsAndOverrides
         {
             this.defaultEndpointSelection = EndpointSelectionType.Ordered;
         }
+        else if(value === "LeastLatency")
+        {
+            this.defaultEndpointSelection = EndpointSelectionType.LeastLatency;
+        }
         else
         {
             const ex = new Ice.EndpointSelectionTypeParseException();
-            ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+            ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `LeastLatency'";
             throw ex;
         }
 
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Fri Sep  6 18:11:04 2019
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 09:14:43 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -64,7 +64,17 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Shards/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchWorkers/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Backend/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.BackendQueueSize/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.Lane\../", false, null),
+    new Property("/^Ice\.Admin\.LaneContext/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Min/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Max/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Latency/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -76,14 +86,21 @@ PropertyNames.IceProps =
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BufferPoolSize/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClassGraphDepthMax/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
+    new Property("/^Ice\.Compression\.Adaptive/", false, null),
+    new Property("/^Ice\.Compression\.Codec/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
+    new Property("/^Ice\.Compression\.MaxRatio/", false, null),
+    new Property("/^Ice\.Compression\.ProbeInterval/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
+    new Property("/^Ice\.ConnectAttemptDelay/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
@@ -119,6 +136,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTTL/", false, null),
+    new Property("/^Ice\.HostResolver\.NegativeCacheTTL/", false, null),
+    new Property("/^Ice\.HostResolver\.Size/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
@@ -126,6 +146,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.LogFile/", false, null),
     new Property("/^Ice\.LogFile\.SizeMax/", false, null),
     new Property("/^Ice\.LogStdErr\.Convert/", false, null),
+    new Property("/^Ice\.MessageFragmentSize/", false, null),
     new Property("/^Ice\.MessageSizeMax/", false, null),
     new Property("/^Ice\.Nohup/", false, null),
     new Property("/^Ice\.NullHandleAbort/", false, null),
@@ -142,13 +163,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintAdapterReady/", false, null),
     new Property("/^Ice\.PrintProcessId/", false, null),
     new Property("/^Ice\.PrintStackTraces/", false, null),
+    new Property("/^Ice\.PropagateDeadline/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
+    new Property("/^Ice\.SendQueueLengthMax/", false, null),
+    new Property("/^Ice\.SendQueueSizeMax/", false, null),
+    new Property("/^Ice\.SendQueueWait/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
     new Property("/^Ice\.SOCKSProxyPort/", false, null),
     new Property("/^Ice\.StdErr/", false, null),
     new Property("/^Ice\.StdOut/", false, null),
+    new Property("/^Ice\.StreamChunkWindow/", false, null),
     new Property("/^Ice\.SyslogFacility/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.SizeMax/", false, null),
@@ -157,6 +183,10 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Shards/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchWorkers/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Backend/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.BackendQueueSize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
@@ -164,7 +194,12 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Shards/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchWorkers/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Backend/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.BackendQueueSize/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Timer\.Shards/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
@@ -174,11 +209,13 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Trace\.Retry/", false, null),
     new Property("/^Ice\.Trace\.Slicing/", false, null),
     new Property("/^Ice\.Trace\.ThreadPool/", false, null),
+    new Property("/^Ice\.UDP\.BatchSize/", false, null),
     new Property("/^Ice\.UDP\.RcvSize/", false, null),
     new Property("/^Ice\.UDP\.SndSize/", false, null),
     new Property("/^Ice\.TCP\.Backlog/", false, null),
     new Property("/^Ice\.TCP\.RcvSize/", false, null),
     new Property("/^Ice\.TCP\.SndSize/", false, null),
+    new Property("/^Ice\.TCP\.ZeroCopySize/", false, null),
     new Property("/^Ice\.UseApplicationClassLoader/", false, null),
     new Property("/^Ice\.UseOSLog/", false, null),
     new Property("/^Ice\.UseSyslog/", false, null),
@@ -190,6 +227,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Warn\.Endpoints/", false, null),
     new Property("/^Ice\.Warn\.UnknownProperties/", false, null),
     new Property("/^Ice\.Warn\.UnusedProperties/", false, null),
+    new Property("/^Ice\.WriteCoalesceSize/", false, null),
     new Property("/^Ice\.CacheMessageBuffers/", false, null),
     new Property("/^Ice\.ThreadInterruptSafe/", false, null),
     new Property("/^Ice\.Voip/", true, null),
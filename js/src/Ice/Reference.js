@@ -784,10 +784,15 @@ class ReferenceFactory
                 {
                     endpointSelection = EndpointSelectionType.Ordered;
                 }
+                else if(type == "LeastLatency")
+                {
+                    endpointSelection = EndpointSelectionType.LeastLatency;
+                }
                 else
                 {
                     throw new Ice.EndpointSelectionTypeParseException("illegal value `" + type +
-                                                                      "'; expected `Random' or `Ordered'");
+                                                                      "'; expected `Random', `Ordered' " +
+                                                                      "or `LeastLatency'");
                 }
             }
 
@@ -1996,8 +2001,24 @@ class RoutableReference extends Reference
         properties.set(prefix + ".CollocationOptimized", "0");
         properties.set(prefix + ".ConnectionCached", this._cacheConnection ? "1" : "0");
         properties.set(prefix + ".PreferSecure", this._preferSecure ? "1" : "0");
-        properties.set(prefix + ".EndpointSelection",
-                       this._endpointSelection === EndpointSelectionType.Random ? "Random" : "Ordered");
+        switch(this._endpointSelection)
+        {
+            case EndpointSelectionType.Random:
+            {
+                properties.set(prefix + ".EndpointSelection", "Random");
+                break;
+            }
+            case EndpointSelectionType.Ordered:
+            {
+                properties.set(prefix + ".EndpointSelection", "Ordered");
+                break;
+            }
+            case EndpointSelectionType.LeastLatency:
+            {
+                properties.set(prefix + ".EndpointSelection", "LeastLatency");
+                break;
+            }
+        }
 
         properties.set(prefix + ".LocatorCacheTimeout", String(this._locatorCacheTimeout));
         properties.set(prefix + ".InvocationTimeout", String(this.getInvocationTimeout()));
@@ -2285,7 +2306,12 @@ class RoutableReference extends Reference
         //
         switch(this.getEndpointSelection())
         {
+            //
+            // LeastLatency is only implemented by the C++ run time, the endpoints are
+            // shuffled as with Random.
+            //
             case EndpointSelectionType.Random:
+            case EndpointSelectionType.LeastLatency:
             {
                 //
                 // Shuffle the endpoints.
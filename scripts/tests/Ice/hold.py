@@ -3,4 +3,20 @@
 # Copyright (c) ZeroC, Inc. All rights reserved.
 #
 
-TestSuite(__name__, [ClientServerTestCase(server=Server(readyCount=2))])
+testcases = [ ClientServerTestCase(server=Server(readyCount=2)) ]
+
+#
+# Also run the C++ test with dispatch workers, the serialize mode test checks that requests from
+# the same connection are still dispatched in order when handed over to the dispatch workers.
+#
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    workerProps = {
+        "Ice.ThreadPool.Client.DispatchWorkers" : 2,
+        "TestAdapter1.ThreadPool.DispatchWorkers" : 3,
+        "TestAdapter2.ThreadPool.DispatchWorkers" : 3
+    }
+    testcases.append(ClientServerTestCase(name="client/server with dispatch workers",
+                                          client=Client(props=workerProps),
+                                          server=Server(readyCount=2, props=workerProps)))
+
+TestSuite(__name__, testcases)
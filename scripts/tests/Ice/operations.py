@@ -0,0 +1,137 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+#
+# The test cases are computed from the test sources, except for C++ which also runs the
+# test with the thread pool, connection and protocol options below.
+#
+testcases = None
+
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases = [
+        ClientServerTestCase(),
+        ClientAMDServerTestCase(),
+        CollocatedTestCase()
+    ]
+
+    #
+    # Run the client/server test with sharded thread pools.
+    #
+    shardProps = {
+        "Ice.ThreadPool.Client.SizeMax" : 4,
+        "Ice.ThreadPool.Client.Shards" : 2,
+        "Ice.ThreadPool.Server.SizeMax" : 4,
+        "Ice.ThreadPool.Server.Shards" : 2
+    }
+    testcases.append(ClientServerTestCase(name="client/server with sharded thread pools",
+                                          client=Client(props=shardProps),
+                                          server=Server(props=shardProps)))
+
+    #
+    # Write coalescing of queued messages is disabled by default, also run the client/server
+    # test with queued messages coalesced up to 64KB.
+    #
+    coalesceProps = { "Ice.WriteCoalesceSize" : 64 }
+    testcases.append(ClientServerTestCase(name="client/server with write coalescing",
+                                          client=Client(props=coalesceProps),
+                                          server=Server(props=coalesceProps)))
+
+    #
+    # Message buffers are pooled per thread by default, also run the client/server test with
+    # the buffer pools disabled.
+    #
+    noPoolProps = { "Ice.BufferPoolSize" : 0 }
+    testcases.append(ClientServerTestCase(name="client/server without buffer pooling",
+                                          client=Client(props=noPoolProps),
+                                          server=Server(props=noPoolProps)))
+
+    #
+    # Run the client/server test with messages larger than 1KB sent in fragments.
+    #
+    fragmentProps = { "Ice.MessageFragmentSize" : 1 }
+    testcases.append(ClientServerTestCase(name="client/server with message fragmentation",
+                                          client=Client(props=fragmentProps),
+                                          server=Server(props=fragmentProps)))
+
+    #
+    # Run the client/server test with zero-copy sends for messages larger than 4KB on Linux.
+    #
+    if isinstance(platform, Linux):
+        zeroCopyProps = { "Ice.TCP.ZeroCopySize" : 4096 }
+        testcases.append(ClientServerTestCase(name="client/server with zero-copy sends",
+                                              client=Client(props=zeroCopyProps),
+                                              server=Server(props=zeroCopyProps)))
+
+    #
+    # Run the client/server test with the io_uring selector backend on Linux, the test checks
+    # from the client thread pool trace that the backend is used unless it's not available with this
+    # build or kernel.
+    #
+    if isinstance(platform, Linux):
+        class UringTestCase(ClientServerTestCase):
+
+            def runClientSide(self, current):
+                ClientServerTestCase.runClientSide(self, current)
+                for client in self.clients:
+                    output = client.getOutput(current)
+                    if "using io_uring selector backend for `Ice.ThreadPool.Client'" in output:
+                        continue
+                    elif "not supported on this platform" in output or "cannot use io_uring" in output:
+                        current.writeln("io_uring selector backend not available, skipped check")
+                    else:
+                        raise RuntimeError("client didn't use the io_uring selector backend")
+
+        uringProps = {
+            "Ice.ThreadPool.Client.Backend" : "uring",
+            "Ice.ThreadPool.Server.Backend" : "uring",
+            "Ice.Trace.ThreadPool" : 1
+        }
+        testcases.append(UringTestCase(name="client/server with io_uring selector backend",
+                                       client=Client(props=uringProps),
+                                       server=Server(props=uringProps)))
+
+    #
+    # Run the client/server test with protocol compression using the zstd and lz4 codecs, the
+    # test checks from the client protocol trace that requests are compressed with the codec.
+    # The codec libraries are loaded at runtime, the test is skipped if they aren't installed.
+    #
+    class CompressionCodecTestCase(ClientServerTestCase):
+
+        def __init__(self, codec, codecId, libraries):
+            codecProps = {
+                "Ice.Override.Compress" : 1,
+                "Ice.Compression.Codec" : codec,
+                "Ice.Trace.Protocol" : 1
+            }
+            ClientServerTestCase.__init__(self, name="client/server with {0} compression".format(codec),
+                                          client=Client(props=codecProps),
+                                          server=Server(props=codecProps))
+            self.codecId = codecId
+            self.libraries = libraries
+
+        def canRun(self, current):
+            import ctypes
+            if isinstance(platform, Windows):
+                library = self.libraries[0]
+            elif isinstance(platform, Darwin):
+                library = self.libraries[1]
+            else:
+                library = self.libraries[2]
+            try:
+                ctypes.CDLL(library)
+                return True
+            except OSError:
+                return False
+
+        def runClientSide(self, current):
+            ClientServerTestCase.runClientSide(self, current)
+            for client in self.clients:
+                if "(compressed with codec {0};".format(self.codecId) not in client.getOutput(current):
+                    raise RuntimeError("client didn't compress requests with codec {0}".format(self.codecId))
+
+    testcases.append(CompressionCodecTestCase("zstd", 1, ["zstd.dll", "libzstd.1.dylib", "libzstd.so.1"]))
+    testcases.append(CompressionCodecTestCase("lz4", 2, ["liblz4.dll", "liblz4.1.dylib", "liblz4.so.1"]))
+
+TestSuite(__name__, testcases)
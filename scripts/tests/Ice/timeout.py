@@ -10,4 +10,17 @@ traceProps = {
     "Ice.Trace.Protocol" : 1
 }
 
-TestSuite(__name__, [ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps)], options = { "compress" : [False] }, )
+testcases = [ ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps) ]
+
+#
+# Also run the C++ test with a sharded communicator timer, the connection and invocation timeouts
+# are spread over the timer shards.
+#
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    shardProps = { "Ice.Timer.Shards" : 4 }
+    testcases.append(ClientServerTestCase(name="client/server with timer shards",
+                                          client=Client(props=shardProps),
+                                          server=Server(readyCount=2, props=shardProps),
+                                          traceProps=traceProps))
+
+TestSuite(__name__, testcases, options = { "compress" : [False] }, )
@@ -6,21 +6,34 @@ from Util import *
 
 class UdpTestCase(ClientServerTestCase):
 
+    def __init__(self, name="client/server", props={}):
+        ClientServerTestCase.__init__(self, name)
+        self.props = props
+
     def setupServerSide(self, current):
         if current.config.android or current.config.xamarin:
-            self.servers = [Server(ready="McastTestAdapter")]
+            self.servers = [Server(ready="McastTestAdapter", props=self.props)]
         else:
-            self.servers = [Server(args=[i], ready="McastTestAdapter") for i in range(0, 5)]
+            self.servers = [Server(args=[i], ready="McastTestAdapter", props=self.props) for i in range(0, 5)]
 
     def setupClientSide(self, current):
         if current.config.android:
-            self.clients = [Client()]
+            self.clients = [Client(props=self.props)]
         else:
-            self.clients = [Client(args=[5])]
+            self.clients = [Client(args=[5], props=self.props)]
+
+testcases = [ UdpTestCase() ]
+
+#
+# Also run the C++ test with datagrams received and sent in batches with recvmmsg and sendmmsg
+# on Linux.
+#
+if isinstance(platform, Linux) and isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases.append(UdpTestCase(name="client/server with batched datagrams", props={ "Ice.UDP.BatchSize" : 16 }))
 
 #
 # With UWP, we can't run the UDP tests with the C++ servers (used when SSL is enabled).
 #
 options=lambda current: { "protocol": ["tcp", "ws"] } if current.config.uwp else {}
 
-TestSuite(__name__, [ UdpTestCase() ], multihost=False, options=options)
+TestSuite(__name__, testcases, multihost=False, options=options)